@@ -0,0 +1,30 @@
+# ─────────────────────────────────────────────────────────────────────────────
+# Writes BuildIdentity.generated.h: the project version plus a hash of every
+# source and header, e.g. "1.0.0+3f9c0a1e2b4d5c6f".  Run at build time by the
+# solidturbine_build_identity target (see src/CMakeLists.txt).
+#
+#   -DSOURCE_DIR=<project root>  -DVERSION=<x.y.z>  -DOUTPUT=<header path>
+#
+# The header is only rewritten when the identity changes, so an unchanged
+# tree does not recompile anything.
+# ─────────────────────────────────────────────────────────────────────────────
+file(GLOB_RECURSE sources
+    "${SOURCE_DIR}/src/*.cpp"
+    "${SOURCE_DIR}/include/*.h"
+)
+list(SORT sources)
+
+set(digests "")
+foreach(source IN LISTS sources)
+    file(RELATIVE_PATH name "${SOURCE_DIR}" "${source}")
+    file(SHA256 "${source}" digest)
+    string(APPEND digests "${name} ${digest}\n")
+endforeach()
+string(SHA256 tree "${digests}")
+string(SUBSTRING "${tree}" 0 16 tree)
+
+file(WRITE "${OUTPUT}.tmp"
+    "// Generated by cmake/BuildIdentity.cmake — do not edit.\n"
+    "#define SOLIDTURBINE_BUILD_ID \"${VERSION}+${tree}\"\n")
+configure_file("${OUTPUT}.tmp" "${OUTPUT}" COPYONLY)
+file(REMOVE "${OUTPUT}.tmp")
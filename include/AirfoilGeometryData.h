@@ -71,7 +71,7 @@ private:
     /**
      * @brief Relative thickness as percentage of chord length
      */
-    double relativeThickness;
+    double relativeThickness = 0.0;
 
     /**
      * @brief Collection of geometry markers identifying special points
@@ -96,7 +96,7 @@ private:
     /**
      * @brief Orientation of airfoil coordinates -> default is from TE->top->LE->bottom->TE
      */
-    bool coordinateOrientation;
+    bool coordinateOrientation = false;
 
     /**
      * @brief Finds geometry marker by type identifier
@@ -135,6 +135,18 @@ public:
      */
     void setMarkerIndex(std::string type, int idx);
 
+    /**
+     * @brief Sets whether the coordinates are in default (counter-clockwise) order
+     * @param isDefault true once orientationToDefaultCounterClockwiseOrientation() was applied
+     */
+    void setCoordinateOrientation(bool isDefault);
+
+    /**
+     * @brief Replaces the scaled coordinate set (e.g. when restoring a stored section)
+     * @param coords Scaled and transformed coordinates
+     */
+    void setScaledCoordinates(std::vector<AirfoilCoordinate> coords);
+
     /**
      * @brief Adds a header line to the dataset
      * @param header Header string to add
@@ -226,6 +238,12 @@ public:
      */
     const std::vector<std::string> &getHeaders() const;
 
+    /**
+     * @brief Gets whether the coordinates are in default (counter-clockwise) order
+     * @return Coordinate orientation flag
+     */
+    bool getCoordinateOrientation() const;
+
     /**
      * @brief Gets the data type identifier
      * @return Always returns "AirfoilGeometry"
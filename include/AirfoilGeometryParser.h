@@ -2,11 +2,11 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
-#include <fstream>
-#include <sstream>
 #include <stdexcept>
 #include "IDataFileParser.h"
+#include "TextFileScanner.h"
 #include "AirfoilGeometryData.h"
 #include "AirfoilCoordinate.h"
 #include "AirfoilMarker.h"
@@ -63,34 +63,32 @@ class AirfoilGeometryParser : public IDataFileParser {
 private:
 
     /**
-     * @brief Splits line into tokens using delimiter with automatic fallback
+     * @brief Splits line into whitespace-separated tokens
      * @param line Input line to tokenize
-     * @param delimiter Primary delimiter character (default: tab)
-     * @return Vector of trimmed, non-empty tokens
-     * @note Falls back to space delimiter if tab produces ≤1 token
+     * @param tokens Receives non-empty tokens (views into @p line)
      */
-    std::vector<std::string> tokenizeLine(const std::string& line) const;
+    void tokenizeLine(std::string_view line, std::vector<std::string_view>& tokens) const;
 
     /**
      * @brief Checks if tokens represent an airfoil coordinate line
      * @param tokens Tokenized line to check
      * @return true if line starts with "DEF" and has ≥3 tokens
      */
-    bool isCoordinateLine(const std::vector<std::string>& tokens) const;
+    bool isCoordinateLine(const std::vector<std::string_view>& tokens) const;
 
     /**
      * @brief Checks if tokens represent a geometry marker line
      * @param tokens Tokenized line to check
      * @return true if line starts with "MARKER" and has ≥3 tokens
      */
-    bool isMarkerLine(const std::vector<std::string>& tokens) const;
+    bool isMarkerLine(const std::vector<std::string_view>& tokens) const;
 
     /**
      * @brief Checks if tokens represent a header line with metadata
      * @param tokens Tokenized line to check
      * @return true if line starts with "NAME" or "RELDICKE" and has ≥2 tokens
      */
-    bool isHeaderLine(const std::vector<std::string>& tokens) const;
+    bool isHeaderLine(const std::vector<std::string_view>& tokens) const;
 
 
 public:
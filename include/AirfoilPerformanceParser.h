@@ -2,16 +2,15 @@
 
 #include <vector>
 #include <string>
-#include <fstream>
-#include <sstream>
+#include <string_view>
 #include <stdexcept>
 #include <iostream>
 #include <memory>
-#include <algorithm>
 #include <numbers>
 
 #include "AirfoilPolarData.h"
 #include "IDataFileParser.h"
+#include "TextFileScanner.h"
 
 /**
  * @brief File parser implementation for airfoil aerodynamic performance data
@@ -41,6 +40,10 @@
  * AUXDATA keys extracted: renum, ma, airfoil, stallAngle, negStallAngle,
  * designAngle, opt, tool, addons, runnum, ar, path.
  *
+ * Files are memory-mapped and scanned with LineScanner; tokens are string
+ * views converted with std::from_chars, so well-formed files are parsed
+ * without per-line allocations or exceptions.
+ *
  * @see IDataFileParser for the base interface
  * @see AirfoilPolarData for output data structure
  * @see AirfoilPolarPoint for individual data points
@@ -68,32 +71,33 @@ private:
     /**
      * @brief Splits line into tokens using delimiter with automatic fallback
      * @param line Input line to tokenize
+     * @param tokens Receives trimmed, non-empty tokens (views into @p line)
      * @param delimiter Primary delimiter character (default: tab)
-     * @return Vector of trimmed, non-empty tokens
      * @note Falls back to space delimiter if tab produces ≤1 token
      */
-    std::vector<std::string> tokenizeLine(const std::string &line, char delimiter = '\t') const;
+    void tokenizeLine(std::string_view line, std::vector<std::string_view> &tokens,
+                      char delimiter = '\t') const;
 
     /**
      * @brief Checks if tokens represent a native-format header line
      * @param tokens Tokenized line to check
      * @return true if line contains header keywords (REFNUM, XA, THICK, etc.)
      */
-    bool isHeaderLine(const std::vector<std::string> &tokens) const;
+    bool isHeaderLine(const std::vector<std::string_view> &tokens) const;
 
     /**
      * @brief Checks if tokens represent a numeric data line (alpha cl cd cm)
      * @param tokens Tokenized line to check
      * @return true if line has ≥4 tokens and first token is numeric
      */
-    bool isDataLine(const std::vector<std::string> &tokens) const;
+    bool isDataLine(const std::vector<std::string_view> &tokens) const;
 
     /**
      * @brief Detects the format of an open performance file from its first content line
      * @param firstContentLine First non-empty, non-comment line already read from the file
      * @return Detected PolarFormat variant
      */
-    PolarFormat detectFormat(const std::string& firstContentLine) const;
+    PolarFormat detectFormat(std::string_view firstContentLine) const;
 
     /**
      * @brief Parses the native keyword format
@@ -101,14 +105,14 @@ private:
      * Processes REFNUM/XA/THICK/REYN/DEPANG/NALPHA/NVALS headers and
      * numeric alpha-cl-cd-cm data rows.
      *
-     * @param file      Open file stream, positioned after @p firstLine
+     * @param lines     Line scanner, positioned after @p firstLine
      * @param filePath  Path used for error messages
      * @param firstLine First content line already read (re-processed here)
      * @param perfData  Target AirfoilPolarData to populate
      */
-    void parseNativeFormat(std::ifstream& file,
+    void parseNativeFormat(LineScanner& lines,
                            const std::string& filePath,
-                           const std::string& firstLine,
+                           std::string_view firstLine,
                            AirfoilPolarData& perfData) const;
 
     /**
@@ -118,14 +122,14 @@ private:
      * numbers from AUXDATA lines, and numeric data rows (alpha already in
      * degrees, converted to radians on storage).
      *
-     * @param file      Open file stream, positioned after @p firstLine
+     * @param lines     Line scanner, positioned after @p firstLine
      * @param filePath  Path used for error messages
      * @param firstLine First content line already read (TITLE= line)
      * @param perfData  Target AirfoilPolarData to populate
      */
-    void parseTecplotFormat(std::ifstream& file,
+    void parseTecplotFormat(LineScanner& lines,
                             const std::string& filePath,
-                            const std::string& firstLine,
+                            std::string_view firstLine,
                             AirfoilPolarData& perfData) const;
 
     /**
@@ -136,12 +140,12 @@ private:
      *
      * @param line Full AUXDATA line
      * @param key  AUXDATA key to extract (case-insensitive)
-     * @param value Output value string (unchanged if key not found)
+     * @param value Output value view into @p line (unchanged if key not found)
      * @return true if the key was found and value was extracted
      */
-    bool extractAuxDataValue(const std::string& line,
-                             const std::string& key,
-                             std::string& value) const;
+    bool extractAuxDataValue(std::string_view line,
+                             std::string_view key,
+                             std::string_view& value) const;
 
 public:
     /**
@@ -62,22 +62,22 @@ private:
     /**
      * @brief Depang parameter (angle-related parameter)
      */
-    double depang;
+    double depang = 0.0;
 
     /**
      * @brief Number of angle of attack data points
      */
-    int nAlpha;
+    int nAlpha = 0;
 
     /**
      * @brief Number of values per data point
      */
-    int nVals;
+    int nVals = 0;
 
     /**
      * @brief Xa parameter (airfoil-specific parameter)
      */
-    double xa;
+    double xa = 0.0;
 
     /**
      * @brief Build interpolation grids for Reynolds, Mach, and angle of attack
@@ -284,6 +284,24 @@ public:
      */
     int getNVals() const;
 
+    /**
+     * @brief Gets the xa parameter value
+     * @return Xa parameter value
+     */
+    double getXa() const;
+
+    /**
+     * @brief Gets the header lines read from the source file
+     * @return Header lines in file order
+     */
+    const std::vector<std::string> &getHeaders() const;
+
+    /**
+     * @brief Checks whether an interpolation strategy is attached
+     * @return true for polars built with a name (linear strategy), false for parsed polars
+     */
+    bool hasInterpolationStrategy() const;
+
     /**
      * @brief Gets the type name identifier for this data structure
      * @return String identifying the data type (e.g., "BladeGeometry", "AirfoilPerformance")
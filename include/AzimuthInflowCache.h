@@ -0,0 +1,74 @@
+#pragma once
+/**
+ * @file AzimuthInflowCache.h
+ * @brief Shear- and veer-modified uniform inflow for a fixed azimuth sweep.
+ *
+ * Single Responsibility: evaluates the atmospheric profile of a uniform
+ * inflow at every (azimuth, section) of a sweep and keeps the result for the
+ * current hub speed.  No BEM, no local-frame transform.
+ *
+ * The section heights depend only on the azimuth, so they are computed once.
+ * The profile depends only on the hub speed: the power-curve iteration calls
+ * the BEM many times per wind speed (other tip speed, other pitch), and all
+ * of those calls share one batched shear and veer evaluation.
+ *
+ * FlowCalculatorFactory::BuildSampled() with a cached row gives the same
+ * flow field as FlowCalculatorFactory::Build() with the same FlowModifiers.
+ *
+ * @example
+ * ```cpp
+ * AzimuthInflowCache inflow(turbine, psi_vec, FlowModifiers{});
+ * auto fc = fc_factory.BuildSampled(turbine, rot_rate, psi_vec[k],
+ *                                   inflow.At(v_inf, k), v_inf);
+ * ```
+ */
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "FlowModifiers.h"
+#include "IShearModel.h"
+#include "IVeerModel.h"
+#include "MathUtilities.h"
+#include "TurbineGeometry.h"
+
+class AzimuthInflowCache
+{
+public:
+    /**
+     * @param geometry  Turbine geometry providing the section positions.
+     * @param psi_vec   Azimuth angles of the sweep [rad].
+     * @param fm        Shear and veer settings (as for FlowCalculatorFactory::Build).
+     * @throws std::invalid_argument if geometry is null or psi_vec is empty.
+     */
+    AzimuthInflowCache(TurbineGeometry const *geometry,
+                       std::vector<double> const &psi_vec,
+                       FlowModifiers const &fm);
+
+    std::size_t num_azimuths() const { return inflow_.size(); }
+
+    /**
+     * @brief Global-frame inflow of all sections at one azimuth.
+     *
+     * Re-evaluates the profile for all azimuths when @p v_inf differs from
+     * the previous call; the reference stays valid until then.
+     *
+     * @param v_inf    Hub-height free-stream velocity [m/s], >= 0.
+     * @param psi_idx  Index into the psi_vec given at construction.
+     * @throws std::invalid_argument if v_inf < 0.
+     */
+    std::vector<WVPMUtilities::Vec3D<double>> const &At(double v_inf, std::size_t psi_idx);
+
+private:
+    double hub_height_;
+    std::size_t num_sections_;
+    std::unique_ptr<IShearModel> shear_;
+    std::unique_ptr<IVeerModel> veer_;
+
+    std::vector<double> heights_; // azimuth-major, num_sections per azimuth
+    std::vector<double> axial_;   // shear output, same layout
+    std::vector<std::vector<WVPMUtilities::Vec3D<double>>> inflow_; // per azimuth
+    double v_inf_;                // hub speed inflow_ holds (NaN before first use)
+
+    void Evaluate(double v_inf);
+};
@@ -0,0 +1,86 @@
+#pragma once
+/**
+ * @file AzimuthNoiseResolver.h
+ * @brief Rotor noise per blade azimuth from the per-psi BEM solutions.
+ *
+ * The BEM callback already solves every azimuth position; the averaged
+ * BEMPostprocessResult hides the amplitude modulation caused by shear, veer
+ * and tilt.  This class runs the section noise model on the per-psi results
+ * instead and aggregates each azimuth separately.
+ *
+ * Most sections change (Re, alpha, Mach) only slightly around the rotor, so
+ * a section result is reused for every other azimuth whose state lies within
+ * AzimuthNoiseTolerances of an already scheduled one.  Only those distinct
+ * states become noise tasks, and they run in one dynamic OpenMP pool.  With
+ * float32_store the tasks write their spectra straight into a
+ * NoiseSpectrumStore (one point per azimuth), so only the sections in flight
+ * hold double spectra.
+ *
+ * SOLID:
+ *   S – per-azimuth scheduling and blade phasing; the physics stay in
+ *       SectionNoiseCalculator and RotorNoiseAggregator.
+ *   D – depends on those two classes and BEMPostprocessResult only.
+ */
+#include "AzimuthNoiseResult.h"
+#include "BEMPostprocessor.h"
+#include "ISimulationConfig.h"
+#include "RotorNoiseAggregator.h"
+#include "SectionNoiseCalculator.h"
+#include <vector>
+
+class TurbineGeometry;
+
+/// Converged per-psi postprocessor results of one operating point.
+struct PsiPostprocessResults
+{
+    double vinf{0.0};      ///< Wind speed [m/s]
+    double rot_rate{0.0};  ///< Rotor speed [rad/s]
+
+    std::vector<double>               psi_rad;  ///< Ascending, in [0, 2π)
+    std::vector<BEMPostprocessResult> results;  ///< One per psi_rad entry
+};
+
+/// Section states closer than this share one noise evaluation.
+struct AzimuthNoiseTolerances
+{
+    double alpha_deg{0.05};     ///< |Δalpha| [deg]
+    double reynolds_rel{5e-3};  ///< |ΔRe| / Re [-]
+    double mach{5e-4};          ///< |ΔMach| [-]
+};
+
+class AzimuthNoiseResolver
+{
+public:
+    /**
+     * @param calculator  Section noise model (shared with the power-curve run).
+     * @param aggregator  Rotor aggregation and observer geometry.
+     * @param tolerances  Reuse tolerances between azimuth positions.
+     * @param float32_store  Keep the section spectra in a NoiseSpectrumStore.
+     */
+    AzimuthNoiseResolver(SectionNoiseCalculator const &calculator,
+                         RotorNoiseAggregator   const &aggregator,
+                         AzimuthNoiseTolerances        tolerances = {},
+                         bool                          float32_store = false);
+
+    /// Azimuth-resolved levels of one operating point.
+    AzimuthNoiseResult Resolve(PsiPostprocessResults const &psi_results,
+                               TurbineGeometry       const *turbine,
+                               ISimulationConfig     const &sim_config) const;
+
+private:
+    SectionNoiseCalculator const &calculator_;
+    RotorNoiseAggregator   const &aggregator_;
+    AzimuthNoiseTolerances        tolerances_;
+    bool                          float32_store_;
+
+    bool SameState(SectionNoiseInput const &a, SectionNoiseInput const &b) const;
+
+    /// Energy mean over the B blade positions ψ_p + 2π·b/B, taking the
+    /// nearest available azimuth for each blade.
+    static std::vector<double> PhaseBlades(std::vector<double> const &psi_rad,
+                                           std::vector<double> const &levels,
+                                           int n_blades);
+
+    /// max − min of @p levels, ignoring inactive (≤ −99 dB) entries.
+    static double ModulationDepth(std::vector<double> const &levels);
+};
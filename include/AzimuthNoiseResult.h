@@ -0,0 +1,50 @@
+#pragma once
+/**
+ * @file AzimuthNoiseResult.h
+ * @brief Azimuth-resolved rotor noise for one operating point.
+ *
+ * Produced by AzimuthNoiseResolver from the per-psi BEM solutions, written by
+ * INoiseResultsExporter as one zone per operating point (rows = psi).
+ *
+ * Two signals are stored per azimuth position ψ of blade 1:
+ *   blade_*  – RotorNoiseAggregator levels with every blade in the state
+ *              of blade 1 at ψ (the source modulation seen by one blade),
+ *   rotor_*  – energy mean over the blades at ψ + 2π·b/B, i.e. the level
+ *              of the rotating rotor at that instant.
+ * Both use the RotorNoiseAggregator conventions, so their azimuthal energy
+ * mean is directly comparable with rotor_noise_powercurve.dat.
+ *
+ * SOLID:
+ *   S – pure data carrier; no I/O or computation.
+ */
+#include <cstddef>
+#include <vector>
+
+struct AzimuthNoiseResult
+{
+    double vinf{0.0};       ///< Wind speed [m/s]
+    double rot_rate{0.0};   ///< Rotor speed [rad/s]; t = ψ / rot_rate
+    int    n_blades{3};
+
+    std::vector<double> psi_deg;        ///< Azimuth of blade 1 [deg]
+
+    std::vector<double> blade_oaspl;    ///< [dB]
+    std::vector<double> blade_oasplA;   ///< [dB(A)]
+    std::vector<double> blade_lwA;      ///< [dB(A) re 1 pW]
+
+    std::vector<double> rotor_oaspl;    ///< [dB]
+    std::vector<double> rotor_oasplA;   ///< [dB(A)]
+    std::vector<double> rotor_lwA;      ///< [dB(A) re 1 pW]
+
+    /// Modulation depth, max − min over ψ [dB].
+    double blade_oasplA_depth{0.0};
+    double rotor_oasplA_depth{0.0};
+    double rotor_lwA_depth{0.0};
+
+    /// Section noise evaluations actually run vs. taken from a neighbouring
+    /// azimuth with the same (Re, alpha, Mach) within tolerance.
+    std::size_t sections_computed{0};
+    std::size_t sections_reused{0};
+
+    std::size_t size() const { return psi_deg.size(); }
+};
@@ -89,11 +89,16 @@ public:
      * @param sim_config     Physics constants (air_density).
      * @param flow_calc      Local velocity field per section.
      * @param num_blades     Number of rotor blades.
+     * @param detail         Which postprocessing steps Process() runs.
+     *                       Iterative callers that only need (cp, ct) should
+     *                       pass ROTOR_SCALARS; quantities belonging to a
+     *                       skipped level are left zero / empty.
      */
     BEMPostprocessor(TurbineGeometry const *turbine,
                      ISimulationConfig const *sim_config,
                      FlowCalculator const *flow_calc,
-                     double num_blades);
+                     double num_blades,
+                     PostprocessDetail detail = PostprocessDetail::FULL_LOADS);
 
     // IBEMPostprocessor
     void Process(IBEMSolver const &solver) override;
@@ -102,12 +107,15 @@ public:
     /// Access result after a successful Process() call.
     BEMPostprocessResult const &Result() const { return result_; }
 
+    PostprocessDetail Detail() const { return detail_; }
+
 private:
     // ── Injected dependencies (non-owning) ───────────────────────────────────
     TurbineGeometry const *turbine_;
     ISimulationConfig const *sim_config_;
     FlowCalculator const *flow_calc_;
     double num_blades_;
+    PostprocessDetail detail_;
 
     // ── Result storage ────────────────────────────────────────────────────────
     BEMPostprocessResult result_;
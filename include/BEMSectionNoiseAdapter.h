@@ -16,23 +16,34 @@
  */
 #include "ISectionNoiseAdapter.h"
 #include "ISimulationConfig.h"
+#include "SectionNoiseGeometry.h"
+#include <memory>
 
 class BEMSectionNoiseAdapter final : public ISectionNoiseAdapter
 {
 public:
     /**
+     * @param section_geometry   Pre-built per-section airfoil data (see
+     *                           SectionNoiseGeometryBuilder); one entry per
+     *                           turbine section.
      * @param observer_distance  Acoustic observer distance [m].
      * @param observer_theta     Observer elevation [deg] from chord line.
      * @param observer_phi       Observer azimuth  [deg] from span line.
      * @param turbulence_intensity     Ambient TI as fraction (not %) [−].
      * @param turbulence_length_scale  Integral length scale [m].
+     * @throws std::invalid_argument if @p section_geometry is null.
      */
-    BEMSectionNoiseAdapter(double observer_distance     = 1.22,
+    explicit BEMSectionNoiseAdapter(
+                           std::shared_ptr<const SectionNoiseGeometryTable>
+                                  section_geometry,
+                           double observer_distance     = 1.22,
                            double observer_theta        = 90.0,
                            double observer_phi          = 90.0,
                            double turbulence_intensity     = 0.05,
                            double turbulence_length_scale  = 0.01);
 
+    /// @throws std::invalid_argument if the geometry table does not have one
+    ///         entry per section of @p turbine.
     std::vector<SectionNoiseInput> Build(
         BEMPostprocessResult const  &pp,
         TurbineGeometry const       *turbine,
@@ -40,6 +51,7 @@ public:
         double                       vinf) const override;
 
 private:
+    std::shared_ptr<const SectionNoiseGeometryTable> section_geometry_;
     double observer_distance_;
     double observer_theta_;
     double observer_phi_;
@@ -12,7 +12,8 @@
  * is already known from the grid-box search.
  *
  * Preserves the original "find bounding box first" optimisation that
- * reduced execution time to ~40% of the naïve implementation.
+ * reduced execution time to ~40% of the naïve implementation; the box is
+ * now found arithmetically from the uniform grid spacing.
  */
 #include <cstddef>
 #include <vector>
@@ -25,8 +26,8 @@ public:
     /**
      * @brief Interpolate a 3-D velocity vector using bilinear interpolation.
      *
-     * Finds the bounding grid cell first (O(n) scan, fast due to small grid
-     * sizes), then applies two z-direction lerps and one y-direction lerp
+     * Finds the bounding grid cell first (O(1) on the uniform grid), then
+     * applies two z-direction lerps and one y-direction lerp
      * independently for each velocity component (u, v, w).
      *
      * Points outside the grid are clamped to the nearest boundary cell.
@@ -42,9 +43,62 @@ public:
         TurbSimGrid const &grid,
         TurbSimVelocityData const &velocity) const override;
 
+    /**
+     * @brief Interpolate all query points of one timestep.
+     *
+     * Same arithmetic as Interpolate(), so results are identical point by
+     * point; the timestep view and grid metadata are resolved once.
+     */
+    void InterpolateBatch(
+        double const *y,
+        double const *z,
+        std::size_t count,
+        std::size_t raw_ts,
+        TurbSimGrid const &grid,
+        TurbSimVelocityData const &velocity,
+        double *u,
+        double *v,
+        double *w) const override;
+
+    /// Bounding cell of a point: flat index of its (y_lo, z_lo) corner and
+    /// the point's fractional position inside it (0 at the low edge).
+    struct Stencil
+    {
+        std::size_t corner{0};
+        double ty{0.0};
+        double tz{0.0};
+    };
+
+    /**
+     * @brief Cell and weights for (y, z), for callers that reuse them.
+     *
+     * Same cell as Interpolate(); bilinear weights of the corners are
+     * (1-ty)(1-tz), ty(1-tz), (1-ty)tz and ty·tz.  Points outside the grid
+     * give ty / tz outside [0, 1] (linear extrapolation, as Interpolate()).
+     */
+    static Stencil StencilAt(double y, double z, TurbSimGrid const &grid);
+
 private:
-    /// Return the lower bounding index i such that axis[i] <= value < axis[i+1].
+    /// Bounding cell: flat index of its (y_lo, z_lo) corner and its extent.
+    struct Cell
+    {
+        std::size_t corner{0};
+        double y_lo{0.0}, y_hi{0.0};
+        double z_lo{0.0}, z_hi{0.0};
+    };
+
+    static Cell Locate(double y, double z, TurbSimGrid const &grid);
+
+    static WVPMUtilities::Vec3D<double> Blend(Cell const &cell,
+                                              double y,
+                                              double z,
+                                              std::size_t num_y,
+                                              TurbSimVelocityData::TimestepView const &ts);
+
+    /// Return the lower bounding index i such that axis[i] < value <= axis[i+1]
+    /// on a uniform axis with the given spacing.
     /// Clamps to [0, axis.size()-2] for out-of-range values.
     static std::size_t FindLowerIndex(std::vector<double> const &axis,
+                                      double spacing,
                                       double value);
 };
@@ -0,0 +1,172 @@
+#pragma once
+/**
+ * @file BinaryRecord.h
+ * @brief Byte encoding shared by the files SolidTurbine writes for itself
+ *        (project snapshot, checkpoint journal).
+ *
+ * BinaryWriter appends values in native byte order; BinaryReader reads them
+ * back in the same order with every read bounds-checked, so a damaged file
+ * is rejected instead of read past its end.  Strings and vectors are stored
+ * as a u64 element count followed by the elements.  Checksums over encoded
+ * bytes use bladenoise::fnv1a (bladenoise/core/Hash.h).
+ *
+ * @example
+ * ```cpp
+ * BinaryWriter out;
+ * out.f64(pitch);
+ * out.doubles(vinf_vec);
+ * journal.Append(out.take());
+ *
+ * BinaryReader in(record);
+ * const double pitch = in.f64();
+ * std::vector<double> vinf = in.doubles();
+ * ```
+ */
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+// ─────────────────────────────────────────────────────────────────────────────
+/// Builds an encoded byte string.
+class BinaryWriter
+{
+public:
+    template <typename T>
+    void pod(T const &value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        bytes_.append(reinterpret_cast<char const *>(&value), sizeof(T));
+    }
+
+    void u64(std::uint64_t value) { pod(value); }
+    void i64(std::int64_t value) { pod(value); }
+    void i32(std::int32_t value) { pod(value); }
+    void f64(double value) { pod(value); }
+    void flag(bool value) { pod(static_cast<std::uint8_t>(value ? 1 : 0)); }
+
+    /// Bytes without a count (magic numbers, fixed-size fields).
+    void raw(std::string_view value) { bytes_.append(value.data(), value.size()); }
+
+    void str(std::string_view value)
+    {
+        u64(value.size());
+        raw(value);
+    }
+
+    void strings(std::vector<std::string> const &values)
+    {
+        u64(values.size());
+        for (auto const &value : values)
+            str(value);
+    }
+
+    void doubles(std::vector<double> const &values)
+    {
+        u64(values.size());
+        bytes_.append(reinterpret_cast<char const *>(values.data()),
+                      values.size() * sizeof(double));
+    }
+
+    std::string const &bytes() const { return bytes_; }
+    std::string take() { return std::move(bytes_); }
+
+private:
+    std::string bytes_;
+};
+
+// ─────────────────────────────────────────────────────────────────────────────
+/// Reads what BinaryWriter wrote.  Every read throws std::runtime_error
+/// ("<what> is truncated") instead of running past the end.
+class BinaryReader
+{
+public:
+    /**
+     * @param data      Encoded bytes; must outlive the reader.
+     * @param position  Offset of the first read.
+     * @param what      Names the data in errors, e.g. "Project snapshot".
+     */
+    explicit BinaryReader(std::string_view data, std::size_t position = 0,
+                          char const *what = "Record")
+        : data_(data), pos_(std::min(position, data.size())), what_(what)
+    {
+    }
+
+    std::size_t position() const { return pos_; }
+    bool atEnd() const { return pos_ == data_.size(); }
+
+    template <typename T>
+    T pod()
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        need(sizeof(T));
+        T value;
+        std::memcpy(&value, data_.data() + pos_, sizeof(T));
+        pos_ += sizeof(T);
+        return value;
+    }
+
+    std::uint64_t u64() { return pod<std::uint64_t>(); }
+    std::int64_t i64() { return pod<std::int64_t>(); }
+    std::int32_t i32() { return pod<std::int32_t>(); }
+    double f64() { return pod<double>(); }
+    bool flag() { return pod<std::uint8_t>() != 0; }
+
+    std::string_view raw(std::size_t n)
+    {
+        need(n);
+        const std::string_view value = data_.substr(pos_, n);
+        pos_ += n;
+        return value;
+    }
+
+    /// Element count, checked against the remaining bytes before anything
+    /// is reserved.
+    std::size_t count(std::size_t minElementBytes)
+    {
+        const std::uint64_t n = u64();
+        if (n > (data_.size() - pos_) / std::max<std::size_t>(minElementBytes, 1))
+            truncated();
+        return static_cast<std::size_t>(n);
+    }
+
+    std::string str() { return std::string(raw(count(1))); }
+
+    std::vector<std::string> strings()
+    {
+        std::vector<std::string> values(count(8));
+        for (auto &value : values)
+            value = str();
+        return values;
+    }
+
+    std::vector<double> doubles()
+    {
+        std::vector<double> values(count(sizeof(double)));
+        if (!values.empty())
+            std::memcpy(values.data(), data_.data() + pos_, values.size() * sizeof(double));
+        pos_ += values.size() * sizeof(double);
+        return values;
+    }
+
+private:
+    std::string_view data_;
+    std::size_t pos_;
+    char const *what_;
+
+    void need(std::size_t n) const
+    {
+        if (n > data_.size() - pos_)
+            truncated();
+    }
+
+    [[noreturn]] void truncated() const
+    {
+        throw std::runtime_error(std::string(what_) + " is truncated");
+    }
+};
@@ -121,6 +121,12 @@ public:
      */
     double getHubRadius() const { return hubRadius; }
 
+    /**
+     * @brief Sets the hub radius offset [m] (e.g. when restoring normalised data)
+     * @param radius Hub radius offset [m]
+     */
+    void setHubRadius(double radius) { hubRadius = radius; }
+
     /**
      * @brief Shifts all section radii so that the first section starts at r = 0
      *
@@ -3,9 +3,9 @@
 #include "IDataFileParser.h"
 #include "IStructuredData.h"
 #include "BladeGeometryData.h"
+#include "TextFileScanner.h"
 
-#include <sstream>
-#include <fstream>
+#include <string_view>
 
 /**
  * @brief File parser for blade geometry data files — standard and E format
@@ -51,11 +51,12 @@ private:
     /**
      * @brief Splits a line into tokens using delimiter with automatic fallback
      * @param line   Input line to tokenize
+     * @param tokens Receives trimmed, non-empty tokens (views into @p line)
      * @param delimiter Primary delimiter character (default: tab)
-     * @return Vector of trimmed, non-empty tokens
      * @note Automatically falls back to space delimiter if tab produces ≤1 token
      */
-    std::vector<std::string> tokenizeLine(const std::string& line, char delimiter = '\t') const;
+    void tokenizeLine(std::string_view line, std::vector<std::string_view>& tokens,
+                      char delimiter = '\t') const;
 
     /**
      * @brief Parses the standard (DEF-prefixed) blade geometry format
@@ -64,15 +65,15 @@ private:
      * "VERSIO".  The already-read @p firstLine is processed as the first
      * data/header row so no line is skipped.
      *
-     * @param stream    Open file stream positioned after @p firstLine
+     * @param lines     Line scanner positioned after @p firstLine
      * @param filePath  Original file path (for error messages)
      * @param data      Target BladeGeometryData to populate
      * @param firstLine First non-blank, non-comment line already read
      */
-    void parseStandardFormat(std::ifstream& stream,
+    void parseStandardFormat(LineScanner& lines,
                              const std::string& filePath,
                              BladeGeometryData& data,
-                             const std::string& firstLine) const;
+                             std::string_view firstLine) const;
 
     /**
      * @brief Parses the extended (VERSIO-prefixed) BladeGeometry_E format
@@ -81,11 +82,11 @@ private:
      * version string stored.  Reads FILE header and column-header line, then
      * parses 18-column tab-delimited data rows.
      *
-     * @param stream   Open file stream positioned just after the VERSIO line
+     * @param lines    Line scanner positioned just after the VERSIO line
      * @param filePath Original file path (for error messages)
      * @param data     Target BladeGeometryData to populate
      */
-    void parseEFormat(std::ifstream& stream,
+    void parseEFormat(LineScanner& lines,
                       const std::string& filePath,
                       BladeGeometryData& data) const;
 
@@ -1,9 +1,12 @@
 #pragma once
 
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <stdexcept>
 #include <numbers>
+#include "TextFileScanner.h"
 #include "AirfoilCoordinate.h"
 #include "AirfoilPolarData.h"
 #include "AirfoilGeometryData.h"
@@ -171,34 +174,46 @@ struct BladeGeometrySection
      *
      * E-format columns beyond index 9 are left at their zero-initialised defaults.
      *
-     * @param tokens Vector of string tokens from parsed file line
+     * @param tokens Views of the fields of one file line (e.g. from text::splitFields)
      * @throws std::invalid_argument if fewer than 10 tokens provided
      * @throws std::invalid_argument if numeric conversion fails
      */
-    BladeGeometrySection(const std::vector<std::string> &tokens)
+    explicit BladeGeometrySection(std::span<const std::string_view> tokens)
     {
         if (tokens.size() < 10)
         {
             throw std::invalid_argument("Insufficient columns for blade geometry row");
         }
 
-        type              = tokens[0];
-        bladeRadius       = std::stod(tokens[1]);
-        chord             = std::stod(tokens[2]);
-        twist             = std::stod(tokens[3]) * std::numbers::pi / 180.0;
-        relativeThickness = std::stod(tokens[4]);
-        xt4               = std::stod(tokens[5]);
-        yt4               = std::stod(tokens[6]);
-        pcbaX             = std::stod(tokens[7]);
-        pcbaY             = std::stod(tokens[8]);
-        relativeTwistAxis = std::stod(tokens[9]);
+        type              = std::string(tokens[0]);
+        bladeRadius       = text::toDouble(tokens[1]);
+        chord             = text::toDouble(tokens[2]);
+        twist             = text::toDouble(tokens[3]) * std::numbers::pi / 180.0;
+        relativeThickness = text::toDouble(tokens[4]);
+        xt4               = text::toDouble(tokens[5]);
+        yt4               = text::toDouble(tokens[6]);
+        pcbaX             = text::toDouble(tokens[7]);
+        pcbaY             = text::toDouble(tokens[8]);
+        relativeTwistAxis = text::toDouble(tokens[9]);
 
         if (tokens.size() > 10)
-            airfoilName = tokens[10];
+            airfoilName = std::string(tokens[10]);
         else
             airfoilName = "R_" + std::to_string(bladeRadius) + "_m_RelThick_" + std::to_string(relativeThickness);
     }
 
+    /**
+     * @brief Constructor from owned string tokens — same columns as above
+     *
+     * @param tokens Vector of string tokens from parsed file line
+     * @throws std::invalid_argument if fewer than 10 tokens provided
+     * @throws std::invalid_argument if numeric conversion fails
+     */
+    BladeGeometrySection(const std::vector<std::string> &tokens)
+        : BladeGeometrySection(std::vector<std::string_view>(tokens.begin(), tokens.end()))
+    {
+    }
+
     /**
      * @brief Copy constructor
      * @param other The BladeGeometrySection to copy from
@@ -56,6 +56,13 @@ public:
 		const std::vector<const AirfoilGeometryData *> &airfoilGeoms,
 		const std::vector<const AirfoilPolarData *> &airfoilPerfos);
 
+	/**
+	 * @brief Wraps already interpolated sections (e.g. restored from a project snapshot)
+	 *
+	 * No source data is referenced; interpolateAllSections() must not be called.
+	 */
+	explicit BladeInterpolator(std::vector<std::unique_ptr<BladeGeometrySection>> sections);
+
 	/**
 	 * @brief Interpolates all blade sections based on the geometry data
 	 *
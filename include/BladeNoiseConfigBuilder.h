@@ -21,6 +21,7 @@
 #include "ISectionNoiseConfigBuilder.h"
 #include "bladenoise/io/IOTypes.h"
 #include <memory>
+#include <string>
 
 class BladeNoiseConfigBuilder final : public ISectionNoiseConfigBuilder
 {
@@ -29,4 +30,8 @@ public:
         SectionNoiseInput const &inp,
         NoiseConfig       const &noise_cfg,
         SectionNoiseResult      &result) const override;
+
+    /// One-line summary of the shared boundary-layer cache (hits / misses /
+    /// entries) for progress output.
+    static std::string CacheStatistics();
 };
@@ -0,0 +1,53 @@
+#pragma once
+/**
+ * @file BladeNoiseSpectra.h
+ * @brief INoiseSpectra view over double-precision BladeNoiseResults.
+ *
+ * Non-owning: the results must outlive the view.  Point p is results[p].
+ *
+ * SOLID:
+ *  L – interchangeable with NoiseSpectrumStore wherever INoiseSpectra is read.
+ */
+#include "INoiseSpectra.h"
+#include <span>
+
+class BladeNoiseSpectra final : public INoiseSpectra
+{
+public:
+    explicit BladeNoiseSpectra(std::span<const BladeNoiseResult> results);
+
+    std::size_t points() const override { return results_.size(); }
+    std::size_t sections(std::size_t point) const override
+    {
+        return results_[point].sections.size();
+    }
+    std::vector<double> const &frequencies() const override { return frequencies_; }
+
+    double vinf(std::size_t point) const override { return results_[point].vinf; }
+
+    NoiseSectionInfo section(std::size_t point, std::size_t sec) const override;
+
+    double oaspl(std::size_t point, std::size_t sec, NoiseSource src) const override
+    {
+        return Spectrum(point, sec, src).oaspl;
+    }
+
+    double crossover_hz(std::size_t point, std::size_t sec, NoiseSource src) const override
+    {
+        return Spectrum(point, sec, src).directivity_crossover_hz;
+    }
+
+    void spectrum(std::size_t point, std::size_t sec, NoiseSource src,
+                  std::span<double> out) const override;
+
+private:
+    std::span<const BladeNoiseResult> results_;
+    std::vector<double>               frequencies_;  ///< First non-empty axis
+
+    SectionNoiseSpectrum const &Spectrum(std::size_t point, std::size_t sec,
+                                         NoiseSource src) const
+    {
+        return results_[point].sections[sec]
+               .*kNoiseSourceSpectra[static_cast<std::size_t>(src)];
+    }
+};
@@ -8,18 +8,53 @@
  *
  * Open/Closed: implementing a new format means creating a new class, not
  * modifying this one.
+ *
+ * The file is memory-mapped and its int16 samples are not decoded up front;
+ * the returned TurbSimVelocityData keeps the mapping alive and decodes on
+ * access (a 70 MB field stays 70 MB instead of inflating to 280 MB of doubles).
+ *
+ * Constructed with a stream window, the reader instead keeps only that many
+ * timesteps in memory (TurbSimTimestepStream), for fields larger than RAM.
  */
+#include <cstddef>
+#include <string_view>
+
 #include "ITurbSimReader.h"
 
 class BladedBinaryReader final : public ITurbSimReader
 {
 public:
+    /**
+     * @param stream_window  Timesteps held in memory; 0 maps the whole file.
+     *                       Must be at least 3 when non-zero.
+     */
+    explicit BladedBinaryReader(std::size_t stream_window = 0)
+        : stream_window_(stream_window)
+    {
+    }
+
     /**
      * @brief Parse a Bladed/AeroDyn full-field binary (.wnd) file.
      *
      * @param filename  Path to the .wnd file.
-     * @return          Fully populated TurbSimFileData.
+     * @return          TurbSimFileData with packed (lazily decoded) velocities.
      * @throws std::runtime_error on I/O error or malformed file.
      */
     TurbSimFileData Read(std::string const &filename) const override;
+
+private:
+    struct Header
+    {
+        double centre_height{0.0};
+        double ti_u{0.0}, ti_v{0.0}, ti_w{0.0};
+        double spacing_y{0.0}, spacing_z{0.0};
+        double longitudinal_res{0.0};
+        double hub_velocity{0.0};
+        std::size_t nt{0};
+        unsigned num_y{0}, num_z{0};
+    };
+
+    static Header ParseHeader(std::string_view bytes);
+
+    std::size_t stream_window_;
 };
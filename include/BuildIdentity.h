@@ -0,0 +1,24 @@
+#pragma once
+/**
+ * @file BuildIdentity.h
+ * @brief Identifies the code that wrote a project snapshot or checkpoint.
+ *
+ * A snapshot holds interpolated sections and a journal holds solver results;
+ * both are only valid for the code that produced them, so unchanged inputs
+ * are not enough to reuse them.  The CMake build regenerates the identity
+ * from the project version and a hash of the sources whenever a source
+ * changes (cmake/BuildIdentity.cmake).  Builds outside CMake, such as the
+ * unit tests, get "dev".
+ */
+#include <string_view>
+
+#if __has_include("BuildIdentity.generated.h")
+#include "BuildIdentity.generated.h"
+#endif
+
+#ifndef SOLIDTURBINE_BUILD_ID
+#define SOLIDTURBINE_BUILD_ID "dev"
+#endif
+
+/// "<project version>+<source hash>", e.g. "1.0.0+3f9c0a1e2b4d5c6f"
+inline constexpr std::string_view kBuildIdentity = SOLIDTURBINE_BUILD_ID;
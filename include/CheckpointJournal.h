@@ -0,0 +1,120 @@
+#pragma once
+/**
+ * @file CheckpointJournal.h
+ * @brief Append-only record file that lets long runs resume after an abort.
+ *
+ * Single Responsibility: stores opaque records (one per completed unit of
+ * work, plus whatever warm-start state the solver needs) and hands them back
+ * on the next run.  The solvers decide what a record contains and encode it
+ * with BinaryWriter / BinaryReader; the journal only frames, checksums and
+ * writes them.
+ *
+ * Records are appended as work completes, so the cost of a checkpoint does
+ * not grow with the run.  Appending only queues the bytes: a background
+ * thread writes and flushes them, and the solve never waits for the disk.
+ *
+ * File layout
+ * ───────────
+ *   header:  magic "SOLIDCKP", format version, byte-order mark, run key
+ *   records: payload size (u64), FNV-1a 64 of the payload (u64), payload
+ *
+ * A record cut off by a crash fails its size or checksum test; it and
+ * everything after it are dropped on resume.  A journal whose run key does
+ * not match (other inputs, other build, other stage) is ignored and
+ * overwritten.
+ *
+ * @note Values are stored in native byte order.
+ *
+ * @example
+ * ```cpp
+ * CheckpointJournal journal("output/checkpoints/rotormap.ckpt", key, resume);
+ * for (std::string const &rec : journal.restored()) { ... }   // earlier run
+ * journal.Append(record.take());                               // new work
+ * journal.Complete();                                          // run finished
+ * ```
+ */
+#include "BinaryRecord.h"
+#include "BuildIdentity.h"
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+// ─────────────────────────────────────────────────────────────────────────────
+class CheckpointJournal
+{
+public:
+    /// Incremented whenever the framing changes
+    static constexpr std::uint32_t FORMAT_VERSION = 1;
+
+    /**
+     * @brief Run key for one stage of a run.
+     * @param inputs_id  Identifies the inputs (ProjectSnapshot::inputsId()).
+     * @param stage      Stage name, e.g. "rotormap".
+     * @param build_id   Identifies the code; a journal written by another
+     *                   build holds results this one might not reproduce.
+     */
+    static std::uint64_t RunKey(std::uint64_t inputs_id, std::string_view stage,
+                                std::string_view build_id = kBuildIdentity);
+
+    /**
+     * @param path     Journal file (its directory is created on first write).
+     * @param run_key  Must match for an existing journal to be restored.
+     * @param resume   Restore the records of an earlier run; otherwise the
+     *                 journal starts empty and replaces any existing file.
+     */
+    CheckpointJournal(std::string path, std::uint64_t run_key, bool resume);
+
+    /// Writes all queued records; the file stays for a later resume.
+    ~CheckpointJournal();
+
+    CheckpointJournal(CheckpointJournal const &) = delete;
+    CheckpointJournal &operator=(CheckpointJournal const &) = delete;
+
+    std::string const &path() const { return path_; }
+
+    /// Records of the earlier run, in append order.
+    std::vector<std::string> const &restored() const { return restored_; }
+
+    /// Why an existing journal was not restored (empty if none was found).
+    std::string const &restore_note() const { return restore_note_; }
+
+    /**
+     * @brief Keep only the first @p count restored records.
+     *
+     * For solvers that can resume only from certain records (e.g. the last
+     * warm-start state); the rest is removed from the file.  Must be called
+     * before the first Append().
+     */
+    void KeepRestored(std::size_t count);
+
+    /// Queue one record for writing.  Never blocks on I/O.
+    void Append(std::string record);
+
+    /// Write everything queued, then delete the file (the run is finished).
+    void Complete();
+
+private:
+    std::string path_;
+    std::uint64_t run_key_;
+
+    std::vector<std::string> restored_;
+    std::vector<std::uint64_t> restored_end_; // file offset after each restored record
+    std::string restore_note_;
+
+    std::mutex mutex_;
+    std::condition_variable queued_;
+    std::vector<std::string> queue_;
+    bool stop_{false};
+    bool started_{false};
+    std::thread writer_;
+
+    void Restore();
+    void StartWriter();
+    void StopWriter();
+    void WriterLoop(std::uint64_t keep_bytes);
+};
@@ -203,6 +203,12 @@ public:
      */
     bool hasValue(const std::string &key) const;
 
+    /**
+     * @brief Gets all simple values (e.g. for serialisation)
+     * @return Map of parameter names to stored values
+     */
+    const std::unordered_map<std::string, std::any> &getValues() const;
+
     /**
      * @brief Checks if collection exists and contains data
      * @param collectionKey Collection identifier
@@ -14,6 +14,7 @@
 
 #include "Configuration.h"
 #include "LineParser.h"
+#include "FileListLoader.h"
 
 
 /**
@@ -157,6 +158,19 @@ private:
     void loadIndividualAirfoilPerformances(Configuration& config, const FilePathParser* filePathParser,
         const std::string& fileListKey) const;
 
+    /**
+     * @brief Parses the files of a file list concurrently into a collection
+     * @param config Configuration receiving the collection
+     * @param filePathParser Parser for handling individual files
+     * @param filePaths Files to load, in list order
+     * @param fileType Parser key passed to FilePathParser::parseIndividualFile
+     * @param collectionKey Collection the parsed data is appended to (list order)
+     * @note Files that fail to parse are skipped and reported together
+     */
+    void loadIndividualFiles(Configuration& config, const FilePathParser* filePathParser,
+        const std::vector<std::string>& filePaths, const std::string& fileType,
+        const std::string& collectionKey) const;
+
 
 public:
 
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "IStructuredData.h"
+
+/**
+ * @brief Error raised while loading one entry of a file list
+ */
+struct FileLoadError {
+
+    std::size_t index = 0;   ///< Position of the file in the list
+    std::string filePath;    ///< Path as listed
+    std::string message;     ///< Exception text from the parser
+};
+
+/**
+ * @brief Outcome of loading all files of a file list
+ *
+ * Entries are in list order regardless of which thread parsed them, so the
+ * result is identical for every thread count.
+ */
+struct FileListLoadResult {
+
+    /// Parsed data per list entry; nullptr where loading failed
+    std::vector<std::unique_ptr<IStructuredData>> data;
+
+    /// One entry per failed file, ordered by index
+    std::vector<FileLoadError> errors;
+
+    /// Parser warnings per list entry (see FileListLoader::warn)
+    std::vector<std::vector<std::string>> warnings;
+
+    /**
+     * @brief Number of files that were parsed successfully
+     */
+    std::size_t loadedCount() const { return data.size() - errors.size(); }
+};
+
+/**
+ * @brief Parses the files of a file list concurrently
+ *
+ * Each listed file is independent, so FileListLoader hands them to an OpenMP
+ * dynamic schedule (file sizes vary a lot within an airfoil family). Every
+ * task writes only its own result slot; a failing file is recorded in
+ * FileListLoadResult::errors and does not stop the others.
+ *
+ * ## Key Features
+ * - **Concurrent**: One task per file, dynamic load balancing
+ * - **Deterministic**: Results and errors in list order
+ * - **Error Aggregation**: All failures reported together after the load
+ * - **Ordered Warnings**: Parser warnings are collected per file instead of
+ *   being printed from the worker threads
+ *
+ * @note The parse callback is invoked from several threads at once and must
+ *       not modify shared state (all IDataFileParser implementations of this
+ *       project are stateless).
+ *
+ * @example
+ * ```cpp
+ * auto result = FileListLoader::load(paths, [&](const std::string& path) {
+ *     return parser.parseFile(path);
+ * });
+ * for (auto& item : result.data)
+ *     if (item) config.addToCollection("airfoils", std::move(item));
+ * ```
+ */
+class FileListLoader {
+
+public:
+
+    using ParseFunction = std::function<std::unique_ptr<IStructuredData>(const std::string&)>;
+
+    /**
+     * @brief Loads all files of a list
+     * @param filePaths Files to load, in list order
+     * @param parse Callback parsing a single file (throws on failure)
+     * @return Parsed data and per-file errors in list order
+     */
+    static FileListLoadResult load(const std::vector<std::string>& filePaths,
+                                   const ParseFunction& parse);
+
+    /**
+     * @brief Reports a non-fatal problem found while parsing a file
+     *
+     * Inside load() the warning is collected for the file the calling thread
+     * is parsing; anywhere else it is printed at once, as a single write.
+     * @param message Warning text without the "Warning: " prefix
+     */
+    static void warn(const std::string& message);
+};
@@ -4,6 +4,7 @@
 #include "IOutputTarget.h"
 #include <fstream>
 #include <filesystem>
+#include <string_view>
 
 /**
  * @brief File-based output target
@@ -19,10 +20,15 @@ public:
     bool write(const std::string &content) override;
     bool isReady() const override;
 
+    bool begin() override;
+    bool append(std::string_view chunk) override;
+    bool finish() override;
+
     const std::filesystem::path &getFilePath() const { return m_filePath; }
 
 private:
     std::filesystem::path m_filePath;
+    std::ofstream m_stream; // open between begin() and finish()
 };
 
 #endif // FILEOUTPUTTARGET_H
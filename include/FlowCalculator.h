@@ -114,13 +114,13 @@ private:
     // ── Private orchestration steps ───────────────────────────────────────────
 
     /// Step 1 – populate global_vels_ from the inlet provider.
-    void BuildInletField();
+    void BuildInletField(std::vector<WVPMUtilities::Vec3D<double>> const &global_positions);
 
-    /// Step 2 – apply shear modification to global_vels_.
-    void ApplyShear();
+    /// Step 2 – apply shear modification to global_vels_ (section heights [m]).
+    void ApplyShear(std::vector<double> const &heights);
 
-    /// Step 3 – apply veer modification to global_vels_.
-    void ApplyVeer();
+    /// Step 3 – apply veer modification to global_vels_ (section heights [m]).
+    void ApplyVeer(std::vector<double> const &heights);
 
     /// Step 4 – convert to local frame and add rotational velocity.
     void BuildLocalField();
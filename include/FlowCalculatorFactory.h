@@ -52,48 +52,9 @@ public:
         // ── Inlet provider ────────────────────────────────────────────────────
         auto inlet = std::make_unique<UniformInletProvider>(v_inf);
 
-        // ── Shear model ───────────────────────────────────────────────────────
-        std::unique_ptr<IShearModel> shear;
-        if (!fm.shear.first)
-        {
-            // Shear disabled: return v_inf unchanged at every height.
-            shear = MakeNoShear(v_inf);
-        }
-        else
-        {
-            switch (fm.shear.second)
-            {
-            case 1:
-                shear = std::make_unique<LogShearModel>(
-                    fm.surface_roughness,
-                    fm.ref_vel, fm.ref_height, fm.use_ref_hv);
-                break;
-            case 2:
-                shear = std::make_unique<PowerLawShearModel>(
-                    fm.shear_exponent,
-                    fm.ref_vel, fm.ref_height, fm.use_ref_hv);
-                break;
-            case 3:
-                shear = std::make_unique<DiabaticShearModel>(
-                    fm.surface_roughness, fm.obukhov_length);
-                break;
-            default:
-                throw std::invalid_argument(
-                    "FlowCalculatorFactory: unknown shear mode " + std::to_string(fm.shear.second));
-            }
-        }
-
-        // ── Veer model ────────────────────────────────────────────────────────
-        std::unique_ptr<IVeerModel> veer;
-        if (!fm.veer.first)
-        {
-            veer = std::make_unique<NoVeer>();
-        }
-        else
-        {
-            veer = std::make_unique<LinearVeerModel>(
-                fm.veer.second, geometry->RotorRadius());
-        }
+        // ── Atmospheric profile ───────────────────────────────────────────────
+        auto shear = MakeShear(fm);
+        auto veer = MakeVeer(geometry, fm);
 
         // ── Coordinate transformer ────────────────────────────────────────────
         auto transformer = std::make_unique<PsiCoordinateTransformer>(geometry, psi);
@@ -129,8 +90,52 @@ public:
         FlowModifiers const & /*fm*/)
     {
         auto inlet = std::make_unique<TurbSimInletProvider>(tsm, iteration);
-        auto shear = MakeNoShear(tsm->hub_velocity()); // TurbSim already has profiles
-        auto veer = std::make_unique<NoVeer>();        // ditto
+        // Not applied (TurbSimInletProvider::IncludesAtmosphericProfile);
+        // FlowCalculator still requires non-null strategies.
+        auto shear = MakeNoShear();             // TurbSim already has profiles
+        auto veer = std::make_unique<NoVeer>(); // ditto
+        auto transformer = std::make_unique<PsiCoordinateTransformer>(geometry, psi);
+
+        owned_inlets_.push_back(std::move(inlet));
+        owned_shears_.push_back(std::move(shear));
+        owned_veers_.push_back(std::move(veer));
+        owned_transformers_.push_back(std::move(transformer));
+
+        return std::make_unique<FlowCalculator>(
+            geometry,
+            rot_rate,
+            psi,
+            owned_inlets_.back().get(),
+            owned_shears_.back().get(),
+            owned_veers_.back().get(),
+            owned_transformers_.back().get());
+    }
+
+    /**
+     * @brief Build a FlowCalculator from inflow sampled in advance.
+     *
+     * Time-loop variant of BuildTurbSim(): the velocities come from a
+     * TurbSimSamplingPlan gather instead of one field query per section.
+     * Also used with AzimuthInflowCache rows, which hold the shear- and
+     * veer-modified uniform inflow of Build().
+     *
+     * @param velocities    Global-frame inflow per section (num_sections values).
+     * @param hub_velocity  Mean hub-height speed of the field [m/s].
+     */
+    std::unique_ptr<FlowCalculator> BuildSampled(
+        TurbineGeometry const *geometry,
+        double rot_rate,
+        double psi,
+        std::vector<WVPMUtilities::Vec3D<double>> velocities,
+        double hub_velocity)
+    {
+        if (velocities.size() != geometry->num_sections())
+            throw std::invalid_argument("FlowCalculatorFactory: one sampled velocity per section required");
+
+        auto inlet = std::make_unique<SampledInletProvider>(std::move(velocities), hub_velocity);
+        // Not applied (profile already in the samples), but required non-null.
+        auto shear = MakeNoShear();
+        auto veer = std::make_unique<NoVeer>();
         auto transformer = std::make_unique<PsiCoordinateTransformer>(geometry, psi);
 
         owned_inlets_.push_back(std::move(inlet));
@@ -148,6 +153,43 @@ public:
             owned_transformers_.back().get());
     }
 
+    /**
+     * @brief Shear model selected by fm.shear (no shear when disabled).
+     * @throws std::invalid_argument on an unknown shear mode.
+     */
+    static std::unique_ptr<IShearModel> MakeShear(FlowModifiers const &fm)
+    {
+        if (!fm.shear.first)
+            return MakeNoShear();
+
+        switch (fm.shear.second)
+        {
+        case 1:
+            return std::make_unique<LogShearModel>(
+                fm.surface_roughness,
+                fm.ref_vel, fm.ref_height, fm.use_ref_hv);
+        case 2:
+            return std::make_unique<PowerLawShearModel>(
+                fm.shear_exponent,
+                fm.ref_vel, fm.ref_height, fm.use_ref_hv);
+        case 3:
+            return std::make_unique<DiabaticShearModel>(
+                fm.surface_roughness, fm.obukhov_length);
+        default:
+            throw std::invalid_argument(
+                "FlowCalculatorFactory: unknown shear mode " + std::to_string(fm.shear.second));
+        }
+    }
+
+    /// Veer model selected by fm.veer (identity when disabled).
+    static std::unique_ptr<IVeerModel> MakeVeer(TurbineGeometry const *geometry,
+                                                FlowModifiers const &fm)
+    {
+        if (!fm.veer.first)
+            return std::make_unique<NoVeer>();
+        return std::make_unique<LinearVeerModel>(fm.veer.second, geometry->RotorRadius());
+    }
+
 private:
     // Factory owns all objects it creates; FlowCalculator borrows raw ptrs.
     std::vector<std::unique_ptr<IInletVelocityProvider>> owned_inlets_;
@@ -155,12 +197,11 @@ private:
     std::vector<std::unique_ptr<IVeerModel>> owned_veers_;
     std::vector<std::unique_ptr<ICoordinateTransformer>> owned_transformers_;
 
-    // Helper: "no shear" returns v_inf at every height (identity transform).
-    static std::unique_ptr<IShearModel> MakeNoShear(double v_inf)
+    // Helper: "no shear" returns v_hub at every height (identity transform).
+    static std::unique_ptr<IShearModel> MakeNoShear()
     {
-        // A constant-velocity shear model: v(z) = v_inf always.
-        // Implemented as PowerLaw with exponent=0 → (z/z_ref)^0 = 1.
-        return std::make_unique<PowerLawShearModel>(
-            0.0, v_inf, 1.0, true); // exponent=0, ref_vel=v_inf, use_ref_hv=true
+        // A constant-velocity shear model: v(z) = v_hub always.
+        // Implemented as PowerLaw with exponent=0 → (z/z_hub)^0 = 1.
+        return std::make_unique<PowerLawShearModel>(0.0);
     }
 };
@@ -9,6 +9,17 @@
  */
 #include "IBEMSolver.h"
 
+/**
+ * @brief How much of the postprocessing chain Process() runs.
+ *
+ * FULL_LOADS includes everything ROTOR_SCALARS computes.
+ */
+enum class PostprocessDetail
+{
+    ROTOR_SCALARS, ///< cp, ct, power, thrust, torque only
+    FULL_LOADS     ///< + per-section aero, blade root moments and tip-to-root integrated loads
+};
+
 class IBEMPostprocessor
 {
 public:
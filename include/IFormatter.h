@@ -2,6 +2,7 @@
 #define IFORMATTER_H
 
 #include "DataFormat.h"
+#include "IOutputTarget.h"
 #include <string>
 
 /**
@@ -21,6 +22,20 @@ public:
      * @return Formatted string ready to write
      */
     virtual std::string format(const DataFormat &data) const = 0;
+
+    /**
+     * @brief Format the data directly into an output target
+     *
+     * The default formats into a string and writes it in one piece;
+     * formatters override this to stream large files in chunks.
+     * @param data The data format to convert
+     * @param target Destination of the formatted content
+     * @return true if the content was written
+     */
+    virtual bool formatTo(const DataFormat &data, IOutputTarget &target) const
+    {
+        return target.write(format(data));
+    }
 };
 
 #endif // IFORMATTER_H
\ No newline at end of file
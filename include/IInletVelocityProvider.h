@@ -40,4 +40,13 @@ public:
      * @brief Hub-height reference velocity [m/s] for shear normalisation.
      */
     virtual double HubVelocity() const = 0;
+
+    /**
+     * @brief True if VelocityAt() already contains the vertical wind profile.
+     *
+     * A measured or synthetic wind field (TurbSim) carries its own shear and
+     * veer; FlowCalculator then uses the velocities as they are instead of
+     * replacing the axial component with the shear model.
+     */
+    virtual bool IncludesAtmosphericProfile() const { return false; }
 };
@@ -9,12 +9,20 @@
  *
  * ── Methods ──────────────────────────────────────────────────────────────────
  *  ExportBladeNoise        – single operating point (one BladeNoiseResult).
- *  ExportPowerCurveNoise   – full power curve (one BladeNoiseResult per vinf),
+ *  ExportPowerCurveNoise   – full power curve (section spectra per vinf),
  *                            written as one Tecplot zone per operating point,
  *                            rows = blade sections.
+ *  ExportRotorNoise        – rotor levels per source, rows = operating points.
+ *  ExportNoiseMap          – rotor levels on an observer grid, one ordered
+ *                            zone per operating point.
+ *  ExportAzimuthNoise      – rotor levels per blade azimuth, one zone per
+ *                            operating point.
  */
 #include "SectionNoiseResult.h"
 #include "RotorNoiseResult.h"
+#include "NoiseMapResult.h"
+#include "AzimuthNoiseResult.h"
+#include "INoiseSpectra.h"
 #include <string>
 #include <vector>
 
@@ -34,12 +42,13 @@ public:
      * Output layout: one zone per operating point (named by v_inf),
      * rows = blade sections, columns = per-section noise quantities.
      *
-     * @param results      One BladeNoiseResult per wind speed, ordered by vinf.
+     * @param spectra      Section spectra, one point per wind speed, ordered
+     *                     by vinf (BladeNoiseSpectra or NoiseSpectrumStore).
      * @param output_path  File path to write.
      */
     virtual bool ExportPowerCurveNoise(
-        std::vector<BladeNoiseResult> const &results,
-        std::string                   const &output_path) const = 0;
+        INoiseSpectra const &spectra,
+        std::string   const &output_path) const = 0;
 
     /**
      * @brief Export aggregated rotor noise for all power curve operating points.
@@ -55,4 +64,32 @@ public:
     virtual bool ExportRotorNoise(
         std::vector<RotorNoiseResult> const &results,
         std::string                   const &output_path) const = 0;
+
+    /**
+     * @brief Export rotor noise maps for all power curve operating points.
+     *
+     * Output layout: one ordered zone per operating point (I = x, J = y).
+     * Columns: x [m], y [m], OASPL [dB], OASPL_A [dB(A)].
+     *
+     * @param results      One NoiseMapResult per wind speed (from NoiseMapPropagator).
+     * @param output_path  File path to write.
+     */
+    virtual bool ExportNoiseMap(
+        std::vector<NoiseMapResult> const &results,
+        std::string                 const &output_path) const = 0;
+
+    /**
+     * @brief Export azimuth-resolved rotor noise for all power curve points.
+     *
+     * Output layout: one zone per operating point, rows = blade-1 azimuth.
+     * Columns: psi [deg], t [s], blade OASPL / OASPL_A / LWA,
+     *          rotor OASPL / OASPL_A / LWA.  The zone title carries the
+     *          rotor OASPL_A modulation depth.
+     *
+     * @param results      One AzimuthNoiseResult per wind speed (from AzimuthNoiseResolver).
+     * @param output_path  File path to write.
+     */
+    virtual bool ExportAzimuthNoise(
+        std::vector<AzimuthNoiseResult> const &results,
+        std::string                     const &output_path) const = 0;
 };
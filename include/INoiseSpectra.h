@@ -0,0 +1,92 @@
+#pragma once
+/**
+ * @file INoiseSpectra.h
+ * @brief Read-only view of section noise spectra over operating points.
+ *
+ * Rotor aggregation, the noise map sources and the power-curve exporter
+ * read section spectra through this interface only, so they work the same
+ * on the double-precision BladeNoiseResult vectors (BladeNoiseSpectra) and
+ * on the compact float32 NoiseSpectrumStore.
+ *
+ * SOLID:
+ *  I – the few accessors the noise post-processing needs, nothing else.
+ *  D – consumers depend on the view, not on how the spectra are stored.
+ */
+#include "SectionNoiseResult.h"
+#include <cstddef>
+#include <iterator>
+#include <span>
+#include <vector>
+
+/// Noise sources in SectionNoiseResult order.
+enum class NoiseSource : std::size_t
+{
+    TblPressureSide,
+    TblSuctionSide,
+    Separation,
+    LaminarVortex,
+    Bluntness,
+    TurbulentInflow,
+    Total,
+};
+
+/// SectionNoiseResult member of each NoiseSource, indexed by the enum value.
+inline constexpr SectionNoiseSpectrum SectionNoiseResult::*kNoiseSourceSpectra[] = {
+    &SectionNoiseResult::tbl_pressure_side,
+    &SectionNoiseResult::tbl_suction_side,
+    &SectionNoiseResult::separation,
+    &SectionNoiseResult::laminar_vortex,
+    &SectionNoiseResult::bluntness,
+    &SectionNoiseResult::turbulent_inflow,
+    &SectionNoiseResult::total,
+};
+
+/// Flow and observer data of one section at one operating point.
+struct NoiseSectionInfo
+{
+    std::size_t section_index{0};
+    double radius{0.0};             ///< [m]
+    double chord{0.0};              ///< [m]
+    double span{0.0};               ///< [m]
+    double velocity{0.0};           ///< [m/s]
+    double reynolds{0.0};           ///< [-]
+    double mach{0.0};               ///< [-]
+    double alpha_deg{0.0};          ///< [deg]
+    double observer_distance{0.0};  ///< [m]
+    double observer_theta{90.0};    ///< [deg] from chord line
+    double observer_phi{90.0};      ///< [deg] from span line
+    bool   converged{false};
+};
+
+class INoiseSpectra
+{
+public:
+    static constexpr std::size_t N_SOURCES = std::size(kNoiseSourceSpectra);
+
+    virtual ~INoiseSpectra() = default;
+
+    virtual std::size_t points() const = 0;
+    /// Sections of operating point @p point.
+    virtual std::size_t sections(std::size_t point) const = 0;
+    /// 1/3-octave band centres [Hz]; empty if no section converged.
+    virtual std::vector<double> const &frequencies() const = 0;
+    std::size_t bands() const { return frequencies().size(); }
+
+    /// Wind speed of operating point @p point [m/s].
+    virtual double vinf(std::size_t point) const = 0;
+
+    virtual NoiseSectionInfo section(std::size_t point, std::size_t sec) const = 0;
+
+    /// Overall SPL [dB] of one source.
+    virtual double oaspl(std::size_t point, std::size_t sec,
+                         NoiseSource src) const = 0;
+
+    /// See SectionNoiseSpectrum::directivity_crossover_hz.
+    virtual double crossover_hz(std::size_t point, std::size_t sec,
+                                NoiseSource src) const = 0;
+
+    /// SPL per band [dB] of one source into @p out (bands() values); bands
+    /// the section has no level for read as switched off (−100 dB).
+    virtual void spectrum(std::size_t point, std::size_t sec, NoiseSource src,
+                          std::span<double> out) const = 0;
+};
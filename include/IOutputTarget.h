@@ -2,6 +2,7 @@
 #define IOUTPUTTARGET_H
 
 #include <string>
+#include <string_view>
 
 /**
  * @brief Interface for output targets (files, streams, etc.)
@@ -26,6 +27,28 @@ public:
      * @return true if target is valid and ready
      */
     virtual bool isReady() const = 0;
+
+    /**
+     * @brief Start a streamed write: begin(), append() per chunk, finish()
+     *
+     * Lets a formatter hand over its output in pieces instead of building
+     * the whole content in memory first.
+     * @return false if the target does not support streaming (the default);
+     *         the caller then falls back to write()
+     */
+    virtual bool begin() { return false; }
+
+    /**
+     * @brief Write the next chunk of a streamed write
+     * @return true if the chunk was written
+     */
+    virtual bool append(std::string_view /*chunk*/) { return false; }
+
+    /**
+     * @brief Complete a streamed write
+     * @return true if every chunk reached the target
+     */
+    virtual bool finish() { return false; }
 };
 
 #endif // IOUTPUTTARGET_H
\ No newline at end of file
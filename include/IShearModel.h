@@ -7,11 +7,12 @@
  * are all independent implementations.  Adding a new shear model (e.g.
  * WRF-profile) means creating a new class — no existing code changes.
  *
- * Interface Segregation: callers only ever need VelocityAt().
- * The FlowCalculator does not care which model is active; it calls the
- * interface.
+ * Interface Segregation: callers only ever need VelocityAt() (or its batched
+ * form VelocitiesAt()).  The FlowCalculator does not care which model is
+ * active; it calls the interface.
  */
 #include <cstddef>
+#include <span>
 #include "MathUtilities.h" // WVPMUtilities::Vec3D<double>
 
 /**
@@ -40,4 +41,28 @@ public:
      * @return    Axial free-stream velocity at the blade section height.
      */
     virtual double VelocityAt(ShearInput const &in) const = 0;
+
+    /**
+     * @brief Axial velocity [m/s] at many heights for one hub state.
+     *
+     * Same values as VelocityAt() per height.  Models override this to
+     * evaluate the height-independent part of the profile once.
+     *
+     * @param heights     Section heights above ground [m].
+     * @param hub_height  Rotor hub height [m].
+     * @param v_hub       Hub-height free-stream velocity [m/s].
+     * @param out         Output, one velocity per height.
+     */
+    virtual void VelocitiesAt(std::span<double const> heights,
+                              double hub_height,
+                              double v_hub,
+                              std::span<double> out) const
+    {
+        ShearInput in{0.0, hub_height, v_hub};
+        for (std::size_t i = 0; i < heights.size(); ++i)
+        {
+            in.height = heights[i];
+            out[i] = VelocityAt(in);
+        }
+    }
 };
@@ -38,4 +38,39 @@ public:
         std::size_t raw_ts,
         TurbSimGrid const &grid,
         TurbSimVelocityData const &velocity) const = 0;
+
+    /**
+     * @brief Interpolate velocities at many (y, z) points of one timestep.
+     *
+     * Structure-of-arrays in and out so a whole rotor (all sections of all
+     * blades) is one call.  The default forwards to Interpolate() per point;
+     * implementations override it when they can do better.
+     *
+     * @param y, z      Query coordinates, @p count values each.
+     * @param count     Number of query points.
+     * @param raw_ts    Raw (padded) timestep index into the velocity data.
+     * @param grid      Grid geometry providing axis breakpoints.
+     * @param velocity  Velocity data storage.
+     * @param u, v, w   Output velocity components, @p count values each [m/s].
+     */
+    virtual void InterpolateBatch(
+        double const *y,
+        double const *z,
+        std::size_t count,
+        std::size_t raw_ts,
+        TurbSimGrid const &grid,
+        TurbSimVelocityData const &velocity,
+        double *u,
+        double *v,
+        double *w) const
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            WVPMUtilities::Vec3D<double> const vel = Interpolate(
+                WVPMUtilities::Vec3D<double>(0.0, y[i], z[i]), raw_ts, grid, velocity);
+            u[i] = vel.x();
+            v[i] = vel.y();
+            w[i] = vel.z();
+        }
+    }
 };
@@ -9,6 +9,8 @@
  * Open/Closed: alternative veer models (e.g. height-power-law veer)
  * can be plugged in without touching FlowCalculator.
  */
+#include <cstddef>
+#include <span>
 #include "MathUtilities.h" // WVPMUtilities::Vec3D<double>
 
 /**
@@ -41,4 +43,26 @@ public:
     virtual WVPMUtilities::Vec3D<double> Apply(
         WVPMUtilities::Vec3D<double> const &vel,
         VeerInput const &in) const = 0;
+
+    /**
+     * @brief Apply veer rotation to many velocity vectors in place.
+     *
+     * Same result as Apply() per vector; models override this to skip the
+     * per-call setup.
+     *
+     * @param heights     Section heights above ground [m].
+     * @param hub_height  Rotor hub height [m].
+     * @param vels        Global-frame velocities [m/s], one per height.
+     */
+    virtual void ApplyAt(std::span<double const> heights,
+                         double hub_height,
+                         std::span<WVPMUtilities::Vec3D<double>> vels) const
+    {
+        VeerInput in{0.0, hub_height};
+        for (std::size_t i = 0; i < heights.size(); ++i)
+        {
+            in.height = heights[i];
+            vels[i] = Apply(vels[i], in);
+        }
+    }
 };
@@ -8,6 +8,7 @@
  * never modifies FlowCalculator.
  */
 #include <stdexcept>
+#include <vector>
 #include "IInletVelocityProvider.h"
 #include "TurbSimManager.h" // TurbSimManager — existing type, unchanged
 
@@ -69,7 +70,47 @@ public:
         return tsm_->hub_velocity();
     }
 
+    /// The TurbSim field already holds shear, veer and turbulence.
+    bool IncludesAtmosphericProfile() const override { return true; }
+
 private:
     TurbSimManager const *tsm_;
     unsigned iteration_;
 };
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Pre-sampled inlet — one velocity per section, already taken from a wind
+// field at this blade's positions (TurbSimSamplingPlan in the time loop) or
+// from a cached atmospheric profile (AzimuthInflowCache).
+// ─────────────────────────────────────────────────────────────────────────────
+class SampledInletProvider final : public IInletVelocityProvider
+{
+public:
+    /**
+     * @param velocities    Global-frame inflow per section.
+     * @param hub_velocity  Mean hub-height speed of the source field [m/s].
+     */
+    SampledInletProvider(std::vector<WVPMUtilities::Vec3D<double>> velocities,
+                         double hub_velocity)
+        : velocities_(std::move(velocities)), hub_velocity_(hub_velocity)
+    {
+    }
+
+    WVPMUtilities::Vec3D<double> VelocityAt(
+        WVPMUtilities::Vec3D<double> const & /*position*/,
+        std::size_t section_index) const override
+    {
+        if (section_index >= velocities_.size())
+            throw std::out_of_range("SampledInletProvider: section index out of range");
+        return velocities_[section_index];
+    }
+
+    double HubVelocity() const override { return hub_velocity_; }
+
+    /// The samples hold the profile already (TurbSim field or AzimuthInflowCache).
+    bool IncludesAtmosphericProfile() const override { return true; }
+
+private:
+    std::vector<WVPMUtilities::Vec3D<double>> velocities_;
+    double hub_velocity_;
+};
@@ -47,6 +47,18 @@ public:
     bool Solve() override;
     SolverResult const &Result() const override { return result_; }
 
+    // ── Staged solve ─────────────────────────────────────────────────────────
+    // Solve() == BeginSolve(); SolveSection(s) for every s; EndSolve().
+    // Callers that run several solvers at once (one per blade in the time
+    // domain) use the stages to put all (solver, section) pairs into a
+    // single parallel loop.  SolveSection() calls for different sections
+    // may run concurrently.
+    void BeginSolve();
+    void SolveSection(std::size_t sec);
+    bool EndSolve();
+
+    std::size_t num_sections() const { return num_sections_; }
+
     // ── Read-only accessors (used by PostProcess / output) ───────────────────
     double v_inf() const;
     double lambda() const;
@@ -80,6 +92,7 @@ private:
     void FinaliseResult();
 
     // Per-section search
+    bool FindSolutionNearStart(std::size_t sec);
     bool FindSolutionPositiveRegion(std::size_t sec);
     bool FindSolutionNegativeRegion(std::size_t sec);
 
@@ -53,6 +53,8 @@ public:
      * @param pitch           Collective pitch [rad].
      * @param psi             Rotor azimuth [rad].
      * @param verbose         Log operating point on each Solve() call.
+     * @param phi_start       Optional warm-start flow angles per section [rad]
+     *                        (see SolverConfig::phi_start).  Must outlive the solver.
      */
     std::unique_ptr<NingSolver> Build(
         TurbineGeometry const *turbine,
@@ -60,7 +62,8 @@ public:
         FlowCalculator const *flow_calculator,
         double pitch,
         double psi,
-        bool verbose = false)
+        bool verbose = false,
+        std::vector<double> const *phi_start = nullptr)
     {
         auto tip = std::make_unique<PrandtlTipLoss>();
         auto hub = std::make_unique<PrandtlHubLoss>();
@@ -86,6 +89,7 @@ public:
         cfg.pitch = pitch;
         cfg.psi = psi;
         cfg.verbose = verbose;
+        cfg.phi_start = phi_start;
 
         return std::make_unique<NingSolver>(std::move(cfg));
     }
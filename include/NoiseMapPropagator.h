@@ -0,0 +1,82 @@
+#pragma once
+/**
+ * @file NoiseMapPropagator.h
+ * @brief Propagates directivity-free rotor noise sources to many observers.
+ *
+ * The expensive part of the noise chain (boundary layers and BPM spectra)
+ * runs once per operating point for a reference observer; SectionNoiseSource
+ * strips that observer again.  This class then evaluates arbitrary observer
+ * positions from the source spectra:
+ *
+ *   p²(f) = B / N_ψ · Σ_ψ Σ_sections [ D_l·p_low(f) + D_h·p_high(f) ] / r²
+ *
+ * with the BPM directivities D_l / D_h and the distance r of each section at
+ * each of N_ψ blade azimuth positions (time average over one revolution of
+ * B blades).  A-weighting is applied per band before the overall sums.
+ *
+ * Geometry (origin at the tower base, x downwind along the rotor axis,
+ * z up):  hub at (-overhang, 0, hub_height); a blade at azimuth ψ points
+ * along e_r = (0, sin ψ, cos ψ) and moves along e_t = (0, cos ψ, -sin ψ).
+ * The section chord is taken along -e_t (twist and inflow angle neglected),
+ * so the section normal is the rotor axis.
+ *
+ * SOLID:
+ *   S – propagation only; source spectra come from SectionNoiseSourceBuilder.
+ *   D – depends only on RotorNoiseSource / NoiseMapResult value types.
+ */
+#include "NoiseMapResult.h"
+#include "SectionNoiseSource.h"
+#include <vector>
+
+/// Horizontal observer grid.
+struct NoiseMapGrid
+{
+    std::vector<double> x;        ///< Downwind positions [m]
+    std::vector<double> y;        ///< Lateral positions [m]
+    double              z{0.0};   ///< Observer height [m] (0 = ground, IEC 61400-11)
+
+    /// Grid from inclusive (start, end, step) ranges.
+    /// @throws std::invalid_argument if a step is not > 0.
+    static NoiseMapGrid FromRanges(double x_start, double x_end, double x_step,
+                                   double y_start, double y_end, double y_step,
+                                   double z = 0.0);
+};
+
+class NoiseMapPropagator
+{
+public:
+    /**
+     * @param n_blades    Number of rotor blades.
+     * @param hub_height  Hub centre height above ground [m].
+     * @param overhang    Rotor overhang upwind of the tower axis [m].
+     * @param n_azimuth   Blade positions averaged over one revolution.
+     * @throws std::invalid_argument for n_blades < 1 or n_azimuth < 1.
+     */
+    NoiseMapPropagator(int    n_blades,
+                       double hub_height,
+                       double overhang,
+                       int    n_azimuth = 36);
+
+    /// Overall SPL / SPL_A at every grid observer (OpenMP-parallel).
+    NoiseMapResult Propagate(RotorNoiseSource const &source,
+                             NoiseMapGrid     const &grid) const;
+
+    /// SPL spectrum [dB] at a single observer position.
+    std::vector<double> Spectrum(RotorNoiseSource const &source,
+                                 double x, double y, double z) const;
+
+private:
+    int    n_blades_;
+    double hub_height_;
+    double overhang_;
+    int    n_azimuth_;
+
+    /// Blade azimuth trigonometry, sin ψ / cos ψ per position.
+    std::vector<double> sin_psi_;
+    std::vector<double> cos_psi_;
+
+    /// Add the rotor mean-square pressure per band at (x, y, z) to @p p.
+    void Accumulate(RotorNoiseSource const &source,
+                    double x, double y, double z,
+                    double *p) const;
+};
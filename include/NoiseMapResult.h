@@ -0,0 +1,29 @@
+#pragma once
+/**
+ * @file NoiseMapResult.h
+ * @brief Rotor noise levels on a horizontal grid of observers for one
+ *        operating point.
+ *
+ * Produced by NoiseMapPropagator, written by INoiseResultsExporter as one
+ * ordered (I = x, J = y) Tecplot zone per operating point.
+ *
+ * SOLID:
+ *   S – pure data carrier; no I/O or computation.
+ */
+#include <cstddef>
+#include <vector>
+
+struct NoiseMapResult
+{
+    double vinf{0.0};          ///< Wind speed [m/s]
+    double observer_height{0.0}; ///< Height of the observer plane above ground [m]
+
+    std::vector<double> x;     ///< Grid lines downwind of the tower [m] (I)
+    std::vector<double> y;     ///< Grid lines across the rotor axis [m] (J)
+
+    /// Rotor levels per observer, index j * x.size() + i.
+    std::vector<double> oaspl;   ///< Overall SPL [dB]
+    std::vector<double> oasplA;  ///< Overall A-weighted SPL [dB(A)]
+
+    std::size_t size() const { return x.size() * y.size(); }
+};
@@ -0,0 +1,108 @@
+#pragma once
+/**
+ * @file NoiseSpectrumStore.h
+ * @brief Compact columnar store of section noise spectra for many
+ *        operating points.
+ *
+ * BladeNoiseResult keeps seven std::vector<double> spectra per section, so a
+ * power curve is thousands of small heap blocks.  This store packs all SPL
+ * values of all operating points into one contiguous float32 array
+ *
+ *   spl[((point · n_sections + section) · N_SOURCES + source) · n_bands + band]
+ *
+ * next to a parallel float32 OASPL block, the directivity crossovers and
+ * one small record of flow data per (point, section).  The noise tasks write
+ * each section here as soon as it is computed (see BladeNoiseJob::store), so
+ * the double spectra never exist for more than the sections in flight.
+ *
+ * float32 keeps ~7 significant digits, i.e. better than 1e-4 dB at the
+ * levels involved — well below what the exporters print.
+ *
+ * SOLID:
+ *   S – storage only; aggregation stays in RotorNoiseAggregator,
+ *       formatting in the exporters.
+ *   L – read through INoiseSpectra like BladeNoiseSpectra.
+ */
+#include "INoiseSpectra.h"
+#include <cstddef>
+#include <span>
+#include <vector>
+
+class NoiseSpectrumStore final : public INoiseSpectra
+{
+public:
+    NoiseSpectrumStore() = default;
+
+    /// Empty store; every SPL / OASPL starts at −100 dB (inactive).
+    NoiseSpectrumStore(std::size_t n_points,
+                       std::size_t n_sections,
+                       std::vector<double> frequencies);
+
+    // ── Writing (thread-safe for distinct (point, section) slots) ────────────
+
+    /// Start operating point @p point from a prepared (not yet computed)
+    /// result: wind speed, section count and flow data.  Spectra stay
+    /// inactive until Assign().
+    void BeginPoint(std::size_t point, BladeNoiseResult const &layout);
+
+    /// Flow data and spectra of one computed section.
+    void Assign(std::size_t point, std::size_t sec, SectionNoiseResult const &result);
+
+    /// Flow data of one section; spectra unchanged.
+    void AssignInfo(std::size_t point, std::size_t sec, SectionNoiseResult const &result);
+
+    /// Copy the spectra of section @p sec from point @p from to point @p to.
+    void CopySpectra(std::size_t from, std::size_t to, std::size_t sec);
+
+    // ── INoiseSpectra ────────────────────────────────────────────────────────
+    std::size_t points() const override { return n_points_; }
+    std::size_t sections(std::size_t point) const override { return counts_[point]; }
+    std::vector<double> const &frequencies() const override { return frequencies_; }
+
+    double vinf(std::size_t point) const override { return vinf_[point]; }
+
+    NoiseSectionInfo section(std::size_t point, std::size_t sec) const override
+    {
+        return info_[point * n_sections_ + sec];
+    }
+
+    double oaspl(std::size_t point, std::size_t sec, NoiseSource src) const override
+    {
+        return oaspl_[Slot(point, sec, src)];
+    }
+
+    double crossover_hz(std::size_t point, std::size_t sec, NoiseSource src) const override
+    {
+        return crossover_[Slot(point, sec, src)];
+    }
+
+    void spectrum(std::size_t point, std::size_t sec, NoiseSource src,
+                  std::span<double> out) const override;
+
+    // ── Dimensions ────────────────────────────────────────────────────────────
+    /// Section capacity per point.
+    std::size_t max_sections() const { return n_sections_; }
+
+    /// Bytes held by the store.
+    std::size_t memory_bytes() const;
+
+private:
+    std::size_t n_points_{0};
+    std::size_t n_sections_{0};
+    std::vector<double> frequencies_;
+
+    std::vector<double>           vinf_;       ///< [point]
+    std::vector<std::size_t>      counts_;     ///< [point] sections
+    std::vector<NoiseSectionInfo> info_;       ///< [point][section]
+    std::vector<float>            oaspl_;      ///< [point][section][source]
+    std::vector<double>           crossover_;  ///< [point][section][source]
+    std::vector<float>            spl_;        ///< [point][section][source][band]
+
+    std::size_t Slot(std::size_t point, std::size_t sec, NoiseSource src) const
+    {
+        return (point * n_sections_ + sec) * N_SOURCES
+             + static_cast<std::size_t>(src);
+    }
+
+    void CheckSlot(std::size_t point, std::size_t sec) const;
+};
@@ -9,8 +9,10 @@
 #include <functional>
 #include <vector>
 #include <iostream>
+#include "CheckpointJournal.h"
 #include "ITurbineController.h"
 #include "ISimulationConfig.h"
+#include "IBEMPostprocessor.h"
 
 class TurbineGeometry;
 class VariableSpeedController;
@@ -34,9 +36,15 @@ struct PowerCurvePoint
 };
 
 /// Callback invoked for each (vinf, lambda, pitch) triple. Returns {cp, ct}.
+///
+/// OperationSolver requests ROTOR_SCALARS while iterating and exactly one
+/// FULL_LOADS call per wind speed, repeating the (vinf, lambda, pitch) triple
+/// whose (cp, ct) ended up in the PowerCurvePoint.  Callers that store
+/// detailed results should do so only on the FULL_LOADS call.
 using BEMCallback = std::function<std::pair<double, double>(double vinf,
                                                             double lambda,
-                                                            double pitch_deg)>;
+                                                            double pitch_deg,
+                                                            PostprocessDetail detail)>;
 
 // ─────────────────────────────────────────────────────────────────────────────
 
@@ -63,14 +71,27 @@ public:
                     BEMCallback bem_callback);
 
     /// Run the power-curve loop for one pitch setting and all wind speeds.
+    ///
+    /// With a journal, each converged wind speed is journaled; a resumed run
+    /// skips the iteration of journaled wind speeds and only repeats their
+    /// FULL_LOADS callback, so callers collect the same detailed results.
+    /// Completing the journal is left to the caller.
     std::vector<PowerCurvePoint> Run(double pitch_deg,
-                                     std::vector<double> const &vinf_vec);
+                                     std::vector<double> const &vinf_vec,
+                                     CheckpointJournal *journal = nullptr);
 
 private:
     OperationSolverParams p_;
     ITurbineController const *controller_;
     BEMCallback bem_;
 
+    /// (lambda, pitch) of the most recent FULL_LOADS callback.
+    double full_loads_lambda_{0.0};
+    double full_loads_pitch_{0.0};
+
+    /// Issue the FULL_LOADS callback of a wind speed and remember its triple.
+    void FullLoads(double vinf, double lambda, double pitch_deg);
+
     /// Inner convergence loop for a single wind speed.
     /// Updates vtip_inout as a warm-start for the next wind speed.
     PowerCurvePoint ConvergeOnePoint(double vinf,
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "BuildIdentity.h"
+#include "Configuration.h"
+#include "ConfigurationSchema.h"
+#include "BladeInterpolator.h"
+#include "TextFileScanner.h"
+
+/**
+ * @brief Versioned binary snapshot of a parsed and interpolated project
+ *
+ * ProjectSnapshot stores everything the parse-and-build phase produces in one
+ * binary file: the resolved configuration values, the blade geometry, the
+ * airfoil file lists, the loaded airfoil geometries and polars, the turbine
+ * controller settings and the interpolated blade sections (section geometry,
+ * compiled per-section AirfoilPolarData and scaled airfoil coordinates).
+ * A later run on an unchanged case maps the file once, restores the
+ * Configuration and builds BladeInterpolator objects directly from the stored
+ * sections instead of re-running the polar interpolation.
+ *
+ * ## Key Features
+ * - **Versioned**: Magic, format version and byte-order mark in the header
+ * - **Build Check**: The identity of the build that wrote it (kBuildIdentity);
+ *   a snapshot written by other code is not reused
+ * - **Checksummed**: FNV-1a 64 over the payload; corrupt files are rejected
+ * - **Input Fingerprints**: Size and modification time of the project file and
+ *   of every data file it references; any change invalidates the snapshot
+ * - **Schema Check**: A hash of the configuration schema, so a snapshot from a
+ *   build with different parameters is not reused
+ * - **Single Mapping**: The file is memory-mapped once and decoded in place
+ *
+ * ## File Layout
+ * - Header: magic "SOLIDSNP", version, byte-order mark, build identity,
+ *   payload size, checksum
+ * - Payload: schema hash, input fingerprints, values, blade geometry, file
+ *   lists, controller settings, airfoil collections, interpolated sections
+ *
+ * @note Values are stored in native byte order; a snapshot written on a
+ *       machine with the other byte order is rejected, not converted.
+ *
+ * @example
+ * ```cpp
+ * std::string reason;
+ * const auto id = ProjectSnapshot::schemaId(schema);
+ * auto snapshot = ProjectSnapshot::load(path, "ProjectData.dat", id, reason);
+ * if (snapshot) {
+ *     Configuration config = snapshot->takeConfiguration();
+ *     auto blade = snapshot->createBladeInterpolator();
+ * }
+ * ```
+ */
+class ProjectSnapshot {
+
+public:
+
+    /// Incremented whenever the payload layout changes
+    static constexpr std::uint32_t FORMAT_VERSION = 2;
+
+    /**
+     * @brief Default snapshot location for a project file ("<project>.snap")
+     * @param projectFile Path of the project data file
+     */
+    static std::string defaultPath(const std::string& projectFile);
+
+    /**
+     * @brief Identifies a schema by its parameter names, required flags and output keys
+     *
+     * Taken before the schema is handed to ConfigurationParser.
+     */
+    static std::uint64_t schemaId(const ConfigurationSchema& schema);
+
+    /**
+     * @brief Identifies the inputs of a parsed project
+     *
+     * Hash of the size and modification time of the project file and of every
+     * data file it references — the fingerprints a snapshot is validated
+     * with.  Used to key run checkpoints.
+     */
+    static std::uint64_t inputsId(const std::string& projectFile, const Configuration& config);
+
+    /**
+     * @brief Writes a snapshot of a parsed project
+     *
+     * The file is written to a temporary name and renamed, so an interrupted
+     * write never leaves a truncated snapshot behind.
+     *
+     * @param snapshotPath Output file
+     * @param projectFile Project data file the configuration was parsed from
+     * @param schemaId schemaId() of the schema used for parsing
+     * @param config Parsed configuration
+     * @param blade Blade interpolated from @p config
+     * @param buildId Identity of the code that produced @p blade
+     * @throws std::runtime_error if a value has an unsupported type or the file cannot be written
+     */
+    static void write(const std::string& snapshotPath, const std::string& projectFile,
+                      std::uint64_t schemaId, const Configuration& config,
+                      const BladeInterpolator& blade,
+                      std::string_view buildId = kBuildIdentity);
+
+    /**
+     * @brief Maps and validates a snapshot
+     * @param snapshotPath Snapshot file
+     * @param projectFile Project data file the caller is about to run
+     * @param schemaId schemaId() of the schema the caller would parse with
+     * @param reason Receives why the snapshot was not used (empty if the file does not exist)
+     * @param buildId Identity the snapshot must have been written with
+     * @return Snapshot, or nullptr if missing, corrupt, outdated, from another
+     *         build or for another input
+     */
+    static std::unique_ptr<ProjectSnapshot> load(const std::string& snapshotPath,
+                                                 const std::string& projectFile,
+                                                 std::uint64_t schemaId,
+                                                 std::string& reason,
+                                                 std::string_view buildId = kBuildIdentity);
+
+    /**
+     * @brief Moves the restored configuration out of the snapshot
+     */
+    Configuration takeConfiguration();
+
+    /**
+     * @brief Builds a blade from the stored interpolated sections
+     *
+     * Each call decodes an independent copy from the mapping, the analogue of
+     * Configuration::createBladeInterpolator().
+     */
+    std::unique_ptr<BladeInterpolator> createBladeInterpolator() const;
+
+    /**
+     * @brief Size of the snapshot file [bytes]
+     */
+    std::size_t sizeBytes() const { return file.text().size(); }
+
+private:
+
+    explicit ProjectSnapshot(MappedTextFile mapped);
+
+    MappedTextFile file;
+    Configuration config;
+
+    /// Offset of the interpolated section block in the mapping
+    std::size_t sectionsOffset = 0;
+};
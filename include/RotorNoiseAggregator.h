@@ -24,10 +24,12 @@
  * SOLID:
  *   S – only computes aggregated noise; no I/O.
  *   O – extend by sub-classing or replacing for different propagation models.
- *   D – depends only on BladeNoiseResult / RotorNoiseResult value types.
+ *   D – reads section spectra through INoiseSpectra only.
  */
 #include "SectionNoiseResult.h"
 #include "RotorNoiseResult.h"
+#include "INoiseSpectra.h"
+#include <cstddef>
 #include <vector>
 
 class RotorNoiseAggregator
@@ -54,9 +56,20 @@ public:
      */
     RotorNoiseResult Aggregate(BladeNoiseResult const &blade_result) const;
 
+    /**
+     * @brief Aggregate operating point @p point of any spectra backing
+     *        (BladeNoiseSpectra, NoiseSpectrumStore).
+     * @throws std::invalid_argument if @p point is out of range.
+     */
+    RotorNoiseResult Aggregate(INoiseSpectra const &spectra,
+                               std::size_t          point) const;
+
     /// Observer slant distance computed from constructor geometry [m].
     double ObserverDistance() const { return observer_distance_; }
 
+    /// Rotor blade count used for LWA scaling.
+    int NumBlades() const { return n_blades_; }
+
 private:
     int    n_blades_;
     double observer_distance_;  ///< Pre-computed slant distance [m]
@@ -65,7 +78,7 @@ private:
 
     /**
      * @brief Compute A-weighting correction [dB] for each frequency.
-     *  A(f) = 2 + 20·log10(RA(f))  with the standard polynomial approximation.
+     *  A(f) = 2 + 20·log10(RA(f)), see math::spectral::a_weighting.
      */
     static std::vector<double> ComputeAWeights(
         std::vector<double> const &frequencies);
@@ -83,22 +96,24 @@ private:
     static double EnergySum(std::vector<double> const &levels);
 
     /**
-     * @brief Aggregate one noise source (pointer-to-member) across all sections.
+     * @brief Aggregate one noise source across all sections of one point.
      *
      * For each frequency band: energy-sum the per-section SPL values.
      * Then derive OASPL, OASPL_A, LW, LWA.
      *
-     * @param sections   All blade sections for this operating point.
-     * @param src        Pointer-to-member selecting the noise source.
+     * @param spectra    Section spectra.
+     * @param point      Operating point in @p spectra.
+     * @param src        Noise source.
      * @param a_weights  Per-frequency A-weighting corrections [dB].
      * @param As         Geometric attenuation [dB] (negative number).
      * @param n_blades   Rotor blade count for LWA scaling.
      * @return Fully populated RotorNoiseSourceResult.
      */
     static RotorNoiseSourceResult AggregateSource(
-        std::vector<SectionNoiseResult> const &sections,
-        SectionNoiseSpectrum SectionNoiseResult::*src,
-        std::vector<double>  const &a_weights,
-        double               As,
-        int                  n_blades);
+        INoiseSpectra       const &spectra,
+        std::size_t                point,
+        NoiseSource                src,
+        std::vector<double> const &a_weights,
+        double                     As,
+        int                        n_blades);
 };
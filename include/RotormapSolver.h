@@ -18,8 +18,12 @@
  *
  * Outer loop: pitch (J-direction), inner loop: lambda (I-direction).
  * Points stored row-major: points[j * I + i].
+ *
+ * With a CheckpointJournal every solved point is journaled as it completes;
+ * a resumed Solve() takes the journaled points and solves only the rest.
  */
 #include "BEMPostprocessor.h"
+#include "CheckpointJournal.h"
 #include "FlowCalculatorFactory.h"
 #include "NingSolverFactory.h"
 #include "ISimulationConfig.h"
@@ -80,7 +84,16 @@ public:
     RotormapSolver(TurbineGeometry const   *turbine,
                    ISimulationConfig const *sim_config);
 
-    RotormapResult Solve(RotormapParams const &params) const;
+    /**
+     * @brief Solve the map.
+     *
+     * @param params   Sweep definition.
+     * @param journal  Optional checkpoint journal: restored points are reused
+     *                 (when it was written for the same sweep) and new points
+     *                 are appended.  Completing it is left to the caller.
+     */
+    RotormapResult Solve(RotormapParams const &params,
+                         CheckpointJournal *journal = nullptr) const;
 
 private:
     TurbineGeometry const   *turbine_;
@@ -20,16 +20,42 @@
 #include "ISectionNoiseConfigBuilder.h"
 #include "ISimulationConfig.h"
 #include "BEMPostprocessor.h"
+#include "NoiseSpectrumStore.h"
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <vector>
 
 class TurbineGeometry;
+class CheckpointJournal;
 
 // ─────────────────────────────────────────────────────────────────────────────
 /// Noise method selection — built once from ISimulationConfig, passed around.
 #include "NoiseConfig.h"
 
+// ─────────────────────────────────────────────────────────────────────────────
+/// One operating point split into independent section tasks.
+///
+/// Produced by SectionNoiseCalculator::Prepare().  `result.sections` is
+/// pre-sized with one slot per input, so CalculateSection() calls for
+/// different sections may run concurrently and in any order.
+///
+/// With `store` set, CalculateSection() writes each section's spectra to
+/// slot `store_point` of the store and releases them from `result`, which
+/// then keeps only flow data and convergence flags.
+///
+/// With `journal` set (see SectionNoiseCalculator::Resume()), every computed
+/// section is also appended to the journal as point `journal_point`.
+struct BladeNoiseJob
+{
+    std::vector<SectionNoiseInput> inputs;
+    BladeNoiseResult               result;
+    NoiseSpectrumStore            *store{nullptr};
+    std::size_t                    store_point{0};
+    CheckpointJournal             *journal{nullptr};
+    std::size_t                    journal_point{0};
+};
+
 // ─────────────────────────────────────────────────────────────────────────────
 class SectionNoiseCalculator
 {
@@ -66,6 +92,51 @@ public:
         std::vector<double> const         &local_mach,
         std::vector<double> const         &local_re) const;
 
+    // ── Task-level interface ─────────────────────────────────────────────────
+    // Calculate() == Prepare() + CalculateSection() for every section +
+    // Finalize().  Callers with many operating points can schedule all
+    // (point, section) pairs in one pool instead of one task per point.
+
+    /**
+     * @brief Build section inputs and pre-size the result slots.
+     *
+     * Sections without flow are marked non-converged here and need no task.
+     * Arguments are as for Calculate().
+     */
+    BladeNoiseJob Prepare(
+        BEMPostprocessResult const        &pp,
+        TurbineGeometry const             *turbine,
+        ISimulationConfig const           &sim_config,
+        double                             vinf,
+        std::vector<double> const         &local_vel,
+        std::vector<double> const         &local_mach,
+        std::vector<double> const         &local_re) const;
+
+    /// Run the noise model for section @p i of @p job (thread-safe for
+    /// distinct @p i).  Returns true if the section converged.
+    bool CalculateSection(BladeNoiseJob &job, std::size_t i) const;
+
+    /// Collect convergence statistics and the frequency axis.
+    BladeNoiseResult Finalize(BladeNoiseJob &&job) const;
+
+    /**
+     * @brief Restore the sections an interrupted run journaled for @p jobs
+     *        and journal the ones computed from now on.
+     *
+     * The first record identifies the jobs (wind speed and section flow of
+     * every point); a journal written for other jobs is started over.
+     * Restored sections are written to their result slots, and to the job's
+     * store if one is attached (attach stores first), exactly as
+     * CalculateSection() would have left them.
+     *
+     * @return restored[point][section] — the caller skips these tasks.
+     */
+    std::vector<std::vector<bool>> Resume(std::vector<BladeNoiseJob> &jobs,
+                                          CheckpointJournal          &journal) const;
+
+    /// 1/3-octave band centres of every section spectrum [Hz].
+    static std::vector<double> const &BandFrequencies();
+
     std::string get_error() const { return error_; }
 
 private:
@@ -0,0 +1,54 @@
+#pragma once
+/**
+ * @file SectionNoiseGeometry.h
+ * @brief Immutable per-section airfoil data for the noise model, built once
+ *        after the turbine geometry is set up.
+ *
+ * Holds the bladenoise-format airfoil coordinates (shared read-only by every
+ * SectionNoiseInput of the section) together with the trailing-edge and
+ * thickness parameters derived from them by AirfoilGeometryAnalyzer.  This
+ * replaces the per-call AirfoilDataAdapter::Convert() in the noise adapter
+ * and the former heuristic TE / thickness defaults.
+ *
+ * SOLID:
+ *  S – one responsibility: pre-compute static section geometry for noise.
+ *  D – BEMSectionNoiseAdapter consumes the table; it never analyses airfoils.
+ */
+#include "bladenoise/io/IOTypes.h"
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+class TurbineGeometry;
+
+/// Static noise geometry of one blade section.
+struct SectionNoiseGeometry
+{
+    /// Airfoil coordinates for the Xfoil BL method; null if the section
+    /// has no usable airfoil (then only the BPM correlations apply).
+    std::shared_ptr<const bladenoise::io::AirfoilData> airfoil_data;
+
+    double te_thickness_over_chord = 0.0;   ///< TE thickness / chord [-]
+    double te_angle_deg            = 14.0;  ///< TE solid angle PSI [deg]
+    double thickness_1_percent     = 0.0;   ///< t/c at 1% chord  [-]
+    double thickness_10_percent    = 0.0;   ///< t/c at 10% chord [-]
+};
+
+using SectionNoiseGeometryTable = std::vector<SectionNoiseGeometry>;
+
+class SectionNoiseGeometryBuilder
+{
+public:
+    /// Build the table for all sections of @p turbine (index = BEM section).
+    static std::shared_ptr<const SectionNoiseGeometryTable>
+    Build(TurbineGeometry const &turbine);
+
+    /**
+     * @brief Build the geometry of a single section.
+     *
+     * The stored airfoil coordinates are normalised, so derived thicknesses
+     * and the TE angle are rescaled to the section's relative thickness.
+     */
+    static SectionNoiseGeometry BuildSection(TurbineGeometry const &turbine,
+                                             std::size_t            index);
+};
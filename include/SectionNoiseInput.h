@@ -47,9 +47,9 @@ struct SectionNoiseInput
     std::string airfoil_file;      ///< Path to .dat file; empty → skip Xfoil BL method
 
     /// Pre-converted airfoil coordinates for XfoilBoundaryLayerCalculator.
-    /// Null when BPM method is used.  Populated by BEMSectionNoiseAdapter
-    /// via AirfoilDataAdapter::Convert() when bl_method == XFOIL.
-    std::shared_ptr<bladenoise::io::AirfoilData> airfoil_data;
+    /// Null when the section has no usable airfoil.  Shared read-only with
+    /// the section's SectionNoiseGeometry (built once per turbine).
+    std::shared_ptr<const bladenoise::io::AirfoilData> airfoil_data;
 
     // ── Observer position ─────────────────────────────────────────────────────
     double observer_distance = 1.22; ///< [m]
@@ -19,6 +19,10 @@ struct SectionNoiseSpectrum
 {
     std::vector<double> spl;        ///< SPL per 1/3-octave band [dB]
     double              oaspl{0.0}; ///< Overall SPL [dB]
+
+    /// Bands at or below this frequency [Hz] scale with the low-frequency
+    /// BPM directivity, bands above with the high-frequency one.
+    double directivity_crossover_hz{0.0};
 };
 
 /// All noise source results for one blade section.
@@ -33,6 +37,11 @@ struct SectionNoiseResult
     double      reynolds{0.0};      ///< Local Reynolds number [-]
     double      alpha_deg{0.0};     ///< Effective AoA [deg]
 
+    // Observer the spectra were evaluated for (see SectionNoiseInput)
+    double      observer_distance{0.0}; ///< [m]
+    double      observer_theta{90.0};   ///< [deg] from chord line
+    double      observer_phi{90.0};     ///< [deg] from span line
+
     SectionNoiseSpectrum tbl_pressure_side;
     SectionNoiseSpectrum tbl_suction_side;
     SectionNoiseSpectrum separation;
@@ -42,6 +51,10 @@ struct SectionNoiseResult
     SectionNoiseSpectrum total;
 
     bool converged{false};  ///< false if bladenoise::NoiseCalculator failed
+
+    /// Estimated interpolation error of the spectra [dB]; 0 when the noise
+    /// model was evaluated directly (see TabulatedNoiseConfigBuilder).
+    double surrogate_error_db{0.0};
 };
 
 /// Full blade noise result: one SectionNoiseResult per section.
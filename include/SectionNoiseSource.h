@@ -0,0 +1,58 @@
+#pragma once
+/**
+ * @file SectionNoiseSource.h
+ * @brief Directivity-free noise source spectra of the blade sections.
+ *
+ * The BPM section spectra depend on the observer only through the directivity
+ * factor (low- or high-frequency form, chosen per band) and the 1/r² spreading.
+ * Dividing both out of a SectionNoiseResult leaves the source strength of the
+ * section: the mean-square pressure a unit-directivity observer at 1 m would
+ * receive.  The noise sources of a section are summed, split by directivity
+ * form, so NoiseMapPropagator can evaluate any observer with two
+ * multiply-adds per band instead of re-running the noise model.
+ *
+ * SOLID:
+ *  S – source extraction only; propagation lives in NoiseMapPropagator.
+ *  D – built from any INoiseSpectra backing; no bladenoise types.
+ *
+ * Directivity factors are bladenoise::noise::Directivity, the ones the BPM
+ * model applied.
+ */
+#include "INoiseSpectra.h"
+#include <cstddef>
+#include <vector>
+
+/// Source strength of one blade section, summed over all noise sources.
+struct SectionNoiseSource
+{
+    std::size_t section_index{0};
+    double      radius{0.0};   ///< Radial position [m]
+    double      mach{0.0};     ///< Local Mach number [-]
+
+    /// p²/p_ref² per band at 1 m with unit directivity, for the bands that
+    /// radiate with the low- and the high-frequency directivity respectively.
+    std::vector<double> p_low;
+    std::vector<double> p_high;
+};
+
+/// Directivity-free sources of one operating point.
+struct RotorNoiseSource
+{
+    double                          vinf{0.0};    ///< Wind speed [m/s]
+    std::vector<double>             frequencies;  ///< 1/3-octave band centres [Hz]
+    std::vector<SectionNoiseSource> sections;     ///< Converged sections only
+};
+
+class SectionNoiseSourceBuilder
+{
+public:
+    /**
+     * @brief Remove the observer from every converged section of operating
+     *        point @p point.
+     *
+     * Uses the observer recorded with each section.
+     * @throws std::invalid_argument if that observer lies in a directivity
+     *         null or at zero distance (the source cannot be recovered).
+     */
+    static RotorNoiseSource Build(INoiseSpectra const &spectra, std::size_t point);
+};
@@ -6,10 +6,15 @@
  * Each class is responsible for exactly one wind-profile formula (SRP).
  * New models are added here without touching FlowCalculator (OCP).
  *
- * All models derive from IShearModel and implement VelocityAt().
+ * All models derive from IShearModel and implement VelocityAt().  Their
+ * VelocitiesAt() overrides evaluate the reference part of the profile once
+ * per call and leave a branch-free loop over the heights.
  */
 #define _USE_MATH_DEFINES
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <span>
 #include <stdexcept>
 #include "IShearModel.h"
 
@@ -47,6 +52,23 @@ public:
         return v_ref * top / bottom;
     }
 
+    void VelocitiesAt(std::span<double const> heights,
+                      double hub_height,
+                      double v_hub,
+                      std::span<double> out) const override
+    {
+        const double v_ref = use_ref_hv_ ? ref_vel_ : v_hub;
+        const double z_ref = use_ref_hv_ ? ref_height_ : hub_height;
+        const double bottom = std::log(z_ref / z0_);
+        const double z0 = z0_;
+        double const *h = heights.data();
+        double *v = out.data();
+
+#pragma omp simd
+        for (std::size_t i = 0; i < heights.size(); ++i)
+            v[i] = v_ref * std::log(h[i] / z0) / bottom;
+    }
+
 private:
     double z0_;
     double ref_vel_;
@@ -82,6 +104,28 @@ public:
         return v_ref * std::pow(in.height / z_ref, alpha_);
     }
 
+    void VelocitiesAt(std::span<double const> heights,
+                      double hub_height,
+                      double v_hub,
+                      std::span<double> out) const override
+    {
+        const double v_ref = use_ref_hv_ ? ref_vel_ : v_hub;
+        const double z_ref = use_ref_hv_ ? ref_height_ : hub_height;
+        const double alpha = alpha_;
+        double const *h = heights.data();
+        double *v = out.data();
+
+        if (alpha == 0.0) // uniform profile, (z/z_ref)^0 = 1
+        {
+            std::fill(out.begin(), out.begin() + heights.size(), v_ref);
+            return;
+        }
+
+#pragma omp simd
+        for (std::size_t i = 0; i < heights.size(); ++i)
+            v[i] = v_ref * std::pow(h[i] / z_ref, alpha);
+    }
+
 private:
     double alpha_;
     double ref_vel_;
@@ -117,6 +161,19 @@ public:
         return vstar / kappa_ * (std::log(in.height / z0_) - corr_sec);
     }
 
+    void VelocitiesAt(std::span<double const> heights,
+                      double hub_height,
+                      double v_hub,
+                      std::span<double> out) const override
+    {
+        const double corr_hub = StabilityCorrection(hub_height, L_);
+        const double vstar = v_hub * kappa_ / (std::log(hub_height / z0_) - corr_hub);
+        const double scale = vstar / kappa_;
+
+        for (std::size_t i = 0; i < heights.size(); ++i)
+            out[i] = scale * (std::log(heights[i] / z0_) - StabilityCorrection(heights[i], L_));
+    }
+
 private:
     double z0_;
     double L_;
@@ -57,4 +57,9 @@ struct SolverConfig
 
     // ── Optional features ─────────────────────────────────────────────────────
     bool verbose{false};
+
+    /// Flow angle per section from a nearby solve (e.g. the previous time
+    /// step) [rad].  When set, each section first searches a narrow bracket
+    /// around it and falls back to the full search.  nullptr → cold start.
+    std::vector<double> const *phi_start{nullptr};
 };
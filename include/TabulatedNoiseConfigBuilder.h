@@ -0,0 +1,169 @@
+#pragma once
+/**
+ * @file TabulatedNoiseConfigBuilder.h
+ * @brief Surrogate ISectionNoiseConfigBuilder: interpolates section spectra
+ *        from a table filled with the exact builder on demand.
+ *
+ * For a fixed section (chord, span, airfoil, TE geometry, turbulence,
+ * observer and noise methods) the noise model depends only on the local
+ * velocity and angle of attack; Reynolds and Mach numbers are both
+ * proportional to the velocity.  Each section is therefore tabulated over
+ * (ln Re, alpha), which covers the (Re, alpha, Mach) operating space.
+ *
+ * Grid nodes are evaluated by the wrapped exact builder the first time a
+ * query needs them and kept in a bounded store (oldest first out), so a
+ * spectrum is recomputed only after its node has been evicted.  All bands of
+ * all sources are interpolated bilinearly in dB.
+ *
+ * Error estimate: the first time a cell is used, its centre and its four
+ * quarter points are also computed exactly and compared with the bilinear
+ * values there; the largest band difference over all sources is the cell
+ * error.  A cell above the tolerance is split by halving both steps (up to
+ * TabulatedNoiseGrid::max_refinement times) and the query retried on the
+ * sub-cell containing it.  The check points are themselves nodes of the
+ * finer levels, so refining reuses them.  The accepted cell error is
+ * reported in SectionNoiseResult::surrogate_error_db.  The exact builder is
+ * used instead (error 0) when
+ *   - the query lies outside the table bounds, or
+ *   - no level up to max_refinement gives a cell whose corners and check
+ *     points converged within the tolerance.
+ *
+ * Thread-safe: Build() may run concurrently; missing nodes are computed
+ * outside the lock (racing threads may both compute, the first insert wins).
+ *
+ * SOLID:
+ *  S – tabulation and interpolation only; the physics stay in the wrapped builder.
+ *  O – a decorator; SectionNoiseCalculator is unchanged.
+ *  L – fully satisfies ISectionNoiseConfigBuilder.
+ */
+#include "ISectionNoiseConfigBuilder.h"
+#include "bladenoise/core/BoundedCache.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+/// Table lattice of TabulatedNoiseConfigBuilder, anchored at (re_min, alpha_min).
+struct TabulatedNoiseGrid
+{
+    double re_min{5.0e4};
+    double re_max{5.0e7};
+    double log_re_step{0.05};    ///< Step in ln Re (≈ 5 % in velocity)
+    double alpha_min_deg{-20.0};
+    double alpha_max_deg{25.0};
+    double alpha_step_deg{0.5};
+    int    max_refinement{2};    ///< Step halvings tried before the exact fallback
+};
+
+class TabulatedNoiseConfigBuilder final : public ISectionNoiseConfigBuilder
+{
+public:
+    struct Stats
+    {
+        std::size_t interpolated = 0;  ///< Queries answered from the table
+        std::size_t fallbacks = 0;     ///< Queries sent to the exact builder
+        std::size_t refined = 0;       ///< ... of those, from a refined cell
+        std::size_t nodes = 0;         ///< Exact evaluations of grid nodes
+        std::size_t cells = 0;         ///< Cells checked
+        std::size_t rejected = 0;      ///< Cells above the tolerance
+        std::size_t evicted = 0;       ///< Nodes dropped from the full store
+    };
+
+    static constexpr std::size_t NODE_CAPACITY = 16384;  ///< ≈ 2.5 kB per node
+    static constexpr std::size_t CELL_CAPACITY = 65536;
+
+    /**
+     * @param exact         Builder evaluated at the grid nodes and for fallbacks.
+     * @param tolerance_db  Largest accepted cell error [dB].
+     * @param grid          Table bounds and resolution.
+     * @throws std::invalid_argument for a null builder, a non-positive step
+     *         or tolerance, a negative refinement, or empty bounds.
+     */
+    TabulatedNoiseConfigBuilder(std::shared_ptr<ISectionNoiseConfigBuilder> exact,
+                                double tolerance_db = 0.5,
+                                TabulatedNoiseGrid grid = {});
+
+    bool Build(
+        SectionNoiseInput const &inp,
+        NoiseConfig       const &noise_cfg,
+        SectionNoiseResult      &result) const override;
+
+    Stats stats() const;
+
+    /// One-line summary of stats() for progress output.
+    std::string Statistics() const;
+
+private:
+    /// Node (or cell, keyed by its lower-left node) of refinement level
+    /// @c level, whose steps are the base steps / 2^level.  Node keys are
+    /// stored at the coarsest level that contains them, so the levels share
+    /// their common nodes.
+    struct Key
+    {
+        std::uint64_t section = 0;  ///< Fingerprint of the fixed section inputs
+        int           level = 0;
+        std::int64_t  re_idx = 0;   ///< Index along ln Re
+        std::int64_t  alpha_idx = 0;
+
+        bool operator==(Key const &other) const = default;
+    };
+
+    struct KeyHash
+    {
+        std::size_t operator()(Key const &key) const;
+    };
+
+    struct Node
+    {
+        bool               converged = false;
+        SectionNoiseResult result;
+    };
+
+    using NodePtr = std::shared_ptr<const Node>;
+
+    std::shared_ptr<ISectionNoiseConfigBuilder> exact_;
+    double                                      tolerance_db_;
+    TabulatedNoiseGrid                          grid_;
+
+    mutable bladenoise::BoundedCache<Key, Node, KeyHash>   nodes_{NODE_CAPACITY};
+    mutable bladenoise::BoundedCache<Key, double, KeyHash> cell_error_{CELL_CAPACITY};
+
+    mutable std::atomic<std::size_t> interpolated_{0};
+    mutable std::atomic<std::size_t> refined_{0};
+    mutable std::atomic<std::size_t> fallbacks_{0};
+    mutable std::atomic<std::size_t> evaluated_{0};
+    mutable std::atomic<std::size_t> cells_{0};
+    mutable std::atomic<std::size_t> rejected_{0};
+
+    /// Hash of everything except velocity and alpha, including the airfoil
+    /// coordinates (not their address).
+    static std::uint64_t Fingerprint(SectionNoiseInput const &inp,
+                                     NoiseConfig       const &noise_cfg);
+
+    /// @p inp moved to Reynolds number @p re and angle @p alpha_deg.
+    static SectionNoiseInput AtState(SectionNoiseInput const &inp,
+                                     double re, double alpha_deg);
+
+    NodePtr GetNode(Key key,
+                    SectionNoiseInput const &inp,
+                    NoiseConfig       const &noise_cfg) const;
+
+    /// Cell error [dB]; +inf if a corner or check point did not converge.
+    double CellError(Key const &cell,
+                     NodePtr const corners[4],
+                     SectionNoiseInput const &inp,
+                     NoiseConfig       const &noise_cfg) const;
+
+    /// Bilinear interpolation of all spectra; corner order (0,0) (1,0) (0,1) (1,1).
+    static void Interpolate(NodePtr const corners[4], double u, double v,
+                            SectionNoiseResult &result);
+
+    /// Largest band (and OASPL) difference over all sources.
+    static double MaxDifference(SectionNoiseResult const &a,
+                                SectionNoiseResult const &b);
+
+    bool Exact(SectionNoiseInput  const &inp,
+               NoiseConfig        const &noise_cfg,
+               SectionNoiseResult       &result) const;
+};
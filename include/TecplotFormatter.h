@@ -2,25 +2,46 @@
 #define TECPLOTFORMATTER_H
 
 #include "IFormatter.h"
-#include <sstream>
-#include <iomanip>
+#include <cstddef>
+#include <string>
+#include <vector>
 
 /**
  * @brief Formatter for Tecplot-style data files
  *
- * Implements IFormatter for the specific format shown in the examples
+ * Implements IFormatter for the specific format shown in the examples.
+ * Numbers are written with std::to_chars in fixed notation (same text as
+ * std::fixed with std::setprecision).  formatTo() fills one reusable buffer
+ * and hands it to the output target whenever it reaches kChunkBytes, so a
+ * large file is never held in memory as a whole.
  */
 class TecplotFormatter : public IFormatter
 {
 public:
+    /// Buffered bytes handed to the output target per chunk
+    static constexpr std::size_t kChunkBytes = std::size_t{1} << 20;
+
+    /// Decimals for columns without an entry in DataZone::columnPrecisions
+    static constexpr int kDefaultPrecision = 9;
+
     TecplotFormatter() = default;
 
     std::string format(const DataFormat &data) const override;
+    bool formatTo(const DataFormat &data, IOutputTarget &target) const override;
+
+    /**
+     * @brief Append a value in fixed notation
+     * @param out Destination buffer
+     * @param value Value to format
+     * @param precision Decimals after the point (negative: 6, as printf)
+     */
+    static void appendFixed(std::string &out, double value, int precision);
 
 private:
-    std::string formatVariables(const std::vector<std::string> &vars) const;
-    std::string formatZoneHeader(const DataZone &zone) const;
-    std::string formatZoneData(const DataZone &zone) const;
+    void appendVariables(std::string &out, const std::vector<std::string> &vars) const;
+    void appendZoneHeader(std::string &out, const DataZone &zone) const;
+    void appendRow(std::string &out, const std::vector<double> &row,
+                   const std::vector<int> &precisions) const;
 };
 
 #endif // TECPLOTFORMATTER_H
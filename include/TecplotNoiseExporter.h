@@ -15,6 +15,15 @@
  *             OASPL_LBL, OASPL_blunt, OASPL_TI,
  *             LWA_total [dB re 1pW]  (energy-summed over sections × span).
  *
+ * ── ExportNoiseMap ───────────────────────────────────────────────────────────
+ *  Observer grid: one ordered zone (I = x, J = y) per operating point.
+ *  Variables: x, y, OASPL, OASPL_A.
+ *
+ * ── ExportAzimuthNoise ───────────────────────────────────────────────────────
+ *  One zone per operating point (named "v_inf=XX.XXm_s dLA=X.XXdB"),
+ *  rows = blade-1 azimuth.
+ *  Variables: psi, t, OASPL/OASPL_A/LWA for one blade state and the rotor.
+ *
  * SOLID:
  *  S – formats and writes; delegates I/O to IFormatter / DataWriter.
  *  O – new export methods extend INoiseResultsExporter without modifying this.
@@ -24,6 +33,7 @@
 #include "IFormatter.h"
 #include "DataFormat.h"
 #include "RotorNoiseResult.h"
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <vector>
@@ -39,8 +49,8 @@ public:
         std::string      const &output_path) const override;
 
     bool ExportPowerCurveNoise(
-        std::vector<BladeNoiseResult> const &results,
-        std::string                   const &output_path) const override;
+        INoiseSpectra const &spectra,
+        std::string   const &output_path) const override;
 
     /**
      * @brief Export aggregated rotor noise: one zone per noise source,
@@ -50,13 +60,28 @@ public:
         std::vector<RotorNoiseResult> const &results,
         std::string                   const &output_path) const override;
 
+    /**
+     * @brief Export noise maps: one ordered I×J zone per operating point,
+     *        columns = x, y, OASPL, OASPL_A.
+     */
+    bool ExportNoiseMap(
+        std::vector<NoiseMapResult> const &results,
+        std::string                 const &output_path) const override;
+
+    /**
+     * @brief Export azimuth-resolved noise: one zone per operating point,
+     *        rows = azimuth, columns = blade and rotor OASPL / OASPL_A / LWA.
+     */
+    bool ExportAzimuthNoise(
+        std::vector<AzimuthNoiseResult> const &results,
+        std::string                     const &output_path) const override;
+
 private:
     std::shared_ptr<IFormatter> formatter_;
 
     // ── Format builders (SRP: each builds one DataFormat) ────────────────────
     static DataFormat BuildSinglePointFormat(BladeNoiseResult const &result);
-    static DataFormat BuildPowerCurveFormat(
-        std::vector<BladeNoiseResult> const &results);
+    static DataFormat BuildPowerCurveFormat(INoiseSpectra const &spectra);
 
     // ── Shared helpers ────────────────────────────────────────────────────────
     /// Variable list for the power-curve noise file.
@@ -64,12 +89,14 @@ private:
         std::vector<double> const &frequencies);
 
     /// Build one DataZone for one operating point.
-    static DataZone BuildOperatingPointZone(BladeNoiseResult const &result);
+    static DataZone BuildOperatingPointZone(INoiseSpectra const &spectra,
+                                            std::size_t          point);
 
     /// Sound power level [dB re 1 pW] summed over all sections for one source.
     /// LW = 10·log10( Σ_i  10^(OASPL_i / 10) · chord_i · span_i ) + 120
-    static double ComputeLWA(BladeNoiseResult const &result,
-                             SectionNoiseSpectrum SectionNoiseResult::*src);
+    static double ComputeLWA(INoiseSpectra const &spectra,
+                             std::size_t          point,
+                             NoiseSource          src);
 
     // ── Rotor noise helpers ───────────────────────────────────────────────────
     /// Variable list for the rotor noise file (OASPL/LWA scalars + SPL spectrum).
@@ -89,5 +116,13 @@ private:
     static DataFormat BuildRotorNoiseFormat(
         std::vector<RotorNoiseResult> const &results);
 
+    // ── Noise map helpers ─────────────────────────────────────────────────────
+    /// Build one ordered DataZone (I = x, J = y) for one operating point.
+    static DataZone BuildNoiseMapZone(NoiseMapResult const &result);
+
+    // ── Azimuth noise helpers ─────────────────────────────────────────────────
+    /// Build one DataZone (rows = azimuth) for one operating point.
+    static DataZone BuildAzimuthNoiseZone(AzimuthNoiseResult const &result);
+
     bool Write(DataFormat const &fmt, std::string const &path) const;
 };
@@ -0,0 +1,59 @@
+#pragma once
+/**
+ * @file TecplotTimeSeriesWriter.h
+ * @brief Writes a single-zone Tecplot file row by row while it is computed.
+ *
+ * Single Responsibility: owns the output file of a time series; callers
+ * append one row per time step.  The header is produced by TecplotFormatter,
+ * so the file reads exactly like the DataFormat-based exports.
+ *
+ * Rows are flushed in blocks of kFlushRows, so an interrupted run leaves
+ * every completed block on disk and memory does not grow with run length.
+ * Numbers go through TecplotFormatter::appendFixed() into one reused line
+ * buffer.
+ */
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <vector>
+
+class TecplotTimeSeriesWriter
+{
+public:
+    /// Rows written between two flushes of the file stream.
+    static constexpr std::size_t kFlushRows = 64;
+
+    /**
+     * @brief Create the file and write TITLE, VARIABLES and the zone header.
+     *
+     * @param path       Output file; its directory is created if missing.
+     * @param title      Tecplot title and zone title.
+     * @param variables  Column names.
+     * @param num_rows   Rows the zone will hold (Tecplot I dimension).
+     * @throws std::runtime_error if the file cannot be created.
+     */
+    TecplotTimeSeriesWriter(std::string const &path,
+                            std::string const &title,
+                            std::vector<std::string> const &variables,
+                            std::size_t num_rows);
+
+    TecplotTimeSeriesWriter(TecplotTimeSeriesWriter const &) = delete;
+    TecplotTimeSeriesWriter &operator=(TecplotTimeSeriesWriter const &) = delete;
+
+    /**
+     * @brief Append one data row (fixed notation, 9 decimals).
+     * @throws std::invalid_argument if the column count does not match.
+     */
+    void AppendRow(std::vector<double> const &row);
+
+    /// Flush outstanding rows; returns false if any write failed.
+    bool Close();
+
+    std::size_t rows_written() const { return rows_written_; }
+
+private:
+    std::ofstream out_;
+    std::string line_;
+    std::size_t num_columns_{0};
+    std::size_t rows_written_{0};
+};
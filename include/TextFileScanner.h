@@ -0,0 +1,158 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Read-only memory mapping of a whole text file
+ *
+ * MappedTextFile maps a file into memory (mmap / MapViewOfFile) and exposes
+ * its contents as one std::string_view, so parsers can scan lines and tokens
+ * without copying them into std::string objects first.
+ *
+ * ## Key Features
+ * - **Zero Copy**: Lines and tokens are views into the mapping
+ * - **RAII**: The mapping is released with the object (move-only)
+ * - **Empty Files**: Yield an empty view instead of a failed mapping
+ *
+ * @note Views obtained from text() are valid only while the object lives
+ *
+ * @example
+ * ```cpp
+ * MappedTextFile file("polar.dat");
+ * LineScanner lines(file.text());
+ * std::string_view line;
+ * while (lines.next(line)) { ... }
+ * ```
+ */
+class MappedTextFile {
+
+public:
+
+    /**
+     * @brief Maps the file read-only
+     * @param filePath Path of the file to map
+     * @throws std::runtime_error if the file cannot be opened or mapped
+     */
+    explicit MappedTextFile(const std::string& filePath);
+
+    ~MappedTextFile();
+
+    MappedTextFile(MappedTextFile&& other) noexcept;
+    MappedTextFile& operator=(MappedTextFile&& other) noexcept;
+    MappedTextFile(const MappedTextFile&) = delete;
+    MappedTextFile& operator=(const MappedTextFile&) = delete;
+
+    /**
+     * @brief Whole file contents
+     */
+    std::string_view text() const { return { data, size }; }
+
+private:
+
+    const char* data = nullptr;
+    std::size_t size = 0;
+
+    void release() noexcept;
+};
+
+/**
+ * @brief Splits a text buffer into lines the way std::getline does
+ *
+ * Lines are separated by '\n'; a trailing '\r' is removed from each line and
+ * a UTF-8 byte-order mark at the start of the buffer is skipped. A final line
+ * without terminator is returned, a terminator at the very end does not
+ * produce an extra empty line.
+ */
+class LineScanner {
+
+public:
+
+    explicit LineScanner(std::string_view text);
+
+    /**
+     * @brief Advances to the next line
+     * @param line Receives the line (without terminator)
+     * @return false once the buffer is exhausted
+     */
+    bool next(std::string_view& line);
+
+    /**
+     * @brief 1-based number of the line last returned by next()
+     */
+    std::size_t lineNumber() const { return number; }
+
+private:
+
+    std::string_view rest;
+    std::size_t number = 0;
+};
+
+/**
+ * @brief Allocation-free helpers for tokenizing and converting text views
+ *
+ * Numeric conversion uses std::from_chars and follows the std::stod / std::stoi
+ * conventions the parsers relied on before: leading whitespace and a leading
+ * '+' are accepted and trailing characters after the number are ignored. The
+ * parse* functions report failure through their return value; the to*
+ * functions throw and are meant for fields that must be numeric.
+ */
+namespace text {
+
+/**
+ * @brief Removes leading and trailing characters contained in @p chars
+ */
+std::string_view trim(std::string_view s, std::string_view chars = " \t\r\n");
+
+/**
+ * @brief Splits on @p delimiter, trims " \t\r" from each field and drops empty fields
+ * @param out Cleared and filled with views into @p line
+ */
+void splitFields(std::string_view line, char delimiter, std::vector<std::string_view>& out);
+
+/**
+ * @brief Splits on any whitespace (like repeated `stream >> token`)
+ * @param out Cleared and filled with views into @p line
+ */
+void splitWhitespace(std::string_view line, std::vector<std::string_view>& out);
+
+/**
+ * @brief Case-insensitive (ASCII) prefix test
+ */
+bool startsWithNoCase(std::string_view s, std::string_view prefix);
+
+/**
+ * @brief Case-insensitive (ASCII) search
+ * @return Position of the first match or std::string_view::npos
+ */
+std::size_t findNoCase(std::string_view s, std::string_view needle, std::size_t from = 0);
+
+/**
+ * @brief Converts a leading floating-point number
+ * @return true if a number was read; @p value is unchanged otherwise
+ */
+bool parseDouble(std::string_view s, double& value);
+
+/**
+ * @brief Converts a leading integer
+ * @return true if a number was read; @p value is unchanged otherwise
+ */
+bool parseInt(std::string_view s, int& value);
+
+/**
+ * @brief Converts a leading floating-point number
+ * @throws std::invalid_argument if no number is found
+ * @throws std::out_of_range if the value is not representable
+ */
+double toDouble(std::string_view s);
+
+/**
+ * @brief Converts a leading integer
+ * @throws std::invalid_argument if no number is found
+ * @throws std::out_of_range if the value is not representable
+ */
+int toInt(std::string_view s);
+
+}  // namespace text
@@ -0,0 +1,112 @@
+#pragma once
+/**
+ * @file TimeDomainSolver.h
+ * @brief Time-marching (unsteady) BEM run driven by a TurbSim wind field.
+ *
+ * SOLID compliance:
+ *  S - responsible only for the time loop: advance the rotor azimuth, sample
+ *      the wind field, solve every blade and reduce the blade loads.  Output
+ *      is delegated to a per-step callback.
+ *  O - the wind field enters through SampledInletProvider (IInletVelocityProvider),
+ *      filled from a TurbSimSamplingPlan; the solver is built by NingSolverFactory.
+ *  I - callers receive one TimeDomainStep per time step; solver internals
+ *      are hidden.
+ *  D - depends on TurbineGeometry, ISimulationConfig and TurbSimManager.
+ *
+ * Operating mode: constant rotor speed and collective pitch
+ *
+ *   t      = step * dt              (dt = TurbSim time step)
+ *   psi_b  = psi_start + rot_rate * t + b * 2 pi / B
+ *
+ * Every blade b is solved as its own quasi-steady BEM problem in the local
+ * inflow of its azimuth.  The sample stencils of all sections are planned
+ * for blocks of kPlanBlock steps ahead of the loop.  The (blade, section) pairs of one step share a
+ * single parallel loop, and each blade starts its root search from its flow
+ * angles of the previous step.
+ *
+ * With a CheckpointJournal every step is journaled, and the blades' flow
+ * angles every kStateInterval steps.  A resumed run replays the journaled
+ * steps through the callback and continues from the last saved flow angles,
+ * so the step sequence is the same as without the interruption.
+ */
+#include "CheckpointJournal.h"
+#include "ISimulationConfig.h"
+#include "TurbineGeometry.h"
+#include "TurbSimManager.h"
+
+#include <functional>
+#include <vector>
+
+// ─────────────────────────────────────────────────────────────────────────────
+/// Parameters of a time-domain run.
+struct TimeDomainParams
+{
+    double rot_rate{0.0};  ///< Rotor angular velocity [rad/s]
+    double pitch_rad{0.0}; ///< Collective pitch [rad]
+    double psi_start{0.0}; ///< Azimuth of blade 1 at t = 0 [rad]
+    unsigned num_steps{0}; ///< Time steps to run; 0 → all usable TurbSim iterations
+};
+
+// ─────────────────────────────────────────────────────────────────────────────
+/// Rotor and blade loads at one time step.
+struct TimeDomainStep
+{
+    unsigned step{0};
+    double time{0.0};   ///< [s]
+    double psi{0.0};    ///< Azimuth of blade 1 [rad]
+    double v_hub{0.0};  ///< Axial wind speed at the hub centre [m/s]
+    double power{0.0};  ///< Aerodynamic power [W]
+    double thrust{0.0}; ///< Rotor thrust [N]
+    double torque{0.0}; ///< Rotor torque [Nm]
+
+    unsigned converged_blades{0}; ///< Blades whose solve converged
+
+    // Per blade, BEMPostprocessResult conventions (zero if not converged)
+    std::vector<double> blade_thrust; ///< Thrust per blade [N]
+    std::vector<double> root_mx;      ///< Root moment mx per blade [Nm]
+    std::vector<double> root_my;      ///< Root moment my per blade [Nm]
+};
+
+/// Receives every time step in order, right after it is solved.
+using TimeDomainStepCallback = std::function<void(TimeDomainStep const &)>;
+
+// ─────────────────────────────────────────────────────────────────────────────
+/// Drives the time loop over a loaded TurbSim field.
+class TimeDomainSolver
+{
+public:
+    TimeDomainSolver(TurbineGeometry const   *turbine,
+                     ISimulationConfig const *sim_config,
+                     TurbSimManager const    *wind);
+
+    /// Number of steps Run() performs for @p params.
+    unsigned StepCount(TimeDomainParams const &params) const;
+
+    /**
+     * @brief Run the time loop.
+     *
+     * @param params   Rotor speed, pitch, start azimuth and length.
+     * @param on_step  Called once per step, in order (e.g. to write a row);
+     *                 on resume, first for every restored step.
+     * @param journal  Optional checkpoint journal (see file comment).
+     *                 Completing it is left to the caller.
+     * @return         Number of steps in which every blade converged.
+     */
+    unsigned Run(TimeDomainParams const &params,
+                 TimeDomainStepCallback const &on_step,
+                 CheckpointJournal *journal = nullptr) const;
+
+private:
+    /// Steps planned at once (bounds the stencil memory of long runs).
+    static constexpr unsigned kPlanBlock = 256;
+
+    /// Steps between journaled warm-start states.
+    static constexpr unsigned kStateInterval = 32;
+
+    TurbineGeometry const   *turbine_;
+    ISimulationConfig const *sim_config_;
+    TurbSimManager const    *wind_;
+
+    /// Azimuth of blade @p blade at @p step [rad], in [0, 2 pi).
+    double BladeAzimuth(TimeDomainParams const &params, unsigned step, int blade) const;
+};
@@ -7,6 +7,10 @@
  * y-axis and z-axis sample points.  No velocity data, no file I/O.
  *
  * This is a plain value type; it may be copied freely.
+ *
+ * TurbSim grids are uniform, so besides the flat point arrays the grid keeps
+ * its two axes and spacings; interpolators locate a cell arithmetically
+ * instead of scanning the axis.
  */
 #include <cstddef>
 #include <stdexcept>
@@ -32,7 +36,7 @@ public:
                 double spacing_z,
                 unsigned num_y,
                 unsigned num_z)
-        : num_y_(num_y), num_z_(num_z)
+        : num_y_(num_y), num_z_(num_z), spacing_y_(spacing_y), spacing_z_(spacing_z)
     {
         if (num_y == 0 || num_z == 0)
             throw std::invalid_argument("TurbSimGrid: grid dimensions must be > 0");
@@ -49,26 +53,20 @@ public:
 
     // ── Axis vectors (one value per grid line) ────────────────────────────────
     /**
-     * @brief Unique y-axis grid positions (num_y values).
+     * @brief Unique y-axis grid positions (num_y values, ascending).
      */
-    std::vector<double> axis_y() const
-    {
-        std::vector<double> y(num_y_);
-        for (unsigned i = 0; i < num_y_; ++i)
-            y[i] = grid_points_y_[i]; // first row holds unique y values
-        return y;
-    }
+    std::vector<double> const &axis_y() const { return axis_y_; }
 
     /**
-     * @brief Unique z-axis grid positions (num_z values).
+     * @brief Unique z-axis grid positions (num_z values, ascending).
      */
-    std::vector<double> axis_z() const
-    {
-        std::vector<double> z(num_z_);
-        for (unsigned j = 0; j < num_z_; ++j)
-            z[j] = grid_points_z_[j * num_y_]; // one per row
-        return z;
-    }
+    std::vector<double> const &axis_z() const { return axis_z_; }
+
+    /// Lateral grid spacing [m].
+    double spacing_y() const { return spacing_y_; }
+
+    /// Vertical grid spacing [m].
+    double spacing_z() const { return spacing_z_; }
 
     // ── Full flat arrays (num_y × num_z values, row-major) ────────────────────
     std::vector<double> const &grid_points_y() const { return grid_points_y_; }
@@ -77,8 +75,12 @@ public:
 private:
     unsigned num_y_{0};
     unsigned num_z_{0};
+    double spacing_y_{0.0};
+    double spacing_z_{0.0};
     std::vector<double> grid_points_y_;
     std::vector<double> grid_points_z_;
+    std::vector<double> axis_y_; // first row of grid_points_y_
+    std::vector<double> axis_z_; // one entry per row of grid_points_z_
 
     void BuildGridPoints(double centre_height,
                          double spacing_y,
@@ -98,5 +100,10 @@ private:
                 grid_points_z_.push_back(centre_height - height / 2.0 + j * spacing_z);
             }
         }
+
+        axis_y_.assign(grid_points_y_.begin(), grid_points_y_.begin() + num_y_);
+        axis_z_.reserve(num_z_);
+        for (unsigned j = 0; j < num_z_; ++j)
+            axis_z_.push_back(grid_points_z_[j * num_y_]);
     }
 };
@@ -82,11 +82,39 @@ public:
         WVPMUtilities::Vec3D<double> const &point,
         unsigned iteration) const;
 
+    /**
+     * @brief Interpolated velocities at many points for one iteration.
+     *
+     * Batched form of VelocityAt() for a whole rotor (all sections of all
+     * blades): the iteration is resolved once and the interpolator sees the
+     * full point set.  Structure-of-arrays layout.
+     *
+     * @param y, z       Query coordinates, @p count values each [m].
+     * @param count      Number of query points.
+     * @param iteration  User-facing (non-padded) time-step index.
+     * @param u, v, w    Output velocity components, @p count values each [m/s].
+     */
+    void VelocitiesAt(double const *y,
+                      double const *z,
+                      std::size_t count,
+                      unsigned iteration,
+                      double *u,
+                      double *v,
+                      double *w) const;
+
     // ── Accessors ─────────────────────────────────────────────────────────────
     double hub_velocity() const;
     double timestep() const;
     unsigned requested_num_iterations() const;
-    TurbSimGrid grid() const;
+    TurbSimGrid const &grid() const;
+
+    /**
+     * @brief Raw velocity grid of one user-facing iteration.
+     *
+     * For callers that precompute their own interpolation stencils
+     * (TurbSimSamplingPlan).
+     */
+    TurbSimVelocityData::TimestepView Timestep(unsigned iteration) const;
 
     /**
      * @brief Return all velocity components for one user-facing iteration
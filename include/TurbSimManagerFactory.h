@@ -18,6 +18,7 @@
  * or the class that owns both.
  */
 #include <memory>
+#include <stdexcept>
 #include <string>
 
 #include "TurbSimManager.h"
@@ -50,6 +51,35 @@ public:
         return mgr;
     }
 
+    /**
+     * @brief Build a TurbSimManager that keeps only a window of timesteps
+     *        in memory, prefetched on a background thread.
+     *
+     * For wind fields larger than RAM.  Queries should advance through the
+     * iterations (as a time-domain run does); a jump backwards reloads the
+     * window.
+     *
+     * @param filename       Path to a Bladed/AeroDyn .wnd file.
+     * @param window_steps   Timesteps held in memory (at least 3).
+     * @return               Ready-to-use TurbSimManager.
+     */
+    std::unique_ptr<TurbSimManager> BuildStreaming(std::string const &filename,
+                                                   std::size_t window_steps)
+    {
+        if (window_steps < 3)
+            throw std::invalid_argument("TurbSimManagerFactory: stream window must hold at least 3 timesteps");
+
+        owned_readers_.push_back(std::make_unique<BladedBinaryReader>(window_steps));
+        owned_interps_.push_back(std::make_unique<BilinearTurbSimInterpolator>());
+
+        auto mgr = std::make_unique<TurbSimManager>(
+            owned_readers_.back().get(),
+            owned_interps_.back().get());
+
+        mgr->Load(filename);
+        return mgr;
+    }
+
     /**
      * @brief Build a TurbSimManager with custom strategies.
      *
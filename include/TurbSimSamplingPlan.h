@@ -0,0 +1,90 @@
+#pragma once
+/**
+ * @file TurbSimSamplingPlan.h
+ * @brief Precomputed TurbSim sampling stencils for a block of time steps.
+ *
+ * Single Responsibility: turns the blade-section positions of a run (rotor
+ * azimuth per step and blade) into bilinear stencils once, then gathers the
+ * inflow of a step from them.  No file I/O, no BEM.
+ *
+ * With constant rotor speed the sample positions of every step are known
+ * before the run starts.  Planning hoists the coordinate transform and the
+ * cell search out of the time loop; what remains per step is, for each
+ * (blade, section), a gather of the 4 cell corners and a multiply-add with
+ * the stored weights — directly on the int16 samples of a packed field,
+ * decoded once per point instead of once per corner.
+ *
+ * Storage is 20 bytes per (step, blade, section).  TimeDomainSolver plans in
+ * blocks of steps so long runs stay bounded.
+ *
+ * Results match BilinearTurbSimInterpolator to rounding (same cell, weights
+ * instead of nested lerps).
+ */
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "TurbineGeometry.h"
+#include "TurbSimGrid.h"
+#include "TurbSimVelocityData.h"
+
+class TurbSimSamplingPlan
+{
+public:
+    /**
+     * @param turbine     Geometry providing the section positions.
+     * @param grid        TurbSim grid the stencils refer to.
+     * @param first_step  Iteration of the first planned step.
+     * @param azimuths    Blade azimuths [rad], num_steps × num_blades
+     *                    (step-major); their count fixes num_steps.
+     * @throws std::invalid_argument on an empty or ragged azimuth table.
+     */
+    TurbSimSamplingPlan(TurbineGeometry const *turbine,
+                        TurbSimGrid const &grid,
+                        unsigned first_step,
+                        std::vector<double> const &azimuths);
+
+    unsigned first_step() const { return first_step_; }
+    unsigned num_steps() const { return num_steps_; }
+
+    /// True if @p step lies in the planned block.
+    bool Covers(unsigned step) const
+    {
+        return step >= first_step_ && step - first_step_ < num_steps_;
+    }
+
+    /// Samples per step: num_blades × num_sections (blade-major).
+    std::size_t points_per_step() const { return points_per_step_; }
+
+    /// Memory held by the stencils [bytes].
+    std::size_t bytes() const
+    {
+        return corner_.size() * sizeof(std::uint32_t) +
+               (ty_.size() + tz_.size()) * sizeof(double);
+    }
+
+    /**
+     * @brief Inflow of all planned (blade, section) points at one step.
+     *
+     * @param step     Planned iteration (Covers(step) must hold).
+     * @param ts       Velocity grid of that iteration (TurbSimManager::Timestep).
+     * @param u, v, w  Output, points_per_step() values each [m/s].
+     * @throws std::out_of_range if the step is not planned.
+     */
+    void Gather(unsigned step,
+                TurbSimVelocityData::TimestepView const &ts,
+                double *u,
+                double *v,
+                double *w) const;
+
+private:
+    unsigned first_step_;
+    unsigned num_steps_{0};
+    std::size_t points_per_step_{0};
+    std::size_t num_y_;
+
+    // One entry per (step, blade, section)
+    std::vector<std::uint32_t> corner_; // flat index of the (y_lo, z_lo) corner
+    std::vector<double> ty_;            // fractional y position in the cell
+    std::vector<double> tz_;            // fractional z position in the cell
+};
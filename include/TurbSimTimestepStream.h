@@ -0,0 +1,115 @@
+#pragma once
+/**
+ * @file TurbSimTimestepStream.h
+ * @brief Bounded window of packed TurbSim timesteps, prefetched from disk.
+ *
+ * Single Responsibility: keeps a fixed number of timesteps of int16 samples
+ * in a ring buffer and refills it from the file on a background thread.
+ * No header parsing (the reader supplies offsets and sizes), no decoding,
+ * no interpolation.
+ *
+ * A time-domain run walks the field forward one timestep at a time, so only
+ * a short window around the current rotor time has to be resident.  Memory
+ * is capacity × num_points × 6 bytes, independent of the file length.
+ *
+ * Window rule
+ * ───────────
+ * The highest timestep requested so far is the head.  The ring holds
+ * [head − history, head − history + capacity); the prefetch thread keeps
+ * the slots ahead of the head filled while the caller computes.  A request
+ * behind the window repositions it (and blocks until reloaded); a request
+ * far ahead skips forward.
+ *
+ * Pointers returned by Acquire() stay valid until the head moves more than
+ * @c history timesteps past them, or until a request behind the window
+ * repositions it: the reload reuses every slot, so all earlier pointers are
+ * invalid after a backward request.
+ *
+ * A file of at most @c capacity timesteps is held whole; its slots are
+ * never reused.
+ */
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+class TurbSimTimestepStream
+{
+public:
+    /**
+     * @param filename       File holding the samples.
+     * @param data_offset    Byte offset of timestep 0.
+     * @param num_timesteps  Timesteps in the file.
+     * @param num_points     Grid points per timestep (3 int16 samples each).
+     * @param capacity       Timesteps held in memory (≥ history + 2 unless
+     *                       the whole file fits).
+     * @param history        Timesteps kept behind the head for views still in use.
+     * @throws std::invalid_argument on an inconsistent window.
+     * @throws std::runtime_error if the file cannot be opened.
+     */
+    TurbSimTimestepStream(std::string const &filename,
+                          std::uint64_t data_offset,
+                          std::size_t num_timesteps,
+                          std::size_t num_points,
+                          std::size_t capacity,
+                          std::size_t history = 1);
+
+    ~TurbSimTimestepStream();
+
+    TurbSimTimestepStream(TurbSimTimestepStream const &) = delete;
+    TurbSimTimestepStream &operator=(TurbSimTimestepStream const &) = delete;
+
+    /**
+     * @brief Samples of timestep @p ts (num_points × (u, v, w)).
+     *
+     * Thread-safe.  Returns immediately when the prefetch thread is ahead,
+     * otherwise waits for the load.  A @p ts behind the window invalidates
+     * every pointer returned so far (see the window rule above).
+     *
+     * @throws std::out_of_range if ts >= num_timesteps().
+     * @throws std::runtime_error if reading the file failed.
+     */
+    std::int16_t const *Acquire(std::size_t ts);
+
+    std::size_t num_timesteps() const { return num_timesteps_; }
+    std::size_t num_points() const { return num_points_; }
+    std::size_t capacity() const { return capacity_; }
+
+    /// Bytes held by the ring buffer.
+    std::size_t buffer_bytes() const { return ring_.size() * sizeof(std::int16_t); }
+
+    /// Acquire() calls that had to wait for the disk.
+    std::size_t stalls() const;
+
+private:
+    static constexpr std::size_t kEmpty = static_cast<std::size_t>(-1);
+
+    std::ifstream file_; // touched by the prefetch thread only
+    std::uint64_t data_offset_;
+    std::size_t num_timesteps_;
+    std::size_t num_points_;
+    std::size_t capacity_;
+    std::size_t history_;
+
+    std::vector<std::int16_t> ring_;
+    std::vector<std::size_t> slot_ts_; // timestep held by each slot, kEmpty while loading
+
+    mutable std::mutex mutex_;
+    std::condition_variable loaded_;    // prefetch → readers
+    std::condition_variable advanced_;  // readers → prefetch
+    std::size_t head_{0};
+    std::size_t next_{0};               // next timestep the prefetch thread loads
+    std::size_t stalls_{0};
+    std::string error_;
+    bool stop_{false};
+
+    std::thread worker_;
+
+    std::size_t WindowStart() const { return head_ > history_ ? head_ - history_ : 0; }
+    std::int16_t *Slot(std::size_t ts) { return ring_.data() + (ts % capacity_) * num_points_ * 3; }
+    void Prefetch();
+};
@@ -7,12 +7,24 @@
  * by time step.  No file I/O, no interpolation, no grid geometry.
  *
  * Interface Segregation: read-only consumers (interpolators) call
- * TimestepBegin(); writers (the file reader) call AddTimestep().
+ * View() / DecodeTimestep(); writers (the file reader) call AddTimestep()
+ * or FromPacked().
+ *
+ * Three backings share one interface:
+ *  - decoded:  one VelocityTimestep of doubles per timestep (AddTimestep);
+ *  - packed:   the Bladed int16 samples left in place (typically inside a
+ *    memory-mapped .wnd file) and decoded only for the grid points that are
+ *    actually requested — 6 bytes per grid point instead of 24;
+ *  - streamed: packed samples of a bounded window of timesteps, prefetched
+ *    from disk by a TurbSimTimestepStream (fields larger than memory).
  */
 #include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <stdexcept>
 #include <vector>
 #include "MathUtilities.h" // WVPMUtilities::Vec3D<double>
+#include "TurbSimTimestepStream.h"
 
 /// One time-step's worth of velocity vectors, one per grid point.
 using VelocityTimestep = std::vector<WVPMUtilities::Vec3D<double>>;
@@ -20,37 +32,227 @@ using VelocityTimestep = std::vector<WVPMUtilities::Vec3D<double>>;
 class TurbSimVelocityData
 {
 public:
+    /**
+     * @brief Bladed int16 encoding of the three velocity components.
+     *
+     * component = hub_velocity * (scale * raw + offset), with
+     * scale = (TI / 100) / 1000 and offset = 1 for u, 0 for v and w.
+     */
+    struct PackedEncoding
+    {
+        double hub_velocity{0.0};
+        double scale[3]{0.0, 0.0, 0.0};
+        double offset[3]{1.0, 0.0, 0.0};
+    };
+
+    /**
+     * @brief Read-only access to one timestep, independent of the backing.
+     *
+     * Cheap to copy; valid while the TurbSimVelocityData lives.  With the
+     * streamed backing only while its timestep stays in the stream window
+     * (see TurbSimTimestepStream).
+     */
+    class TimestepView
+    {
+    public:
+        /// Velocity at flat grid index @p point (z-outer, y-inner); unchecked.
+        WVPMUtilities::Vec3D<double> operator[](std::size_t point) const
+        {
+            if (decoded_)
+                return decoded_[point];
+
+            std::int16_t const *s = packed_ + 3 * point;
+            return WVPMUtilities::Vec3D<double>(
+                encoding_->hub_velocity * (encoding_->scale[0] * s[0] + encoding_->offset[0]),
+                encoding_->hub_velocity * (encoding_->scale[1] * s[1] + encoding_->offset[1]),
+                encoding_->hub_velocity * (encoding_->scale[2] * s[2] + encoding_->offset[2]));
+        }
+
+        /// Raw access for bulk gathers: exactly one of packed() / decoded()
+        /// is non-null; encoding() accompanies packed().
+        std::int16_t const *packed() const { return packed_; }
+        WVPMUtilities::Vec3D<double> const *decoded() const { return decoded_; }
+        PackedEncoding const *encoding() const { return encoding_; }
+
+    private:
+        friend class TurbSimVelocityData;
+
+        WVPMUtilities::Vec3D<double> const *decoded_{nullptr};
+        std::int16_t const *packed_{nullptr};
+        PackedEncoding const *encoding_{nullptr};
+    };
+
     TurbSimVelocityData() = default;
 
+    /**
+     * @brief Wrap packed int16 samples without decoding them.
+     *
+     * @param owner          Keeps the sample memory alive (e.g. the file mapping).
+     * @param samples        num_timesteps × num_points × 3 samples (u, v, w per point).
+     * @param num_timesteps  Number of stored timesteps.
+     * @param num_points     Grid points per timestep.
+     * @param encoding       Decoding constants.
+     */
+    static TurbSimVelocityData FromPacked(std::shared_ptr<void const> owner,
+                                          std::int16_t const *samples,
+                                          std::size_t num_timesteps,
+                                          std::size_t num_points,
+                                          PackedEncoding const &encoding)
+    {
+        TurbSimVelocityData data;
+        data.owner_ = std::move(owner);
+        data.packed_ = samples;
+        data.packed_timesteps_ = num_timesteps;
+        data.num_points_ = num_points;
+        data.encoding_ = std::make_shared<PackedEncoding const>(encoding);
+        return data;
+    }
+
+    /**
+     * @brief Read packed samples through a bounded prefetching window.
+     *
+     * Views follow the stream's lifetime rule: they stay valid until the
+     * caller has moved more than the stream's history past their timestep.
+     *
+     * @param stream    Window over the file's samples (shared by copies).
+     * @param encoding  Decoding constants.
+     */
+    static TurbSimVelocityData FromStream(std::shared_ptr<TurbSimTimestepStream> stream,
+                                          PackedEncoding const &encoding)
+    {
+        if (!stream)
+            throw std::invalid_argument("TurbSimVelocityData: stream must be non-null");
+        TurbSimVelocityData data;
+        data.packed_timesteps_ = stream->num_timesteps();
+        data.num_points_ = stream->num_points();
+        data.stream_ = std::move(stream);
+        data.encoding_ = std::make_shared<PackedEncoding const>(encoding);
+        return data;
+    }
+
     // ── Writing ───────────────────────────────────────────────────────────────
 
     /**
      * @brief Append one timestep of velocity data.
      * @param vt  Flat grid of Vec3D, row-major (z-outer, y-inner).
+     * @throws std::logic_error on packed data.
      */
     void AddTimestep(VelocityTimestep vt)
     {
+        if (is_packed())
+            throw std::logic_error("TurbSimVelocityData: cannot append to packed data");
+        num_points_ = vt.size();
         timesteps_.push_back(std::move(vt));
     }
 
     // ── Reading ───────────────────────────────────────────────────────────────
 
-    std::size_t num_timesteps() const { return timesteps_.size(); }
+    std::size_t num_timesteps() const { return is_packed() ? packed_timesteps_ : timesteps_.size(); }
+
+    /// Grid points per timestep.
+    std::size_t num_points() const { return num_points_; }
+
+    /// True if the samples are kept in their packed int16 form.
+    bool is_packed() const { return packed_ != nullptr || stream_ != nullptr; }
+
+    /// True if only a window of timesteps is resident (streamed backing).
+    bool is_streamed() const { return stream_ != nullptr; }
+
+    /**
+     * @brief Access one timestep without decoding the whole grid.
+     * @throws std::out_of_range if ts >= num_timesteps().
+     */
+    TimestepView View(std::size_t ts) const
+    {
+        CheckIndex(ts);
+        TimestepView view;
+        if (is_packed())
+        {
+            view.packed_ = PackedSamples(ts);
+            view.encoding_ = encoding_.get();
+        }
+        else
+        {
+            view.decoded_ = timesteps_[ts].data();
+        }
+        return view;
+    }
+
+    /**
+     * @brief Decode a full timestep into separate u, v, w arrays.
+     *
+     * Bulk path for full-field sweeps: the packed loop carries no branches
+     * and is vectorised.
+     *
+     * @param u, v, w  Output arrays with num_points() elements each.
+     * @throws std::out_of_range if ts >= num_timesteps().
+     */
+    void DecodeTimestep(std::size_t ts, double *u, double *v, double *w) const
+    {
+        CheckIndex(ts);
+        std::size_t const n = num_points_;
+
+        if (!is_packed())
+        {
+            VelocityTimestep const &vt = timesteps_[ts];
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                u[i] = vt[i].x();
+                v[i] = vt[i].y();
+                w[i] = vt[i].z();
+            }
+            return;
+        }
+
+        std::int16_t const *s = PackedSamples(ts);
+        double const hub = encoding_->hub_velocity;
+        double const ku = encoding_->scale[0], ou = encoding_->offset[0];
+        double const kv = encoding_->scale[1], ov = encoding_->offset[1];
+        double const kw = encoding_->scale[2], ow = encoding_->offset[2];
+
+        #pragma omp simd
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            u[i] = hub * (ku * s[3 * i] + ou);
+            v[i] = hub * (kv * s[3 * i + 1] + ov);
+            w[i] = hub * (kw * s[3 * i + 2] + ow);
+        }
+    }
+
+    /**
+     * @brief Decode a full timestep into a VelocityTimestep.
+     * @throws std::out_of_range if ts >= num_timesteps().
+     */
+    VelocityTimestep DecodeTimestep(std::size_t ts) const
+    {
+        if (!is_packed())
+            return Timestep(ts);
+
+        std::vector<double> u(num_points_), v(num_points_), w(num_points_);
+        DecodeTimestep(ts, u.data(), v.data(), w.data());
+
+        VelocityTimestep vt;
+        vt.reserve(num_points_);
+        for (std::size_t i = 0; i < num_points_; ++i)
+            vt.emplace_back(u[i], v[i], w[i]);
+        return vt;
+    }
 
     /**
-     * @brief Return the velocity grid for a given time index.
+     * @brief Return the velocity grid for a given time index (decoded backing).
      * @throws std::out_of_range if ts >= num_timesteps().
+     * @throws std::logic_error on packed data — use View() or DecodeTimestep().
      */
     VelocityTimestep const &Timestep(std::size_t ts) const
     {
-        if (ts >= timesteps_.size())
-            throw std::out_of_range("TurbSimVelocityData: timestep index out of range");
+        if (is_packed())
+            throw std::logic_error("TurbSimVelocityData: packed data has no decoded timesteps");
+        CheckIndex(ts);
         return timesteps_[ts];
     }
 
     /**
-     * @brief Iterator to the first grid point of a given timestep.
-     * Useful for the bilinear interpolator which walks the flat array.
+     * @brief Iterator to the first grid point of a given timestep (decoded backing).
      */
     VelocityTimestep::const_iterator TimestepBegin(std::size_t ts) const
     {
@@ -58,5 +260,29 @@ public:
     }
 
 private:
+    // Decoded backing
     std::vector<VelocityTimestep> timesteps_;
+
+    // Packed backing
+    std::shared_ptr<void const> owner_;
+    std::int16_t const *packed_{nullptr};
+    std::size_t packed_timesteps_{0};
+    std::shared_ptr<PackedEncoding const> encoding_; // stable address for views
+
+    // Streamed backing (packed_timesteps_ and encoding_ shared with packed)
+    std::shared_ptr<TurbSimTimestepStream> stream_;
+
+    std::size_t num_points_{0};
+
+    void CheckIndex(std::size_t ts) const
+    {
+        if (ts >= num_timesteps())
+            throw std::out_of_range("TurbSimVelocityData: timestep index out of range");
+    }
+
+    /// Samples of one timestep of the packed or streamed backing.
+    std::int16_t const *PackedSamples(std::size_t ts) const
+    {
+        return stream_ ? stream_->Acquire(ts) : packed_ + ts * num_points_ * 3;
+    }
 };
@@ -38,6 +38,14 @@ public:
         applyAllUnitConversions();
     }
 
+    /// Tag for data whose units are already converted (e.g. from a project snapshot)
+    struct UnitsConverted {};
+
+    TurbineControlSettingsStructuredData(TurbineControlSettingsData data, UnitsConverted)
+        : data_(std::move(data))
+    {
+    }
+
     std::string getTypeName() const override { return "TurbineControlSettings"; }
     size_t      getRowCount() const override { return data_.features.size(); }
 
@@ -9,6 +9,8 @@
 #define _USE_MATH_DEFINES
 #include <array>
 #include <cmath>
+#include <cstddef>
+#include <span>
 #include "IVeerModel.h"
 #include "MathUtilities.h" // WVPMUtilities::SquareMatrix, RotateVec3D
 
@@ -24,6 +26,12 @@ public:
     {
         return vel;
     }
+
+    void ApplyAt(std::span<double const> /*heights*/,
+                 double /*hub_height*/,
+                 std::span<WVPMUtilities::Vec3D<double>> /*vels*/) const override
+    {
+    }
 };
 
 // ─────────────────────────────────────────────────────────────────────────────
@@ -72,6 +80,25 @@ public:
         return rotated;
     }
 
+    // The rotation is about z: only x and y change, so the 3×3 matrix
+    // product collapses to four multiply-adds per vector.
+    void ApplyAt(std::span<double const> heights,
+                 double hub_height,
+                 std::span<WVPMUtilities::Vec3D<double>> vels) const override
+    {
+        const double rate = veer_rate_rad_per_m_;
+        for (std::size_t i = 0; i < heights.size(); ++i)
+        {
+            const double veer_angle = -rate * (heights[i] - hub_height);
+            const double c = std::cos(veer_angle);
+            const double s = std::sin(veer_angle);
+            const double x = vels[i].x();
+            const double y = vels[i].y();
+            vels[i][0] = c * x - s * y;
+            vels[i][1] = s * x + c * y;
+        }
+    }
+
 private:
     double veer_rate_rad_per_m_;
 };
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "bladenoise/core/BoundedCache.h"
+#include "bladenoise/core/Types.h"
+#include "bladenoise/core/ProjectConfig.h"
+#include "bladenoise/io/IOTypes.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace bladenoise {
+namespace airfoil {
+
+// Quantized operating point of a boundary-layer calculation.  Neighbouring
+// operating points that fall into the same bins share one BL solution, which
+// is always computed at the bin centre.
+struct BoundaryLayerKey
+{
+    std::uint64_t airfoil_id = 0;  // Hash of the num_points airfoil coordinates
+    int method = 0;                // BoundaryLayerMethod
+    int trip = 0;                  // TripConfig
+    std::int64_t re_bin = 0;       // log(Re) / RE_LOG_STEP
+    std::int64_t mach_bin = 0;     // Mach / MACH_STEP
+    std::int64_t alpha_bin = 0;    // alpha [deg] / ALPHA_STEP
+    std::int64_t xtr_upper_bin = 0;
+    std::int64_t xtr_lower_bin = 0;
+
+    bool operator==(const BoundaryLayerKey& other) const = default;
+};
+
+// Process-wide, thread-safe store of trailing-edge boundary-layer states
+// shared by all noise sources and operating points.
+//
+// States are stored non-dimensionally (thicknesses / chord, edge velocity /
+// freestream, Re_theta / Re) and rescaled on lookup, so a hit is valid for
+// any chord and velocity that map to the same Re / Mach bins.  A miss solves
+// at the centre of the key's bins rather than at the caller's operating
+// point, so a cached state is a function of its key alone and results do not
+// depend on which thread reached a bin first.  The store is bounded; the
+// oldest operating points are dropped first.
+class BoundaryLayerCache
+{
+public:
+    static constexpr size_t CAPACITY = 65536;
+
+    // Bin widths of the cache key
+    static constexpr Real RE_LOG_STEP = 1.0e-3;  // ~0.1 % in Re
+    static constexpr Real MACH_STEP = 1.0e-4;
+    static constexpr Real ALPHA_STEP = 0.01;     // degrees
+    static constexpr Real XTR_STEP = 1.0e-3;     // x/c
+
+    static BoundaryLayerCache& instance();
+
+    // Returns the BL state for this airfoil / operating point, running the
+    // calculator selected by config.bl_method on a miss.  On failure the
+    // calculator's message is written to `error` and nothing is cached.
+    // Operating points with no valid Re / Mach bin (zero velocity or chord)
+    // bypass the cache and are solved as given.
+    bool get_or_compute(const io::AirfoilData& airfoil,
+                        const ProjectConfig& config,
+                        BoundaryLayerState& upper_bl,
+                        BoundaryLayerState& lower_bl,
+                        std::string& error);
+
+    static BoundaryLayerKey make_key(const io::AirfoilData& airfoil,
+                                     const ProjectConfig& config);
+
+    // Operating point the key's state is computed at: `config` with alpha,
+    // transition locations, Mach and Re moved to the bin centres (reference
+    // atmosphere, chord and velocity chosen to match).
+    static ProjectConfig bin_centre(const BoundaryLayerKey& key,
+                                    const ProjectConfig& config);
+
+    struct KeyHash
+    {
+        size_t operator()(const BoundaryLayerKey& key) const;
+    };
+
+    struct Entry
+    {
+        BoundaryLayerState upper;  // Non-dimensional
+        BoundaryLayerState lower;
+    };
+
+    using Cache = BoundedCache<BoundaryLayerKey, Entry, KeyHash>;
+    using Stats = Cache::Stats;
+
+    Stats stats() const { return cache_.stats(); }
+    void clear() { cache_.clear(); }
+
+private:
+    BoundaryLayerCache() : cache_(CAPACITY) {}
+
+    Cache cache_;
+};
+
+}  // namespace airfoil
+}  // namespace bladenoise
@@ -2,6 +2,7 @@
 
 #include "bladenoise/airfoil/IBoundaryLayerCalculator.h"
 #include "bladenoise/math/Spline.h"
+#include <memory>
 #include <vector>
 
 namespace bladenoise {
@@ -25,6 +26,12 @@ public:
     const RealVector& get_q_inv() const { return q_inv_; }
     Real get_cl() const { return cl_; }
 
+    // Alpha-independent inviscid data of one airfoil shape (defined in the .cpp)
+    struct InviscidBasis;
+
+    // Bound of the process-wide inviscid basis store (one entry per shape)
+    static constexpr size_t INVISCID_BASIS_CAPACITY = 1024;
+
 private:
     // Boundary layer side data structure
     struct BLSide {
@@ -47,7 +54,10 @@ private:
     // Geometry setup
     bool setup_geometry(const io::AirfoilData& airfoil);
 
-    // Inviscid solution: linear-strength vortex panel method
+    // Inviscid solution: linear-strength vortex panel method.  The matrix is
+    // factored once per airfoil shape (shared across instances); each alpha
+    // is then an O(N) superposition of the 0° and 90° base solutions.
+    bool prepare_inviscid_basis();
     bool solve_inviscid(Real alpha);
 
     // Boundary layer solution
@@ -83,6 +93,7 @@ private:
     math::ParametricSpline2D airfoil_spline_;
 
     // Inviscid solution data
+    std::shared_ptr<const InviscidBasis> basis_;
     Real alpha_ = 0.0;      // Angle of attack (radians)
     Real cl_ = 0.0;         // Lift coefficient
     RealVector gamma_;       // Vortex strength at each node
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace bladenoise {
+
+// Thread-safe, size-bounded store of immutable values shared by reference.
+//
+// Lookups take a shared lock only.  Keys are compared exactly (Key must have
+// operator==); Hash only spreads them over buckets.  When the cache is full
+// the oldest entry is evicted (insertion order), which keeps hits lock-free
+// of writers.  Evicted values stay alive for as long as a caller holds them.
+//
+// get_or_compute() builds a missing value outside the lock.  Two threads
+// missing the same key may both build it; the first insert wins and both get
+// that entry.  Callers whose value is a function of the key alone therefore
+// see the same result regardless of scheduling.
+template <typename Key, typename Value, typename Hash>
+class BoundedCache
+{
+public:
+    using Ptr = std::shared_ptr<const Value>;
+
+    struct Stats
+    {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t entries = 0;
+        size_t evictions = 0;
+    };
+
+    explicit BoundedCache(size_t capacity) : capacity_(capacity > 0 ? capacity : 1) {}
+
+    BoundedCache(const BoundedCache&) = delete;
+    BoundedCache& operator=(const BoundedCache&) = delete;
+
+    // Returns the stored value, or nullptr.
+    Ptr find(const Key& key) const
+    {
+        {
+            std::shared_lock lock(mutex_);
+            auto it = entries_.find(key);
+            if (it != entries_.end())
+            {
+                hits_.fetch_add(1, std::memory_order_relaxed);
+                return it->second;
+            }
+        }
+        misses_.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    // Stores `value` unless the key is present; returns the stored entry.
+    Ptr insert(const Key& key, Ptr value)
+    {
+        std::unique_lock lock(mutex_);
+        auto [it, inserted] = entries_.emplace(key, std::move(value));
+        if (!inserted)
+        {
+            return it->second;
+        }
+
+        order_.push_back(&it->first);  // node keys survive rehashing
+        while (entries_.size() > capacity_)
+        {
+            entries_.erase(entries_.find(*order_.front()));
+            order_.pop_front();
+            ++evictions_;
+        }
+        return it->second;
+    }
+
+    // find(), or insert(make()) on a miss.  `make` returns Ptr; nullptr
+    // (failure) is passed through and not stored.
+    template <typename Make>
+    Ptr get_or_compute(const Key& key, Make&& make)
+    {
+        if (Ptr hit = find(key))
+        {
+            return hit;
+        }
+        Ptr value = std::forward<Make>(make)();
+        if (!value)
+        {
+            return nullptr;
+        }
+        return insert(key, std::move(value));
+    }
+
+    Stats stats() const
+    {
+        Stats s;
+        s.hits = hits_.load(std::memory_order_relaxed);
+        s.misses = misses_.load(std::memory_order_relaxed);
+        std::shared_lock lock(mutex_);
+        s.entries = entries_.size();
+        s.evictions = evictions_;
+        return s;
+    }
+
+    size_t size() const
+    {
+        std::shared_lock lock(mutex_);
+        return entries_.size();
+    }
+
+    size_t capacity() const { return capacity_; }
+
+    void clear()
+    {
+        std::unique_lock lock(mutex_);
+        entries_.clear();
+        order_.clear();
+        evictions_ = 0;
+        hits_.store(0, std::memory_order_relaxed);
+        misses_.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    const size_t capacity_;
+
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<Key, Ptr, Hash> entries_;
+    std::deque<const Key*> order_;  // oldest first
+    size_t evictions_ = 0;
+    mutable std::atomic<size_t> hits_{0};
+    mutable std::atomic<size_t> misses_{0};
+};
+
+}  // namespace bladenoise
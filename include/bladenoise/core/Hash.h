@@ -0,0 +1,75 @@
+#pragma once
+
+#include "bladenoise/core/Types.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace bladenoise {
+
+// Incremental 64-bit FNV-1a.  Used for cache keys and for the checksums and
+// identities of the files SolidTurbine writes (project snapshot, checkpoint
+// journal), so the byte sequence it hashes must stay stable: integers and
+// doubles are fed in little-endian byte order regardless of the host.
+class Fnv1a
+{
+public:
+    static constexpr std::uint64_t OFFSET_BASIS = 14695981039346656037ull;
+    static constexpr std::uint64_t PRIME = 1099511628211ull;
+
+    constexpr Fnv1a() = default;
+    constexpr explicit Fnv1a(std::uint64_t seed) : h_(seed) {}
+
+    constexpr Fnv1a& bytes(std::string_view data)
+    {
+        for (char c : data)
+        {
+            h_ ^= static_cast<unsigned char>(c);
+            h_ *= PRIME;
+        }
+        return *this;
+    }
+
+    constexpr Fnv1a& u64(std::uint64_t v)
+    {
+        for (int b = 0; b < 8; ++b)
+        {
+            h_ ^= (v >> (8 * b)) & 0xffu;
+            h_ *= PRIME;
+        }
+        return *this;
+    }
+
+    // Bit pattern of the value: -0.0 and 0.0 hash differently, like the
+    // exact comparisons the caches use.
+    Fnv1a& real(Real v)
+    {
+        std::uint64_t bits;
+        std::memcpy(&bits, &v, sizeof(bits));
+        return u64(bits);
+    }
+
+    Fnv1a& reals(const Real* data, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            real(data[i]);
+        }
+        return *this;
+    }
+
+    constexpr std::uint64_t value() const { return h_; }
+
+private:
+    std::uint64_t h_ = OFFSET_BASIS;
+};
+
+// FNV-1a 64 of a byte string, optionally continuing from an earlier hash.
+constexpr std::uint64_t fnv1a(std::string_view data,
+                              std::uint64_t seed = Fnv1a::OFFSET_BASIS)
+{
+    return Fnv1a(seed).bytes(data).value();
+}
+
+}  // namespace bladenoise
@@ -61,6 +61,11 @@ namespace bladenoise
         RealVector spl;         // SPL per frequency band
         Real overall_spl = 0.0; // Overall SPL (OASPL)
 
+        // Bands with f <= directivity_crossover [Hz] scale with the
+        // low-frequency directivity, all others with the high-frequency one
+        // (0 = high-frequency throughout, infinity = low-frequency throughout)
+        Real directivity_crossover = 0.0;
+
         NoiseResult() = default;
         explicit NoiseResult(size_t n) : spl(n, -100.0), overall_spl(-100.0) {}
     };
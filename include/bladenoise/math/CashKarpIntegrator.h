@@ -0,0 +1,185 @@
+#pragma once
+
+#include "bladenoise/core/Types.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+namespace bladenoise {
+namespace math {
+
+// Adaptive Cash-Karp Runge-Kutta integrator for a fixed, small state size.
+//
+// Same algorithm and arithmetic as ODEIntegrator::odeint / rkqs / rkck
+// (Numerical Recipes), but the state and all stage buffers are std::arrays
+// on the stack and the derivative functor is a template parameter, so a
+// call performs no heap allocation and the right-hand side can be inlined.
+//
+// Derivs: callable as derivs(Real x, const State& y, State& dydx).
+template <std::size_t N>
+class CashKarpIntegrator {
+public:
+    using State = std::array<Real, N>;
+
+    // Integrate ystart from x1 to x2 with relative accuracy eps, starting
+    // with step h1.  Returns false on step-size underflow or too many steps.
+    template <class Derivs>
+    bool integrate(State& ystart, Real x1, Real x2, Real eps, Real h1,
+                   Derivs&& derivs)
+    {
+        Real x = x1;
+        Real h = std::copysign(h1, x2 - x1);
+        nok_ = 0;
+        nbad_ = 0;
+
+        State y = ystart;
+        State dydx;
+        State yscal;
+
+        for (int nstp = 0; nstp < MAXSTP; ++nstp) {
+            derivs(x, y, dydx);
+
+            for (std::size_t i = 0; i < N; ++i) {
+                yscal[i] = std::abs(y[i]) + std::abs(h * dydx[i]) + TINY;
+            }
+
+            if ((x + h - x2) * (x + h - x1) > 0.0) {
+                h = x2 - x;
+            }
+
+            Real hdid, hnext;
+            if (!step(y, dydx, x, h, eps, yscal, hdid, hnext, derivs)) {
+                return false;
+            }
+
+            if (hdid == h) {
+                ++nok_;
+            } else {
+                ++nbad_;
+            }
+
+            if ((x - x2) * (x2 - x1) >= 0.0) {
+                ystart = y;
+                return true;
+            }
+
+            h = hnext;
+        }
+
+        error_ = "Too many steps in CashKarpIntegrator";
+        return false;
+    }
+
+    int good_steps() const { return nok_; }
+    int bad_steps() const { return nbad_; }
+    const char* get_error() const { return error_; }
+
+private:
+    static constexpr int MAXSTP = 10000;
+    static constexpr Real TINY = 1.0e-30;
+
+    // Quality-controlled step (rkqs)
+    template <class Derivs>
+    bool step(State& y, const State& dydx, Real& x, Real htry, Real eps,
+              const State& yscal, Real& hdid, Real& hnext, Derivs& derivs)
+    {
+        constexpr Real SAFETY = 0.9;
+        constexpr Real PGROW = -0.2;
+        constexpr Real PSHRNK = -0.25;
+        constexpr Real ERRCON = 1.89e-4;  // (5/SAFETY)^(1/PGROW)
+
+        State yerr;
+        State ytemp;
+        Real h = htry;
+
+        while (true) {
+            cash_karp(y, dydx, x, h, ytemp, yerr, derivs);
+
+            Real errmax = 0.0;
+            for (std::size_t i = 0; i < N; ++i) {
+                errmax = std::max(errmax, std::abs(yerr[i] / yscal[i]));
+            }
+            errmax /= eps;
+
+            if (errmax <= 1.0) {
+                hdid = h;
+                hnext = errmax > ERRCON ? SAFETY * h * std::pow(errmax, PGROW)
+                                        : 5.0 * h;
+                x += h;
+                y = ytemp;
+                return true;
+            }
+
+            Real htemp = SAFETY * h * std::pow(errmax, PSHRNK);
+            h = (h >= 0.0) ? std::max(htemp, 0.1 * h) : std::min(htemp, 0.1 * h);
+
+            if (x + h == x) {
+                error_ = "Stepsize underflow in CashKarpIntegrator";
+                return false;
+            }
+        }
+    }
+
+    // Fifth-order Cash-Karp step with embedded fourth-order error (rkck)
+    template <class Derivs>
+    static void cash_karp(const State& y, const State& dydx, Real x, Real h,
+                          State& yout, State& yerr, Derivs& derivs)
+    {
+        constexpr Real A2 = 0.2, A3 = 0.3, A4 = 0.6, A5 = 1.0, A6 = 0.875;
+        constexpr Real B21 = 0.2;
+        constexpr Real B31 = 3.0 / 40.0, B32 = 9.0 / 40.0;
+        constexpr Real B41 = 0.3, B42 = -0.9, B43 = 1.2;
+        constexpr Real B51 = -11.0 / 54.0, B52 = 2.5, B53 = -70.0 / 27.0, B54 = 35.0 / 27.0;
+        constexpr Real B61 = 1631.0 / 55296.0, B62 = 175.0 / 512.0, B63 = 575.0 / 13824.0;
+        constexpr Real B64 = 44275.0 / 110592.0, B65 = 253.0 / 4096.0;
+        constexpr Real C1 = 37.0 / 378.0, C3 = 250.0 / 621.0, C4 = 125.0 / 594.0, C6 = 512.0 / 1771.0;
+        constexpr Real DC1 = C1 - 2825.0 / 27648.0;
+        constexpr Real DC3 = C3 - 18575.0 / 48384.0;
+        constexpr Real DC4 = C4 - 13525.0 / 55296.0;
+        constexpr Real DC5 = -277.0 / 14336.0;
+        constexpr Real DC6 = C6 - 0.25;
+
+        State ak2, ak3, ak4, ak5, ak6, ytemp;
+
+        for (std::size_t i = 0; i < N; ++i) {
+            ytemp[i] = y[i] + B21 * h * dydx[i];
+        }
+        derivs(x + A2 * h, ytemp, ak2);
+
+        for (std::size_t i = 0; i < N; ++i) {
+            ytemp[i] = y[i] + h * (B31 * dydx[i] + B32 * ak2[i]);
+        }
+        derivs(x + A3 * h, ytemp, ak3);
+
+        for (std::size_t i = 0; i < N; ++i) {
+            ytemp[i] = y[i] + h * (B41 * dydx[i] + B42 * ak2[i] + B43 * ak3[i]);
+        }
+        derivs(x + A4 * h, ytemp, ak4);
+
+        for (std::size_t i = 0; i < N; ++i) {
+            ytemp[i] = y[i] + h * (B51 * dydx[i] + B52 * ak2[i] + B53 * ak3[i] + B54 * ak4[i]);
+        }
+        derivs(x + A5 * h, ytemp, ak5);
+
+        for (std::size_t i = 0; i < N; ++i) {
+            ytemp[i] = y[i] + h * (B61 * dydx[i] + B62 * ak2[i] + B63 * ak3[i] + B64 * ak4[i] + B65 * ak5[i]);
+        }
+        derivs(x + A6 * h, ytemp, ak6);
+
+        for (std::size_t i = 0; i < N; ++i) {
+            yout[i] = y[i] + h * (C1 * dydx[i] + C3 * ak3[i] + C4 * ak4[i] + C6 * ak6[i]);
+        }
+
+        for (std::size_t i = 0; i < N; ++i) {
+            yerr[i] = h * (DC1 * dydx[i] + DC3 * ak3[i] + DC4 * ak4[i] + DC5 * ak5[i] + DC6 * ak6[i]);
+        }
+    }
+
+    int nok_ = 0;
+    int nbad_ = 0;
+    const char* error_ = "";
+};
+
+}  // namespace math
+}  // namespace bladenoise
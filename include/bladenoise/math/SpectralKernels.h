@@ -0,0 +1,240 @@
+#pragma once
+
+#include "bladenoise/core/Constants.h"
+#include "bladenoise/core/Types.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+namespace bladenoise {
+namespace math {
+namespace spectral {
+
+// Whole-spectrum building blocks shared by the BPM noise sources.
+//
+// Every band-dependent argument of the BPM fits is log10(f) plus a
+// per-call constant (e.g. log10(St/St_peak) = log10 f + log10(delta*/(U St_peak))),
+// so the log of the band centres is tabulated at compile time and the
+// per-band work reduces to a few multiply-adds.  The piecewise curve fits are
+// written branch-free (all pieces evaluated, one selected) so the band loops
+// vectorize.
+
+namespace detail {
+
+constexpr Real LN2 = 0.693147180559945309417;
+
+// ln(x) for x > 0, usable in constant expressions: reduce to [1, 2) by
+// powers of two, then ln(m) = 2 atanh((m - 1) / (m + 1)).
+constexpr Real ln(Real x)
+{
+    int k = 0;
+    while (x >= 2.0) { x *= 0.5; ++k; }
+    while (x < 1.0) { x *= 2.0; --k; }
+
+    const Real z = (x - 1.0) / (x + 1.0);
+    const Real z2 = z * z;
+    Real term = z;
+    Real sum = 0.0;
+    for (int n = 1; n < 60; n += 2) {
+        sum += term / n;
+        term *= z2;
+    }
+    return 2.0 * sum + k * LN2;
+}
+
+}  // namespace detail
+
+constexpr Real LN10 = 2.302585092994045684018;
+constexpr Real DB_TO_LN = LN10 / 10.0;   // 10^(L/10) == exp(L * DB_TO_LN)
+
+constexpr Real log10_constexpr(Real x) { return detail::ln(x) / LN10; }
+
+constexpr std::size_t NUM_BANDS = constants::THIRD_OCTAVE_BANDS.size();
+
+// log10 of the standard one-third octave band centres
+inline constexpr std::array<Real, NUM_BANDS> LOG10_THIRD_OCTAVE_BANDS = [] {
+    std::array<Real, NUM_BANDS> out{};
+    for (std::size_t i = 0; i < NUM_BANDS; ++i)
+        out[i] = log10_constexpr(constants::THIRD_OCTAVE_BANDS[i]);
+    return out;
+}();
+
+// log10 of each frequency; taken from the table for the standard bands.
+inline void log10_frequencies(const RealVector& frequencies, RealVector& out)
+{
+    const std::size_t n = frequencies.size();
+    out.resize(n);
+    if (n == NUM_BANDS &&
+        std::equal(frequencies.begin(), frequencies.end(),
+                   constants::THIRD_OCTAVE_BANDS.begin())) {
+        std::copy(LOG10_THIRD_OCTAVE_BANDS.begin(), LOG10_THIRD_OCTAVE_BANDS.end(),
+                  out.begin());
+        return;
+    }
+    for (std::size_t i = 0; i < n; ++i)
+        out[i] = std::log10(frequencies[i]);
+}
+
+//==============================================================================
+// Level <-> mean-square pressure
+//==============================================================================
+
+// Switched-off bands are written as FLOOR_DB.  Levels at or below
+// INACTIVE_DB count as off wherever spectra are summed, compared or
+// interpolated; the 1 dB margin absorbs rounding of the floor.
+constexpr Real FLOOR_DB = -100.0;
+constexpr Real INACTIVE_DB = -99.0;
+
+inline Real from_dB(Real level) { return std::exp(level * DB_TO_LN); }
+inline Real to_dB(Real pressure_ratio) { return std::log(pressure_ratio) / DB_TO_LN; }
+
+// 10 log10(sum 10^(L/10)) over levels above `floor`; FLOOR_DB if none are.
+inline Real energy_sum(const Real* levels, std::size_t n, Real floor = INACTIVE_DB)
+{
+    Real sum = 0.0;
+    for (std::size_t i = 0; i < n; ++i)
+        sum += levels[i] > floor ? from_dB(levels[i]) : 0.0;
+    return sum > 0.0 ? to_dB(sum) : FLOOR_DB;
+}
+
+// A-weighting correction [dB] (IEC 61672, matches Python calc_weight_A):
+//   RA(f) = 12200^2 f^4 /
+//           [(f^2 + 20.6^2) sqrt((f^2 + 107.7^2)(f^2 + 737.9^2)) (f^2 + 12200^2)]
+//   A(f)  = 2 + 20 log10(RA(f))
+inline Real a_weighting(Real f)
+{
+    constexpr Real F1 = 20.6;
+    constexpr Real F2 = 107.7;
+    constexpr Real F3 = 737.9;
+    constexpr Real F4 = 12200.0;
+
+    const Real f2 = f * f;
+    const Real ra = F4 * F4 * f2 * f2 /
+                    ((f2 + F1 * F1) * std::sqrt((f2 + F2 * F2) * (f2 + F3 * F3)) *
+                     (f2 + F4 * F4));
+    return 2.0 + 20.0 * std::log10(ra);
+}
+
+//==============================================================================
+// BPM spectral shapes (Brooks, Pope & Marcolini 1989), branch-free
+//==============================================================================
+
+// A-curve, minimum / maximum (Fortran AMIN / AMAX)
+inline Real a_min(Real a)
+{
+    const Real x = std::abs(a);
+    const Real r1 = std::sqrt(std::max(67.552 - 886.788 * x * x, 0.0)) - 8.219;
+    const Real r2 = -32.665 * x + 3.981;
+    const Real r3 = ((-142.795 * x + 103.656) * x - 57.757) * x + 6.006;
+    return x <= 0.204 ? r1 : (x <= 0.244 ? r2 : r3);
+}
+
+inline Real a_max(Real a)
+{
+    const Real x = std::abs(a);
+    const Real r1 = std::sqrt(std::max(67.552 - 886.788 * x * x, 0.0)) - 8.219;
+    const Real r2 = -15.901 * x + 1.098;
+    const Real r3 = ((-4.669 * x + 3.491) * x - 16.699) * x + 1.149;
+    return x <= 0.13 ? r1 : (x <= 0.321 ? r2 : r3);
+}
+
+// B-curve, minimum / maximum (Fortran BMIN / BMAX)
+inline Real b_min(Real b)
+{
+    const Real x = std::abs(b);
+    const Real r1 = std::sqrt(std::max(16.888 - 886.788 * x * x, 0.0)) - 4.109;
+    const Real r2 = -83.607 * x + 8.138;
+    const Real r3 = ((-817.81 * x + 355.21) * x - 135.024) * x + 10.619;
+    return x <= 0.13 ? r1 : (x <= 0.145 ? r2 : r3);
+}
+
+inline Real b_max(Real b)
+{
+    const Real x = std::abs(b);
+    const Real r1 = std::sqrt(std::max(16.888 - 886.788 * x * x, 0.0)) - 4.109;
+    const Real r2 = -31.313 * x + 1.854;
+    const Real r3 = ((-80.541 * x + 44.174) * x - 39.381) * x + 2.344;
+    return x <= 0.1 ? r1 : (x <= 0.187 ? r2 : r3);
+}
+
+// LBL-VS spectral shape G1 as a function of log10(St'/St'_peak)
+inline Real g1(Real log_e)
+{
+    constexpr Real E1 = log10_constexpr(0.5974);
+    constexpr Real E2 = log10_constexpr(0.8545);
+    constexpr Real E3 = log10_constexpr(1.17);
+    constexpr Real E4 = log10_constexpr(1.674);
+
+    const Real r1 = 39.8 * log_e - 11.12;
+    const Real r2 = 98.409 * log_e + 2.0;
+    const Real r3 = -5.076 + std::sqrt(std::max(2.484 - 506.25 * log_e * log_e, 0.0));
+    const Real r4 = -98.409 * log_e + 2.0;
+    const Real r5 = -39.8 * log_e - 11.12;
+    return log_e <= E1 ? r1
+         : log_e <= E2 ? r2
+         : log_e <= E3 ? r3
+         : log_e <= E4 ? r4
+         : r5;
+}
+
+// Bluntness spectral shape G5: the h/delta* dependent coefficients are
+// constant over the spectrum and evaluated once (Fortran G5COMP).
+struct G5Shape
+{
+    Real mu = 0.0;
+    Real m = 0.0;
+    Real eta0 = 0.0;
+    Real k = 0.0;
+};
+
+inline G5Shape g5_shape(Real hdstar)
+{
+    G5Shape s;
+
+    if (hdstar < 0.25)
+        s.mu = 0.1211;
+    else if (hdstar <= 0.62)
+        s.mu = -0.2175 * hdstar + 0.1755;
+    else if (hdstar < 1.15)
+        s.mu = -0.0308 * hdstar + 0.0596;
+    else
+        s.mu = 0.0242;
+
+    if (hdstar <= 0.02)
+        s.m = 0.0;
+    else if (hdstar < 0.5)
+        s.m = 68.724 * hdstar - 1.35;
+    else if (hdstar <= 0.62)
+        s.m = 308.475 * hdstar - 121.23;
+    else if (hdstar <= 1.15)
+        s.m = 224.811 * hdstar - 69.354;
+    else if (hdstar < 1.2)
+        s.m = 1583.28 * hdstar - 1631.592;
+    else
+        s.m = 268.344;
+    s.m = std::max(s.m, 0.0);
+
+    const Real m2mu2 = s.m * s.m * s.mu * s.mu;
+    s.eta0 = -std::sqrt((m2mu2 * s.mu * s.mu) / (6.25 + m2mu2));
+    s.k = 2.5 * std::sqrt(1.0 - (s.eta0 / s.mu) * (s.eta0 / s.mu)) - 2.5 - s.m * s.eta0;
+    return s;
+}
+
+// G5 at eta = log10(St'''/St'''_peak)
+inline Real g5(const G5Shape& s, Real eta)
+{
+    const Real q = eta / s.mu;
+    const Real r1 = s.m * eta + s.k;
+    const Real r2 = 2.5 * std::sqrt(std::max(1.0 - q * q, 0.0)) - 2.5;
+    const Real r3 = std::sqrt(std::max(1.5625 - 1194.99 * eta * eta, 0.0)) - 1.25;
+    const Real r4 = -155.543 * eta + 4.375;
+    return eta <= s.eta0 ? r1
+         : eta <= 0.0 ? r2
+         : eta <= 0.03616 ? r3
+         : r4;
+}
+
+}  // namespace spectral
+}  // namespace math
+}  // namespace bladenoise
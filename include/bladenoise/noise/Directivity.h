@@ -12,6 +12,12 @@ public:
 
     // Low-frequency directivity (BPM Eq. 2)
     static Real low_frequency(Real mach, Real theta, Real phi);
+
+    // Same factors from the observer direction cosines, for callers that
+    // have the direction as a vector: cos_theta towards the trailing edge,
+    // sin2_prod = sin^2(theta) * sin^2(phi)
+    static Real high_frequency_cos(Real mach, Real cos_theta, Real sin2_prod);
+    static Real low_frequency_cos(Real mach, Real cos_theta, Real sin2_prod);
 };
 
 }  // namespace noise
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "bladenoise/core/BoundedCache.h"
+#include "bladenoise/core/Types.h"
+#include "bladenoise/io/IOTypes.h"
+#include <Eigen/Dense>
+#include <cstddef>
+#include <memory>
+
+namespace bladenoise {
+namespace potential {
+
+// Angle-of-attack independent part of the panel problem for one airfoil
+// shape: the splined panel geometry at zero incidence and the LU-factorized
+// influence matrix.  The kernel only depends on relative panel positions and
+// normals, so it is invariant under the rigid rotation PotentialFlowSolver
+// applies for the angle of attack — one factorization serves every
+// operating point of a blade section.
+struct PanelKernel
+{
+    // Flow panel geometry at alpha = 0
+    RealVector swork, yc1, yc2, nc1, nc2, tc1, tc2, d2yc1, d2yc2, ds;
+
+    // Acoustic panel geometry at alpha = 0
+    RealVector sworkat, yc1at, yc2at, nc1at, nc2at, tc1at, tc2at, d2yc1at, d2yc2at;
+
+    // Wake point at infinity and wake normal at alpha = 0
+    Real ywinf1 = 0.0, ywinf2 = 0.0;
+    Real ywn1 = 0.0, ywn2 = 0.0;
+
+    // Factorized influence matrix (SETMAT + dgetrf)
+    Eigen::PartialPivLU<Eigen::MatrixXd> lu;
+};
+
+// Everything a PanelKernel is built from: the flow panel count and the
+// num_points input coordinates the splines are fitted through.  Trailing
+// entries of AirfoilData::x/y beyond num_points are not part of the key.
+struct PanelKernelKey
+{
+    int num_panels = 0;
+    RealVector x;
+    RealVector y;
+
+    PanelKernelKey(const io::AirfoilData& airfoil, int num_panels);
+
+    bool operator==(const PanelKernelKey& other) const = default;
+};
+
+struct PanelKernelKeyHash
+{
+    size_t operator()(const PanelKernelKey& key) const;
+};
+
+// Process-wide, thread-safe store of PanelKernel objects.  Entries are
+// immutable once inserted and shared read-only by all solver instances.  The
+// store is bounded: a run touches one shape per blade section, so CAPACITY
+// covers any realistic blade while sweeps over many shapes cannot grow it
+// without limit.
+class PanelKernelCache
+{
+public:
+    static constexpr size_t CAPACITY = 256;
+
+    using Cache = BoundedCache<PanelKernelKey, PanelKernel, PanelKernelKeyHash>;
+
+    static Cache& instance();
+
+private:
+    PanelKernelCache() = delete;
+};
+
+}  // namespace potential
+}  // namespace bladenoise
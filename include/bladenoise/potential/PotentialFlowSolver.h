@@ -3,6 +3,7 @@
 #include "bladenoise/core/Types.h"
 #include "bladenoise/core/ProjectConfig.h"
 #include "bladenoise/io/IOTypes.h"
+#include "bladenoise/potential/PanelKernelCache.h"
 #include <Eigen/Dense>
 #include <memory>
 #include <string>
@@ -18,7 +19,9 @@ public:
 
     explicit PotentialFlowSolver(int num_panels = 200);
 
-    // Setup geometry from airfoil data and config
+    // Setup geometry from airfoil data and config.  The factorized influence
+    // matrix is taken from PanelKernelCache when this airfoil shape has been
+    // seen before; only the rotation into the angle of attack is redone.
     bool setup_geometry(const io::AirfoilData& airfoil, const ProjectConfig& config);
 
     // Solve the potential flow
@@ -40,8 +43,25 @@ private:
     void setup_gauss_quadrature();
     void setup_derivative_coefficients();
 
+    // Geometry / kernel caching
+    bool build_reference_geometry(const io::AirfoilData& airfoil);
+    std::shared_ptr<const PanelKernel> build_kernel(const io::AirfoilData& airfoil);
+    void apply_incidence(const PanelKernel& kernel, Real alpha);
+
+    // Gauss nodes of every flow panel, laid out [panel * ng + node] so the
+    // far-field kernel of one control point is a single contiguous loop.
+    struct PanelQuadrature {
+        RealVector s1, s2;          // Integration limits per panel
+        RealVector cent1, cent2;    // Panel midpoint (near-field test)
+        RealVector len2;            // (s2 - s1)^2
+        RealVector y1, y2;          // Node positions
+        RealVector n1, n2;          // Node normals (unnormalized, d/ds)
+        RealVector w1, w2, w3, w4;  // Weight * Hermite basis / (2 pi)
+    };
+
     // Panel method
-    void build_influence_matrix();
+    void build_panel_quadrature(PanelQuadrature& quad) const;
+    void build_influence_matrix(Eigen::MatrixXd& kern);
     void setup_rhs();
     bool solve_system();
     void compute_pressure_distribution();
@@ -57,12 +77,24 @@ private:
                                   Real n1, Real n2,
                                   Real& dipok, Real& v1, Real& v2,
                                   Real& dv1d1, Real& dv1d2,
-                                  Real& dv2d1, Real& dv2d2);
+                                  Real& dv2d1, Real& dv2d2) const;
+
+    // Surface panel midpoints as seen by the streamline velocity sum; they do
+    // not change along a streamline, so they are evaluated once per solve.
+    struct StreamlinePanels {
+        RealVector y1, y2;   // Midpoint position
+        RealVector n1, n2;   // Normal (unnormalized, d/ds)
+        RealVector pot;      // Surface potential
+        RealVector ds;       // Panel length in s
+    };
 
     // Streamline computation
     void compute_streamlines(int npath, Real dpath, io::StreamlineData& streamlines);
-    void integrate_streamline(Real dt, RealVector& str1, RealVector& str2,
-                             RealVector& ps);
+    Real find_stagnation_point() const;
+    void build_streamline_panels(StreamlinePanels& panels) const;
+    void integrate_streamline(Real dt, const StreamlinePanels& panels,
+                             RealVector& str1, RealVector& str2,
+                             RealVector& ps) const;
 
     // Spline utilities (matching original Fortran SPL_P, SPL_PP, SPL_EX, SPL_EX1)
     void spline_setup(const RealVector& x, const RealVector& y, int n, RealVector& d2y);
@@ -103,10 +135,8 @@ private:
     RealVector d2pots_;   // Spline of potential
 
     // Linear system
-    Eigen::MatrixXd Kern_;
     Eigen::VectorXd rhs_;
-    std::vector<int> ipiv_;
-    std::unique_ptr<Eigen::PartialPivLU<Eigen::MatrixXd>> lu_solver_;
+    std::shared_ptr<const PanelKernel> kernel_;  // shared, read-only LU + reference geometry
 
     // Gaussian quadrature
     std::vector<RealVector> td_;  // Quadrature points
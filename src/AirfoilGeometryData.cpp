@@ -231,6 +231,12 @@ const std::vector<AirfoilCoordinate>& AirfoilGeometryData::getScaledAndRotatedCo
 
 const std::vector<std::string>& AirfoilGeometryData::getHeaders() const { return headers; }
 
+bool AirfoilGeometryData::getCoordinateOrientation() const { return coordinateOrientation; }
+
+void AirfoilGeometryData::setCoordinateOrientation(bool isDefault) { coordinateOrientation = isDefault; }
+
+void AirfoilGeometryData::setScaledCoordinates(std::vector<AirfoilCoordinate> coords) { scaledCoordinates = std::move(coords); }
+
 std::string AirfoilGeometryData::getTypeName() const  { return "AirfoilGeometry"; }
 
 size_t AirfoilGeometryData::getRowCount() const  { return coordinates.size(); }
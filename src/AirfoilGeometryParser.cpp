@@ -1,75 +1,67 @@
 #include "AirfoilGeometryParser.h"
 
-std::vector<std::string> AirfoilGeometryParser::tokenizeLine(const std::string& line) const {
-    std::vector<std::string> tokens;
-    std::istringstream iss(line);
-    std::string token;
-
-    while (iss >> token) {
-        tokens.push_back(token);
-    }
-
-    return tokens;
+void AirfoilGeometryParser::tokenizeLine(std::string_view line, std::vector<std::string_view>& tokens) const {
+    text::splitWhitespace(line, tokens);
 }
 
-bool AirfoilGeometryParser::isCoordinateLine(const std::vector<std::string>& tokens) const {
+bool AirfoilGeometryParser::isCoordinateLine(const std::vector<std::string_view>& tokens) const {
     return tokens.size() >= 3 && tokens[0] == "DEF";
 }
 
-bool AirfoilGeometryParser::isMarkerLine(const std::vector<std::string>& tokens) const {
+bool AirfoilGeometryParser::isMarkerLine(const std::vector<std::string_view>& tokens) const {
     return tokens.size() >= 3 && tokens[0] == "MARKER";
 }
 
-bool AirfoilGeometryParser::isHeaderLine(const std::vector<std::string>& tokens) const {
+bool AirfoilGeometryParser::isHeaderLine(const std::vector<std::string_view>& tokens) const {
     return tokens.size() >= 2 && (tokens[0] == "NAME" || tokens[0] == "RELDICKE");
 }
 
 std::unique_ptr<IStructuredData> AirfoilGeometryParser::parseFile(const std::string& filePath) {
-    std::ifstream file(filePath);
-    if (!file.is_open()) {
+    std::unique_ptr<MappedTextFile> file;
+    try { file = std::make_unique<MappedTextFile>(filePath); }
+    catch (const std::runtime_error&) {
         throw std::runtime_error("Cannot open airfoil geometry file: " + filePath);
     }
 
     auto airfoilData = std::make_unique<AirfoilGeometryData>();
-    std::string line;
-    size_t lineNumber = 0;
+    LineScanner lines(file->text());
+    std::string_view line;
+    std::vector<std::string_view> tokens;
 	int idx = 0; // Index for coordinates, used to track order
     bool nosePointExists = false;
 
-    while (std::getline(file, line)) {
-        ++lineNumber;
-
+    while (lines.next(line)) {
         // Skip empty lines
         if (line.empty()) continue;
 
         // Handle comment lines
         if (line[0] == '#') {
-            airfoilData->addHeader(line);
+            airfoilData->addHeader(std::string(line));
             continue;
         }
 
         try {
-            auto tokens = tokenizeLine(line);
+            tokenizeLine(line, tokens);
             if (tokens.empty()) continue;
 
             // Parse different line types
             if (isHeaderLine(tokens)) {
                 if (tokens[0] == "NAME") {
-                    airfoilData->setName(tokens[1]);
+                    airfoilData->setName(std::string(tokens[1]));
                 }
                 else if (tokens[0] == "RELDICKE") {
-                    airfoilData->setRelativeThickness(std::stod(tokens[1]));
+                    airfoilData->setRelativeThickness(text::toDouble(tokens[1]));
                 }
             }
             else if (isMarkerLine(tokens)) {
-                std::string markerType = tokens[1];
-                int markerIndex = std::stoi(tokens[2]);
+                std::string markerType(tokens[1]);
+                int markerIndex = text::toInt(tokens[2]);
                 airfoilData->addMarker(markerType, markerIndex);
             }
             else if (isCoordinateLine(tokens)) {
 				idx += 1; // Increment index for each coordinate
-                double x = std::stod(tokens[1]);
-                double y = std::stod(tokens[2]);
+                double x = text::toDouble(tokens[1]);
+                double y = text::toDouble(tokens[2]);
                 if (x == 0 && y == 0) {
                     nosePointExists = true;
 				}
@@ -79,11 +71,11 @@ std::unique_ptr<IStructuredData> AirfoilGeometryParser::parseFile(const std::str
         }
         catch (const std::exception& e) {
             throw std::runtime_error("Error parsing airfoil geometry line " +
-                std::to_string(lineNumber) + " in file " + filePath +
+                std::to_string(lines.lineNumber()) + " in file " + filePath +
                 ": " + e.what());
         }
     }
-    file.close();
+    file.reset();
 
     if (airfoilData->getRowCount() == 0) {
         throw std::runtime_error("No valid airfoil coordinate data found in file: " + filePath);
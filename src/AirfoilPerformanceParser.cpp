@@ -1,123 +1,101 @@
 #include "AirfoilPerformanceParser.h"
+#include "FileListLoader.h"
 
 
 // ---------------------------------------------------------------------------
 // Private helpers
 // ---------------------------------------------------------------------------
 
-std::vector<std::string> AirfoilPerformanceParser::tokenizeLine(const std::string& line, char delimiter) const {
-    std::vector<std::string> tokens;
-    std::stringstream ss(line);
-    std::string token;
-
-    while (std::getline(ss, token, delimiter)) {
-        token.erase(0, token.find_first_not_of(" \t"));
-        const auto last = token.find_last_not_of(" \t");
-        if (last != std::string::npos)
-            token.erase(last + 1);
-        else
-            token.clear();
-        if (!token.empty())
-            tokens.push_back(token);
-        }
+void AirfoilPerformanceParser::tokenizeLine(std::string_view line,
+                                            std::vector<std::string_view>& tokens,
+                                            char delimiter) const {
+    text::splitFields(line, delimiter, tokens);
 
     // Tab delimiter produced no split — fall back to space
     if (tokens.size() <= 1 && delimiter == '\t')
-        return tokenizeLine(line, ' ');
-
-    return tokens;
+        text::splitFields(line, ' ', tokens);
 }
 
-bool AirfoilPerformanceParser::isHeaderLine(const std::vector<std::string>& tokens) const {
+bool AirfoilPerformanceParser::isHeaderLine(const std::vector<std::string_view>& tokens) const {
     return tokens.size() >= 2 && (
         tokens[0] == "REFNUM" || tokens[0] == "XA"     || tokens[0] == "THICK" ||
         tokens[0] == "REYN"   || tokens[0] == "DEPANG" || tokens[0] == "NALPHA" ||
         tokens[0] == "NVALS");
 }
 
-bool AirfoilPerformanceParser::isDataLine(const std::vector<std::string>& tokens) const {
-    if (tokens.size() < 4) return false;
-    try { std::stod(tokens[0]); return true; }
-    catch (...) { return false; }
+bool AirfoilPerformanceParser::isDataLine(const std::vector<std::string_view>& tokens) const {
+    double value;
+    return tokens.size() >= 4 && text::parseDouble(tokens[0], value);
 }
 
 AirfoilPerformanceParser::PolarFormat
-AirfoilPerformanceParser::detectFormat(const std::string& firstContentLine) const {
-    // Tecplot files start with   TITLE=   (case-insensitive check on first 6 chars)
-    if (firstContentLine.size() >= 6) {
-        std::string prefix = firstContentLine.substr(0, 6);
-        std::transform(prefix.begin(), prefix.end(), prefix.begin(), ::toupper);
-        if (prefix == "TITLE=")
-            return PolarFormat::Tecplot;
-    }
+AirfoilPerformanceParser::detectFormat(std::string_view firstContentLine) const {
+    // Tecplot files start with   TITLE=   (case-insensitive)
+    if (text::startsWithNoCase(firstContentLine, "TITLE="))
+        return PolarFormat::Tecplot;
     return PolarFormat::Native;
 }
 
-bool AirfoilPerformanceParser::extractAuxDataValue(const std::string& line,
-                                                    const std::string& key,
-                                                    std::string& value) const {
+bool AirfoilPerformanceParser::extractAuxDataValue(std::string_view line,
+                                                    std::string_view key,
+                                                    std::string_view& value) const {
     // Line format:  AUXDATA key="value"
     // Find the key (case-insensitive)
-    std::string lineLower = line;
-    std::string keyLower  = key;
-    std::transform(lineLower.begin(), lineLower.end(), lineLower.begin(), ::tolower);
-    std::transform(keyLower.begin(),  keyLower.end(),  keyLower.begin(),  ::tolower);
-
-    auto keyPos = lineLower.find(keyLower);
-    if (keyPos == std::string::npos) return false;
+    auto keyPos = text::findNoCase(line, key);
+    if (keyPos == std::string_view::npos) return false;
 
     // After the key there should be  ="value"
     auto eqPos = line.find('=', keyPos);
-    if (eqPos == std::string::npos) return false;
+    if (eqPos == std::string_view::npos) return false;
 
     auto q1 = line.find('"', eqPos);
+    if (q1 == std::string_view::npos) return false;
     auto q2 = line.find('"', q1 + 1);
-    if (q1 == std::string::npos || q2 == std::string::npos) return false;
+    if (q2 == std::string_view::npos) return false;
 
     value = line.substr(q1 + 1, q2 - q1 - 1);
-        return true;
-    }
+    return true;
+}
 
 
 // ---------------------------------------------------------------------------
 // Native keyword format
 // ---------------------------------------------------------------------------
 
-void AirfoilPerformanceParser::parseNativeFormat(std::ifstream& file,
+void AirfoilPerformanceParser::parseNativeFormat(LineScanner& lines,
                                                   const std::string& filePath,
-                                                  const std::string& firstLine,
+                                                  std::string_view firstLine,
                                                   AirfoilPolarData& perfData) const
 {
     double mach    = 0.0;
     double reynolds = 0.0;
-    size_t lineNumber = 0;
+    std::vector<std::string_view> tokens;
 
-    auto processLine = [&](const std::string& line) {
-        ++lineNumber;
+    auto processLine = [&](std::string_view line) {
         if (line.empty()) return;
 
         if (line[0] == '#') {
-            perfData.addHeader(line);
+            perfData.addHeader(std::string(line));
             return;
         }
 
-        auto tokens = tokenizeLine(line);
+        tokenizeLine(line, tokens);
         if (tokens.empty()) return;
 
         if (isHeaderLine(tokens)) {
-            if      (tokens[0] == "REFNUM") { perfData.setName(tokens[1]); }
-            else if (tokens[0] == "XA")     { perfData.setXa(std::stod(tokens[1])); }
-            else if (tokens[0] == "THICK")  { perfData.setRelativeThickness(std::stod(tokens[1])); }
-            else if (tokens[0] == "REYN")   { reynolds = std::stod(tokens[1]); }
-            else if (tokens[0] == "DEPANG") { perfData.setDepang(std::stod(tokens[1])); }
-            else if (tokens[0] == "NALPHA") { perfData.setNAlpha(std::stoi(tokens[1])); }
-            else if (tokens[0] == "NVALS")  { perfData.setNVals(std::stoi(tokens[1])); }
+            if      (tokens[0] == "REFNUM") { perfData.setName(std::string(tokens[1])); }
+            else if (tokens[0] == "XA")     { perfData.setXa(text::toDouble(tokens[1])); }
+            else if (tokens[0] == "THICK")  { perfData.setRelativeThickness(text::toDouble(tokens[1])); }
+            else if (tokens[0] == "REYN")   { reynolds = text::toDouble(tokens[1]); }
+            else if (tokens[0] == "DEPANG") { perfData.setDepang(text::toDouble(tokens[1])); }
+            else if (tokens[0] == "NALPHA") { perfData.setNAlpha(text::toInt(tokens[1])); }
+            else if (tokens[0] == "NVALS")  { perfData.setNVals(text::toInt(tokens[1])); }
         }
         else if (isDataLine(tokens)) {
-            double alpha = std::stod(tokens[0]) * std::numbers::pi / 180.0;
-            double cl    = std::stod(tokens[1]);
-            double cd    = std::stod(tokens[2]);
-            double cm    = (tokens.size() > 3) ? std::stod(tokens[3]) : 0.0;
+            double alpha = text::toDouble(tokens[0]) * std::numbers::pi / 180.0;
+            double cl    = text::toDouble(tokens[1]);
+            double cd    = text::toDouble(tokens[2]);
+            double cm    = (tokens.size() > 3) ? text::toDouble(tokens[3]) : 0.0;
             perfData.addPolarPoint(AirfoilOperationCondition(reynolds, mach, alpha),
                                    AirfoilAeroCoefficients(cl, cd, cm));
         }
@@ -126,26 +104,28 @@ void AirfoilPerformanceParser::parseNativeFormat(std::ifstream& file,
     // Re-process the first line that was already read during format detection
     try { processLine(firstLine); }
     catch (const std::exception& e) {
-        throw std::runtime_error("Error parsing airfoil performance line 1 in file "
+        throw std::runtime_error("Error parsing airfoil performance line "
+                                 + std::to_string(lines.lineNumber()) + " in file "
                                  + filePath + ": " + e.what());
     }
 
-    std::string line;
-    while (std::getline(file, line)) {
+    std::string_view line;
+    while (lines.next(line)) {
         try { processLine(line); }
         catch (const std::exception& e) {
             throw std::runtime_error("Error parsing airfoil performance line "
-                                     + std::to_string(lineNumber) + " in file "
+                                     + std::to_string(lines.lineNumber()) + " in file "
                                      + filePath + ": " + e.what());
-    }
+        }
     }
 
     // Validate NALPHA consistency
     if (perfData.getNAlpha() > 0 &&
         static_cast<int>(perfData.getRowCount()) != perfData.getNAlpha()) {
-        std::cout << "Warning: NALPHA (" << perfData.getNAlpha()
-                  << ") doesn't match actual data rows (" << perfData.getRowCount()
-                  << ") in file: " << filePath << std::endl;
+        FileListLoader::warn("NALPHA (" + std::to_string(perfData.getNAlpha())
+                             + ") doesn't match actual data rows ("
+                             + std::to_string(perfData.getRowCount())
+                             + ") in file: " + filePath);
     }
 }
 
@@ -154,114 +134,99 @@ void AirfoilPerformanceParser::parseNativeFormat(std::ifstream& file,
 // Tecplot ASCII format
 // ---------------------------------------------------------------------------
 
-void AirfoilPerformanceParser::parseTecplotFormat(std::ifstream& file,
+void AirfoilPerformanceParser::parseTecplotFormat(LineScanner& lines,
                                                    const std::string& filePath,
-                                                   const std::string& firstLine,
+                                                   std::string_view firstLine,
                                                    AirfoilPolarData& perfData) const
 {
     double reynolds  = 0.0;
     double mach      = 0.0;
     bool   dataPhase = false;   // true once we have passed all header/AUXDATA lines
-    size_t lineNumber = 1;      // firstLine was line 1
+    std::vector<std::string_view> tokens;
 
     // ---- helper: strip outer quotes from a Tecplot string value ----------
-    auto stripQuotes = [](const std::string& s) -> std::string {
+    auto stripQuotes = [](std::string_view s) -> std::string_view {
         if (s.size() >= 2 && s.front() == '"' && s.back() == '"')
             return s.substr(1, s.size() - 2);
         return s;
     };
 
+    // ---- helper: alpha cl cd cm row ---------------------------------------
+    auto addDataRow = [&](std::string_view line) {
+        tokenizeLine(line, tokens, ' ');
+        if (tokens.size() < 4) return;
+
+        double alpha = text::toDouble(tokens[0]) * std::numbers::pi / 180.0;
+        double cl    = text::toDouble(tokens[1]);
+        double cd    = text::toDouble(tokens[2]);
+        double cm    = text::toDouble(tokens[3]);
+
+        perfData.addPolarPoint(
+            AirfoilOperationCondition(reynolds, mach, alpha),
+            AirfoilAeroCoefficients(cl, cd, cm));
+    };
+
     // ---- process TITLE= line (already read as firstLine) -----------------
     // Extract polar name from:  TITLE="Polarname.pol"
     {
         auto eq = firstLine.find('=');
-        if (eq != std::string::npos) {
-            std::string raw = firstLine.substr(eq + 1);
-            // trim whitespace
-            raw.erase(0, raw.find_first_not_of(" \t"));
-            perfData.setName(stripQuotes(raw));
+        if (eq != std::string_view::npos) {
+            std::string_view raw = text::trim(firstLine.substr(eq + 1), " \t");
+            perfData.setName(std::string(stripQuotes(raw)));
         }
     }
 
     // ---- read remaining lines --------------------------------------------
-    std::string line;
-    while (std::getline(file, line)) {
-        ++lineNumber;
-
-        // Trim leading/trailing whitespace (handles \r\n)
-        const auto first = line.find_first_not_of(" \t\r");
-        if (first == std::string::npos) continue;
-        const auto last  = line.find_last_not_of(" \t\r");
-        line = line.substr(first, last - first + 1);
+    std::string_view line;
+    while (lines.next(line)) {
+        // Trim leading/trailing whitespace
+        line = text::trim(line, " \t\r");
         if (line.empty()) continue;
 
         // ---- comment lines -----------------------------------------------
         if (line[0] == '#') {
-            perfData.addHeader(line);
+            perfData.addHeader(std::string(line));
             continue;
         }
 
         // ---- Once in data phase, everything is a data row ----------------
         if (dataPhase) {
-            try {
-                auto tokens = tokenizeLine(line, ' ');
-                if (tokens.size() < 4) continue;
-
-                double alpha = std::stod(tokens[0]) * std::numbers::pi / 180.0;
-                double cl    = std::stod(tokens[1]);
-                double cd    = std::stod(tokens[2]);
-                double cm    = std::stod(tokens[3]);
-
-                perfData.addPolarPoint(
-                    AirfoilOperationCondition(reynolds, mach, alpha),
-                    AirfoilAeroCoefficients(cl, cd, cm));
-                }
+            try { addDataRow(line); }
             catch (const std::exception& e) {
                 throw std::runtime_error("Error parsing Tecplot data line "
-                    + std::to_string(lineNumber) + " in file "
+                    + std::to_string(lines.lineNumber()) + " in file "
                     + filePath + ": " + e.what());
             }
             continue;
         }
 
-        // ---- uppercase prefix for keyword matching -----------------------
-        std::string lineUpper = line;
-        std::transform(lineUpper.begin(), lineUpper.end(), lineUpper.begin(), ::toupper);
-
         // VARIABLES line — validate column order, otherwise ignore
-        if (lineUpper.rfind("VARIABLES", 0) == 0) {
-            perfData.addHeader("# VARIABLES: " + line);
+        if (text::startsWithNoCase(line, "VARIABLES")) {
+            perfData.addHeader("# VARIABLES: " + std::string(line));
             continue;
         }
 
         // ZONE line — extract point count (I=) and zone title (T=)
-        if (lineUpper.rfind("ZONE", 0) == 0) {
-            // Extract I=<n>
-            auto iPos = lineUpper.find("I=");
-            if (iPos != std::string::npos) {
-                try {
-                    size_t after = iPos + 2;
-                    // skip spaces
-                    while (after < line.size() && line[after] == ' ') ++after;
-                    size_t end = after;
-                    while (end < line.size() && (std::isdigit(line[end]) || line[end] == '-')) ++end;
-                    int pointCount = std::stoi(line.substr(after, end - after));
+        if (text::startsWithNoCase(line, "ZONE")) {
+            // Extract I=<n>; non-fatal — NALPHA check is just a warning
+            auto iPos = text::findNoCase(line, "I=");
+            if (iPos != std::string_view::npos) {
+                int pointCount = 0;
+                if (text::parseInt(line.substr(iPos + 2), pointCount))
                     perfData.setNAlpha(pointCount);
-                }
-                catch (...) { /* non-fatal — NALPHA check is just a warning */ }
             }
 
             // Extract T="zoneName" — use as name only if TITLE was empty
             {
-                auto tPos = lineUpper.find(" T=");
-                if (tPos == std::string::npos) tPos = lineUpper.find("\tT=");
-                if (tPos != std::string::npos) {
+                auto tPos = text::findNoCase(line, " T=");
+                if (tPos == std::string_view::npos) tPos = text::findNoCase(line, "\tT=");
+                if (tPos != std::string_view::npos) {
                     auto q1 = line.find('"', tPos);
-                    auto q2 = (q1 != std::string::npos) ? line.find('"', q1 + 1) : std::string::npos;
-                    if (q1 != std::string::npos && q2 != std::string::npos) {
-                        std::string zoneName = line.substr(q1 + 1, q2 - q1 - 1);
+                    auto q2 = (q1 != std::string_view::npos) ? line.find('"', q1 + 1)
+                                                             : std::string_view::npos;
+                    if (q1 != std::string_view::npos && q2 != std::string_view::npos) {
                         if (perfData.getName().empty())
-                            perfData.setName(zoneName);
+                            perfData.setName(std::string(line.substr(q1 + 1, q2 - q1 - 1)));
                     }
                 }
             }
@@ -269,68 +234,50 @@ void AirfoilPerformanceParser::parseTecplotFormat(std::ifstream& file,
         }
 
         // AUXDATA lines
-        if (lineUpper.rfind("AUXDATA", 0) == 0) {
-            std::string val;
+        if (text::startsWithNoCase(line, "AUXDATA")) {
+            std::string_view val;
 
             // Reynolds number
-            if (extractAuxDataValue(line, "renum", val)) {
-                try { reynolds = std::stod(val); }
-                catch (...) {}
-            }
+            if (extractAuxDataValue(line, "renum", val))
+                text::parseDouble(val, reynolds);
 
             // Mach number  ("None" → leave at 0.0)
-            if (extractAuxDataValue(line, "ma", val) && val != "None" && val != "none") {
-                try { mach = std::stod(val); }
-                catch (...) {}
-            }
+            if (extractAuxDataValue(line, "ma", val) && val != "None" && val != "none")
+                text::parseDouble(val, mach);
 
             // Relative thickness in %
             if (extractAuxDataValue(line, "relThick", val)) {
-                try { perfData.setRelativeThickness(std::stod(val) * 100.0); }
-                catch (...) {}
+                double relThick;
+                if (text::parseDouble(val, relThick))
+                    perfData.setRelativeThickness(relThick * 100.0);
             }
 
             // Airfoil name — use as fallback if polar name not yet set
             if (extractAuxDataValue(line, "airfoil", val)) {
                 if (perfData.getName().empty() || perfData.getName() == "unnamed")
-                    perfData.setName(val);
-                }
+                    perfData.setName(std::string(val));
+            }
 
             // Preserve remaining AUXDATA as headers for traceability
             // (stallAngle, negStallAngle, designAngle, opt, tool, addons, runnum, ar, path)
-            perfData.addHeader("# " + line);
+            perfData.addHeader("# " + std::string(line));
             continue;
         }
 
         // Any other non-numeric line in the header block — store as header
-        bool isNumericStart = false;
-        if (!line.empty()) {
-            try { std::stod(tokenizeLine(line, ' ')[0]); isNumericStart = true; }
-            catch (...) {}
-            }
-
-        if (!isNumericStart) {
-            perfData.addHeader("# " + line);
+        tokenizeLine(line, tokens, ' ');
+        double firstValue;
+        if (tokens.empty() || !text::parseDouble(tokens[0], firstValue)) {
+            perfData.addHeader("# " + std::string(line));
             continue;
         }
 
         // First numeric line — enter data phase and process immediately
         dataPhase = true;
-        try {
-            auto tokens = tokenizeLine(line, ' ');
-            if (tokens.size() >= 4) {
-                double alpha = std::stod(tokens[0]) * std::numbers::pi / 180.0;
-                double cl    = std::stod(tokens[1]);
-                double cd    = std::stod(tokens[2]);
-                double cm    = std::stod(tokens[3]);
-                perfData.addPolarPoint(
-                    AirfoilOperationCondition(reynolds, mach, alpha),
-                    AirfoilAeroCoefficients(cl, cd, cm));
-            }
-        }
+        try { addDataRow(line); }
         catch (const std::exception& e) {
             throw std::runtime_error("Error parsing Tecplot data line "
-                + std::to_string(lineNumber) + " in file "
+                + std::to_string(lines.lineNumber()) + " in file "
                 + filePath + ": " + e.what());
         }
     }
@@ -338,9 +285,10 @@ void AirfoilPerformanceParser::parseTecplotFormat(std::ifstream& file,
     // Validate point count consistency
     if (perfData.getNAlpha() > 0 &&
         static_cast<int>(perfData.getRowCount()) != perfData.getNAlpha()) {
-        std::cout << "Warning: ZONE I=" << perfData.getNAlpha()
-                  << " doesn't match actual data rows (" << perfData.getRowCount()
-                  << ") in file: " << filePath << std::endl;
+        FileListLoader::warn("ZONE I=" + std::to_string(perfData.getNAlpha())
+                             + " doesn't match actual data rows ("
+                             + std::to_string(perfData.getRowCount())
+                             + ") in file: " + filePath);
     }
 }
 
@@ -350,22 +298,23 @@ void AirfoilPerformanceParser::parseTecplotFormat(std::ifstream& file,
 // ---------------------------------------------------------------------------
 
 std::unique_ptr<IStructuredData> AirfoilPerformanceParser::parseFile(const std::string& filePath) {
-    std::ifstream file(filePath);
-    if (!file.is_open())
+    std::unique_ptr<MappedTextFile> file;
+    try { file = std::make_unique<MappedTextFile>(filePath); }
+    catch (const std::runtime_error&) {
         throw std::runtime_error("Cannot open airfoil performance file: " + filePath);
+    }
 
     auto perfData = std::make_unique<AirfoilPolarData>();
+    LineScanner lines(file->text());
 
     // Find first non-empty, non-comment line for format detection
-    std::string firstLine;
-    while (std::getline(file, firstLine)) {
-        // Trim
-        const auto f = firstLine.find_first_not_of(" \t\r");
-        if (f == std::string::npos) continue;
-        const auto l = firstLine.find_last_not_of(" \t\r");
-        firstLine = firstLine.substr(f, l - f + 1);
-        if (firstLine.empty()) continue;
-        if (firstLine[0] == '#') { perfData->addHeader(firstLine); continue; }
+    std::string_view firstLine;
+    std::string_view line;
+    while (lines.next(line)) {
+        line = text::trim(line, " \t\r");
+        if (line.empty()) continue;
+        if (line[0] == '#') { perfData->addHeader(std::string(line)); continue; }
+        firstLine = line;
         break;
     }
 
@@ -375,9 +324,9 @@ std::unique_ptr<IStructuredData> AirfoilPerformanceParser::parseFile(const std::
     PolarFormat fmt = detectFormat(firstLine);
 
     if (fmt == PolarFormat::Tecplot)
-        parseTecplotFormat(file, filePath, firstLine, *perfData);
+        parseTecplotFormat(lines, filePath, firstLine, *perfData);
     else
-        parseNativeFormat(file, filePath, firstLine, *perfData);
+        parseNativeFormat(lines, filePath, firstLine, *perfData);
 
     if (perfData->getRowCount() == 0)
         throw std::runtime_error("No valid airfoil performance data found in file: " + filePath);
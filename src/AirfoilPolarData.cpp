@@ -427,6 +427,21 @@ int AirfoilPolarData::getNVals() const
     return nVals;
 }
 
+double AirfoilPolarData::getXa() const
+{
+    return xa;
+}
+
+const std::vector<std::string>& AirfoilPolarData::getHeaders() const
+{
+    return headers;
+}
+
+bool AirfoilPolarData::hasInterpolationStrategy() const
+{
+    return interpolationStrategy != nullptr;
+}
+
 
 double AirfoilPolarData::getRelativeThickness() const {
     return relativeThickness;
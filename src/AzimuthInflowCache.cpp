@@ -0,0 +1,70 @@
+/**
+ * @file AzimuthInflowCache.cpp
+ * @brief Implementation of AzimuthInflowCache.
+ */
+#include "AzimuthInflowCache.h"
+#include "FlowCalculatorFactory.h"
+
+#include <limits>
+#include <span>
+#include <stdexcept>
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Construction — section heights of every azimuth
+// ─────────────────────────────────────────────────────────────────────────────
+AzimuthInflowCache::AzimuthInflowCache(TurbineGeometry const *geometry,
+                                       std::vector<double> const &psi_vec,
+                                       FlowModifiers const &fm)
+    : hub_height_(geometry ? geometry->hub_height()
+                           : throw std::invalid_argument("AzimuthInflowCache: geometry must be non-null")),
+      num_sections_(geometry->num_sections()),
+      shear_(FlowCalculatorFactory::MakeShear(fm)),
+      veer_(FlowCalculatorFactory::MakeVeer(geometry, fm)),
+      v_inf_(std::numeric_limits<double>::quiet_NaN())
+{
+    if (psi_vec.empty())
+        throw std::invalid_argument("AzimuthInflowCache: psi_vec must not be empty");
+
+    heights_.reserve(psi_vec.size() * num_sections_);
+    for (double psi : psi_vec)
+    {
+        for (WVPMUtilities::Vec3D<double> const &p : geometry->GlobalPositionsAtPsi(psi))
+            heights_.push_back(p.z());
+    }
+    axial_.resize(heights_.size());
+    inflow_.assign(psi_vec.size(), std::vector<WVPMUtilities::Vec3D<double>>(num_sections_));
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+std::vector<WVPMUtilities::Vec3D<double>> const &
+AzimuthInflowCache::At(double v_inf, std::size_t psi_idx)
+{
+    if (v_inf < 0.0)
+        throw std::invalid_argument("AzimuthInflowCache: v_inf must be >= 0");
+    if (v_inf != v_inf_)
+        Evaluate(v_inf);
+    return inflow_.at(psi_idx);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Evaluate — one shear call over all heights, one veer call per azimuth
+//
+// Same steps as FlowCalculator for a UniformInletProvider: axial inflow
+// (v_inf, 0, 0), axial component replaced by the shear profile, then veer.
+// ─────────────────────────────────────────────────────────────────────────────
+void AzimuthInflowCache::Evaluate(double v_inf)
+{
+    shear_->VelocitiesAt(heights_, hub_height_, v_inf, axial_);
+
+    for (std::size_t k = 0; k < inflow_.size(); ++k)
+    {
+        std::vector<WVPMUtilities::Vec3D<double>> &row = inflow_[k];
+        const std::size_t base = k * num_sections_;
+        for (std::size_t i = 0; i < num_sections_; ++i)
+            row[i] = WVPMUtilities::Vec3D<double>(axial_[base + i], 0.0, 0.0);
+
+        veer_->ApplyAt(std::span<double const>(heights_).subspan(base, num_sections_),
+                       hub_height_, row);
+    }
+    v_inf_ = v_inf;
+}
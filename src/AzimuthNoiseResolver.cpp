@@ -0,0 +1,246 @@
+/**
+ * @file AzimuthNoiseResolver.cpp
+ * @brief Azimuth-resolved rotor noise — see header.
+ */
+#include "AzimuthNoiseResolver.h"
+#include "NoiseSpectrumStore.h"
+
+#include "bladenoise/math/SpectralKernels.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <numbers>
+
+namespace spectral = bladenoise::math::spectral;
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Construction
+// ─────────────────────────────────────────────────────────────────────────────
+AzimuthNoiseResolver::AzimuthNoiseResolver(SectionNoiseCalculator const &calculator,
+                                           RotorNoiseAggregator   const &aggregator,
+                                           AzimuthNoiseTolerances        tolerances,
+                                           bool                          float32_store)
+    : calculator_(calculator)
+    , aggregator_(aggregator)
+    , tolerances_(tolerances)
+    , float32_store_(float32_store)
+{}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Resolve
+// ─────────────────────────────────────────────────────────────────────────────
+AzimuthNoiseResult AzimuthNoiseResolver::Resolve(
+    PsiPostprocessResults const &psi_results,
+    TurbineGeometry       const *turbine,
+    ISimulationConfig     const &sim_config) const
+{
+    AzimuthNoiseResult out;
+    out.vinf     = psi_results.vinf;
+    out.rot_rate = psi_results.rot_rate;
+    out.n_blades = aggregator_.NumBlades();
+
+    const std::size_t n_psi = std::min(psi_results.psi_rad.size(),
+                                       psi_results.results.size());
+    if (n_psi == 0)
+        return out;
+
+    // ── One job per azimuth, built from that azimuth's own BEM state ─────────
+    std::vector<BladeNoiseJob> jobs(n_psi);
+    for (std::size_t p = 0; p < n_psi; ++p)
+    {
+        BEMPostprocessResult const &pp = psi_results.results[p];
+        jobs[p] = calculator_.Prepare(pp, turbine, sim_config, psi_results.vinf,
+                                      pp.local_velocity,
+                                      pp.local_mach,
+                                      pp.local_reynolds);
+    }
+
+    // ── Reuse plan: per section, the first azimuth of each distinct state is
+    //    computed; later azimuths within tolerance of it copy its result.
+    //    Matching is always against the computed state, so reuse never drifts.
+    struct Task
+    {
+        std::size_t psi;
+        std::size_t section;
+    };
+    std::vector<Task> tasks;
+    std::vector<std::vector<std::size_t>> source(n_psi);
+
+    std::size_t n_sec = 0;
+    for (std::size_t p = 0; p < n_psi; ++p)
+    {
+        source[p].resize(jobs[p].inputs.size());
+        for (std::size_t i = 0; i < source[p].size(); ++i)
+            source[p][i] = p;
+        n_sec = std::max(n_sec, jobs[p].inputs.size());
+    }
+
+    std::vector<std::size_t> computed;
+    for (std::size_t i = 0; i < n_sec; ++i)
+    {
+        computed.clear();
+        for (std::size_t p = 0; p < n_psi; ++p)
+        {
+            if (i >= jobs[p].inputs.size()) continue;
+            SectionNoiseInput const &inp = jobs[p].inputs[i];
+            if (inp.velocity <= 0.0) continue;   // no flow, stays non-converged
+
+            auto match = std::find_if(computed.begin(), computed.end(),
+                [&](std::size_t q) { return SameState(jobs[q].inputs[i], inp); });
+
+            if (match != computed.end())
+            {
+                source[p][i] = *match;
+                ++out.sections_reused;
+            }
+            else
+            {
+                computed.push_back(p);
+                tasks.push_back({p, i});
+            }
+        }
+    }
+    out.sections_computed = tasks.size();
+
+    // ── Optionally send the spectra straight to a store, point = azimuth ────
+    std::unique_ptr<NoiseSpectrumStore> store;
+    if (float32_store_)
+    {
+        store = std::make_unique<NoiseSpectrumStore>(
+            n_psi, n_sec, SectionNoiseCalculator::BandFrequencies());
+        for (std::size_t p = 0; p < n_psi; ++p)
+        {
+            store->BeginPoint(p, jobs[p].result);
+            jobs[p].store       = store.get();
+            jobs[p].store_point = p;
+        }
+    }
+
+    // ── Distinct states only, one dynamic pool over all azimuths ─────────────
+    const std::size_t n_tasks = tasks.size();
+
+    #pragma omp parallel for schedule(dynamic, 1)
+    for (std::size_t k = 0; k < n_tasks; ++k)
+        calculator_.CalculateSection(jobs[tasks[k].psi], tasks[k].section);
+
+    for (std::size_t p = 0; p < n_psi; ++p)
+        for (std::size_t i = 0; i < source[p].size(); ++i)
+        {
+            const std::size_t q = source[p][i];
+            if (q == p) continue;
+
+            // Spectra of the matched state; flow quantities of this azimuth
+            SectionNoiseResult       &sr  = jobs[p].result.sections[i];
+            SectionNoiseInput  const &inp = jobs[p].inputs[i];
+            sr           = jobs[q].result.sections[i];
+            sr.velocity  = inp.velocity;
+            sr.mach      = inp.mach;
+            sr.reynolds  = inp.reynolds;
+            sr.alpha_deg = inp.alpha_deg;
+
+            if (store)
+            {
+                store->CopySpectra(q, p, i);
+                store->AssignInfo(p, i, sr);
+            }
+        }
+
+    // ── Aggregate each azimuth ───────────────────────────────────────────────
+    out.psi_deg.resize(n_psi);
+    out.blade_oaspl.resize(n_psi);
+    out.blade_oasplA.resize(n_psi);
+    out.blade_lwA.resize(n_psi);
+
+    for (std::size_t p = 0; p < n_psi; ++p)
+    {
+        const BladeNoiseResult blade = calculator_.Finalize(std::move(jobs[p]));
+        const RotorNoiseResult r = store ? aggregator_.Aggregate(*store, p)
+                                         : aggregator_.Aggregate(blade);
+
+        out.psi_deg[p]      = psi_results.psi_rad[p] * 180.0 / std::numbers::pi;
+        out.blade_oaspl[p]  = r.total.oaspl;
+        out.blade_oasplA[p] = r.total.oasplA;
+        out.blade_lwA[p]    = r.total.lwA;
+    }
+
+    out.rotor_oaspl  = PhaseBlades(psi_results.psi_rad, out.blade_oaspl,  out.n_blades);
+    out.rotor_oasplA = PhaseBlades(psi_results.psi_rad, out.blade_oasplA, out.n_blades);
+    out.rotor_lwA    = PhaseBlades(psi_results.psi_rad, out.blade_lwA,    out.n_blades);
+
+    out.blade_oasplA_depth = ModulationDepth(out.blade_oasplA);
+    out.rotor_oasplA_depth = ModulationDepth(out.rotor_oasplA);
+    out.rotor_lwA_depth    = ModulationDepth(out.rotor_lwA);
+
+    return out;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Helpers
+// ─────────────────────────────────────────────────────────────────────────────
+bool AzimuthNoiseResolver::SameState(SectionNoiseInput const &a,
+                                     SectionNoiseInput const &b) const
+{
+    return std::abs(a.alpha_deg - b.alpha_deg) <= tolerances_.alpha_deg
+        && std::abs(a.mach - b.mach)           <= tolerances_.mach
+        && std::abs(a.reynolds - b.reynolds)
+               <= tolerances_.reynolds_rel * std::abs(a.reynolds);
+}
+
+std::vector<double> AzimuthNoiseResolver::PhaseBlades(
+    std::vector<double> const &psi_rad,
+    std::vector<double> const &levels,
+    int                        n_blades)
+{
+    constexpr double two_pi = 2.0 * std::numbers::pi;
+    const std::size_t n = std::min(psi_rad.size(), levels.size());
+
+    // Nearest available azimuth on the circle
+    auto nearest = [&](double psi)
+    {
+        psi = std::fmod(psi, two_pi);
+        if (psi < 0.0) psi += two_pi;
+
+        std::size_t best = 0;
+        double best_d = two_pi;
+        for (std::size_t q = 0; q < n; ++q)
+        {
+            double d = std::abs(psi_rad[q] - psi);
+            d = std::min(d, two_pi - d);
+            if (d < best_d)
+            {
+                best_d = d;
+                best   = q;
+            }
+        }
+        return best;
+    };
+
+    std::vector<double> out(n, -100.0);
+    for (std::size_t p = 0; p < n; ++p)
+    {
+        double sum = 0.0;
+        for (int b = 0; b < n_blades; ++b)
+        {
+            const double L = levels[nearest(psi_rad[p] + two_pi * b / n_blades)];
+            if (L > spectral::INACTIVE_DB) sum += spectral::from_dB(L);
+        }
+        if (sum > 0.0)
+            out[p] = spectral::to_dB(sum / n_blades);
+    }
+    return out;
+}
+
+double AzimuthNoiseResolver::ModulationDepth(std::vector<double> const &levels)
+{
+    double lo = 0.0, hi = 0.0;
+    bool any = false;
+    for (double L : levels)
+    {
+        if (L <= spectral::INACTIVE_DB) continue;
+        lo  = any ? std::min(lo, L) : L;
+        hi  = any ? std::max(hi, L) : L;
+        any = true;
+    }
+    return hi - lo;
+}
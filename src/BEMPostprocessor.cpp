@@ -27,8 +27,10 @@
 BEMPostprocessor::BEMPostprocessor(TurbineGeometry const *turbine,
                                    ISimulationConfig const *sim_config,
                                    FlowCalculator const *flow_calc,
-                                   double num_blades)
-    : turbine_(turbine), sim_config_(sim_config), flow_calc_(flow_calc), num_blades_(num_blades)
+                                   double num_blades,
+                                   PostprocessDetail detail)
+    : turbine_(turbine), sim_config_(sim_config), flow_calc_(flow_calc),
+      num_blades_(num_blades), detail_(detail)
 {
     if (!turbine_)
         throw std::invalid_argument("BEMPostprocessor: turbine must be non-null");
@@ -56,14 +58,21 @@ void BEMPostprocessor::Process(IBEMSolver const &solver)
     ComputeLocalFlowAngles(solver);
     ComputeLocalElementLoads(solver);
     ComputePowerAndThrust(solver);
-    ComputeFullBladeMoments();
-    ComputeIntegratedLoads();
+
+    // Root moments and the O(n²) tip-to-root integrals are only needed for
+    // load export — skip them for iterative callers.
+    if (detail_ == PostprocessDetail::FULL_LOADS)
+    {
+        ComputeFullBladeMoments();
+        ComputeIntegratedLoads();
+    }
 
     success_ = true;
 }
 
 // ─────────────────────────────────────────────────────────────────────────────
 // AllocateArrays
+// Integrated-load arrays stay empty unless FULL_LOADS was requested.
 // ─────────────────────────────────────────────────────────────────────────────
 void BEMPostprocessor::AllocateArrays()
 {
@@ -83,6 +92,10 @@ void BEMPostprocessor::AllocateArrays()
     r.element_fy.assign(n_sec_, 0.0);
     r.element_mz.assign(n_sec_, 0.0);
     r.element_airfoil_moment.assign(n_sec_, 0.0);
+
+    if (detail_ != PostprocessDetail::FULL_LOADS)
+        return;
+
     r.integral_fx.assign(n_sec_, 0.0);
     r.integral_fy.assign(n_sec_, 0.0);
     r.integral_mx.assign(n_sec_, 0.0);
@@ -175,6 +188,12 @@ void BEMPostprocessor::ComputeLocalElementLoads(IBEMSolver const &solver)
         result_.element_thrust[i] = dT;
         result_.element_fy[i] = dFy;
         result_.element_torque[i] = dQ;
+
+        // Everything below is per-section output only; rotor scalars need
+        // just dT, dQ and dFy.
+        if (detail_ == PostprocessDetail::ROTOR_SCALARS)
+            continue;
+
         result_.element_airfoil_moment[i] = moment;
 
         // ── Section torsion moment ────────────────────────────────────────────
@@ -4,22 +4,29 @@
  */
 #define _USE_MATH_DEFINES
 #include "BEMSectionNoiseAdapter.h"
-#include "AirfoilDataAdapter.h"
 #include "TurbineGeometry.h"
 #include <cmath>
 #include <numbers>
+#include <stdexcept>
+#include <string>
 
-BEMSectionNoiseAdapter::BEMSectionNoiseAdapter(double observer_distance,
+BEMSectionNoiseAdapter::BEMSectionNoiseAdapter(std::shared_ptr<const SectionNoiseGeometryTable>
+                                                      section_geometry,
+                                               double observer_distance,
                                                double observer_theta,
                                                double observer_phi,
                                                double turbulence_intensity,
                                                double turbulence_length_scale)
-    : observer_distance_(observer_distance)
+    : section_geometry_(std::move(section_geometry))
+    , observer_distance_(observer_distance)
     , observer_theta_(observer_theta)
     , observer_phi_(observer_phi)
     , turbulence_intensity_(turbulence_intensity)
     , turbulence_length_scale_(turbulence_length_scale)
-{}
+{
+    if (!section_geometry_)
+        throw std::invalid_argument("BEMSectionNoiseAdapter: section geometry table is required");
+}
 
 std::vector<SectionNoiseInput> BEMSectionNoiseAdapter::Build(
     BEMPostprocessResult const &pp,
@@ -32,6 +39,14 @@ std::vector<SectionNoiseInput> BEMSectionNoiseAdapter::Build(
     const std::size_t n_sec = turbine->num_sections();
     if (pp.alpha_eff.size() < n_sec) return {};
 
+    // Static airfoil data, pre-built for this turbine
+    SectionNoiseGeometryTable const &geometry = *section_geometry_;
+    if (geometry.size() != n_sec)
+        throw std::invalid_argument(
+            "BEMSectionNoiseAdapter: section geometry table has "
+            + std::to_string(geometry.size()) + " entries, turbine has "
+            + std::to_string(n_sec) + " sections");
+
     std::vector<SectionNoiseInput> inputs;
     inputs.reserve(n_sec);
 
@@ -81,17 +96,12 @@ std::vector<SectionNoiseInput> BEMSectionNoiseAdapter::Build(
         inp.mach      = 0.0;   // caller fills from NingSolver::LocalMachNumber(i)
         inp.reynolds  = 0.0;   // caller fills from NingSolver::LocalReynoldsNumber(i)
 
-        // ── Trailing-edge geometry ────────────────────────────────────────────
-        // thickness() returns absolute thickness [m]; TE thickness ≈ 1% of that
-        inp.te_thickness = turbine->thickness(i) * 0.01; // heuristic default
-        inp.te_angle_deg = 14.0;                          // BPM default
-
-        // ── Thickness fractions for TI noise ─────────────────────────────────
-        // TurbineGeometry provides relative thickness (t/c * 100) via relative_thickness()
-        // We approximate t/c at 1% and 10% from the overall t/c ratio.
-        const double tc = turbine->thickness(i) / inp.chord;  // t/c [-]
-        inp.thickness_1_percent  = tc * 0.6;  // heuristic: ~60% of max at 1% chord
-        inp.thickness_10_percent = tc * 0.9;  // heuristic: ~90% of max at 10% chord
+        // ── Trailing-edge geometry and thickness (pre-built per section) ──────
+        SectionNoiseGeometry const &geo = geometry[i];
+        inp.te_thickness         = geo.te_thickness_over_chord * inp.chord;
+        inp.te_angle_deg         = geo.te_angle_deg;
+        inp.thickness_1_percent  = geo.thickness_1_percent;
+        inp.thickness_10_percent = geo.thickness_10_percent;
 
         // ── Turbulence ────────────────────────────────────────────────────────
         inp.turbulence_intensity    = turbulence_intensity_;
@@ -102,24 +112,8 @@ std::vector<SectionNoiseInput> BEMSectionNoiseAdapter::Build(
         inp.observer_theta    = observer_theta_;
         inp.observer_phi      = observer_phi_;
 
-        // ── Xfoil BL: attach normalised airfoil coordinates ──────────────────
-        // TurbineGeometry::airfoilGeometry(i) returns the normalised (0..1)
-        // AirfoilGeometryData for section i via BladeGeometrySection.
-        // getCoordinates() is safe because applyScalingWithChordAndMaxThickness
-        // writes into scaledCoordinates and leaves coordinates untouched.
-        {
-        const AirfoilGeometryData *ag = turbine->airfoilGeometry(i);
-            if (ag && AirfoilDataAdapter::IsUsableForXfoil(*ag))
-            {
-                auto adata = std::make_shared<bladenoise::io::AirfoilData>();
-                AirfoilDataAdapter::Convert(*ag, *adata);
-                inp.airfoil_data = std::move(adata);
-                if (inp.airfoil_data.get()->x.size() < 10) {
-                    std::cout << "Warning: Airfoil data has less than 10 points. This may cause problems in the noise calculation." << std::endl;
-                }
-                //TODO: Check number of airfoil points!
-            }
-        }
+        // ── Xfoil BL: shared, immutable airfoil coordinates (no copy) ─────────
+        inp.airfoil_data = geo.airfoil_data;
 
         inputs.push_back(inp);       
     }
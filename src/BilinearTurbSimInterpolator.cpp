@@ -11,6 +11,10 @@
  * (4 corner values), we apply two z-direction lerps followed by one y-direction
  * lerp — identical algebra, zero vector allocations.
  *
+ * The cell is located in O(1) from the uniform grid spacing (see
+ * FindLowerIndex) and the 4 corners are read through a TimestepView, so
+ * packed velocity data is decoded only at those corners.
+ *
  *   Corner layout (z-outer, y-inner storage, matching TurbSim flat arrays):
  *
  *       z[z_idx+1]   v_lo_zhi ---- v_hi_zhi
@@ -21,62 +25,78 @@
  */
 #include "BilinearTurbSimInterpolator.h"
 
-#include <array>
-#include <functional>
 #include <stdexcept>
 
 // ─────────────────────────────────────────────────────────────────────────────
-// Interpolate — public entry point
+// Locate — bounding cell of (y, z)
 // ─────────────────────────────────────────────────────────────────────────────
-WVPMUtilities::Vec3D<double>
-BilinearTurbSimInterpolator::Interpolate(
-    WVPMUtilities::Vec3D<double> const &point,
-    std::size_t raw_ts,
-    TurbSimGrid const &grid,
-    TurbSimVelocityData const &velocity) const
+BilinearTurbSimInterpolator::Cell
+BilinearTurbSimInterpolator::Locate(double y, double z, TurbSimGrid const &grid)
 {
-    // ── Step 1: find bounding grid cell ──────────────────────────────────────
-    // Key optimisation: identify the single 2×2 cell that brackets the query
-    // point, then work only with its 4 corners — no large vector allocation.
+    std::vector<double> const &y_axis = grid.axis_y();
+    std::vector<double> const &z_axis = grid.axis_z();
 
-    std::vector<double> const y_axis = grid.axis_y();
-    std::vector<double> const z_axis = grid.axis_z();
-    std::size_t const num_y = grid.num_y();
+    std::size_t const y_idx = FindLowerIndex(y_axis, grid.spacing_y(), y);
+    std::size_t const z_idx = FindLowerIndex(z_axis, grid.spacing_z(), z);
 
-    std::size_t const y_idx = FindLowerIndex(y_axis, point.y());
-    std::size_t const z_idx = FindLowerIndex(z_axis, point.z());
-
-    // ── Step 2: read the 4 bounding cell corners from the flat grid ──────────
+    Cell cell;
     // Flat index: row z, column y  →  z * num_y + y
-    auto vel_begin = velocity.TimestepBegin(raw_ts);
+    cell.corner = z_idx * grid.num_y() + y_idx;
+    cell.y_lo = y_axis[y_idx];
+    cell.y_hi = y_axis[y_idx + 1];
+    cell.z_lo = z_axis[z_idx];
+    cell.z_hi = z_axis[z_idx + 1];
+    return cell;
+}
 
-    auto const &v_lo_zlo = *(vel_begin + z_idx * num_y + y_idx);
-    auto const &v_lo_zhi = *(vel_begin + (z_idx + 1) * num_y + y_idx);
-    auto const &v_hi_zlo = *(vel_begin + z_idx * num_y + y_idx + 1);
-    auto const &v_hi_zhi = *(vel_begin + (z_idx + 1) * num_y + y_idx + 1);
+// ─────────────────────────────────────────────────────────────────────────────
+// StencilAt — cell plus fractional position, for precomputed sampling
+// ─────────────────────────────────────────────────────────────────────────────
+BilinearTurbSimInterpolator::Stencil
+BilinearTurbSimInterpolator::StencilAt(double y, double z, TurbSimGrid const &grid)
+{
+    Cell const cell = Locate(y, z, grid);
 
-    // Axis coordinates of the bounding cell
-    double const y_lo = y_axis[y_idx];
-    double const y_hi = y_axis[y_idx + 1];
-    double const z_lo = z_axis[z_idx];
-    double const z_hi = z_axis[z_idx + 1];
+    Stencil st;
+    st.corner = cell.corner;
+    st.ty = (y - cell.y_lo) / (cell.y_hi - cell.y_lo);
+    st.tz = (z - cell.z_lo) / (cell.z_hi - cell.z_lo);
+    return st;
+}
 
-    // ── Step 3: bilinear interpolation per component ──────────────────────────
+// ─────────────────────────────────────────────────────────────────────────────
+// Blend — bilinear interpolation inside one cell
+// ─────────────────────────────────────────────────────────────────────────────
+WVPMUtilities::Vec3D<double>
+BilinearTurbSimInterpolator::Blend(Cell const &cell,
+                                   double y,
+                                   double z,
+                                   std::size_t num_y,
+                                   TurbSimVelocityData::TimestepView const &ts)
+{
+    // ── Read the 4 bounding cell corners from the flat grid ──────────────────
+    // Only these 4 points are decoded when the velocity data is packed.
+    auto const v_lo_zlo = ts[cell.corner];
+    auto const v_lo_zhi = ts[cell.corner + num_y];
+    auto const v_hi_zlo = ts[cell.corner + 1];
+    auto const v_hi_zhi = ts[cell.corner + num_y + 1];
+
+    // ── Bilinear interpolation per component ─────────────────────────────────
     // Uses MathUtility::basicLinearInterpolation (the same primitive that
     // MathUtility::biLinearInterpolation delegates to):
-    //   Step 3a — lerp in z at the left  column (y = y_lo)  → v_left
-    //   Step 3b — lerp in z at the right column (y = y_hi)  → v_right
-    //   Step 3c — lerp in y between v_left and v_right       → result
+    //   a — lerp in z at the left  column (y = y_lo)  → v_left
+    //   b — lerp in z at the right column (y = y_hi)  → v_right
+    //   c — lerp in y between v_left and v_right       → result
 
     auto biLerp = [&](double q_lo_zlo, double q_lo_zhi,
                       double q_hi_zlo, double q_hi_zhi) -> double
     {
         double v_left = MathUtility::basicLinearInterpolation(
-            point.z(), z_lo, z_hi, q_lo_zlo, q_lo_zhi);
+            z, cell.z_lo, cell.z_hi, q_lo_zlo, q_lo_zhi);
         double v_right = MathUtility::basicLinearInterpolation(
-            point.z(), z_lo, z_hi, q_hi_zlo, q_hi_zhi);
+            z, cell.z_lo, cell.z_hi, q_hi_zlo, q_hi_zhi);
         return MathUtility::basicLinearInterpolation(
-            point.y(), y_lo, y_hi, v_left, v_right);
+            y, cell.y_lo, cell.y_hi, v_left, v_right);
     };
 
     using V = WVPMUtilities::Vec3D<double>;
@@ -86,28 +106,87 @@ BilinearTurbSimInterpolator::Interpolate(
         biLerp(v_lo_zlo.z(), v_lo_zhi.z(), v_hi_zlo.z(), v_hi_zhi.z()));
 }
 
+// ─────────────────────────────────────────────────────────────────────────────
+// Interpolate — public entry point
+// ─────────────────────────────────────────────────────────────────────────────
+WVPMUtilities::Vec3D<double>
+BilinearTurbSimInterpolator::Interpolate(
+    WVPMUtilities::Vec3D<double> const &point,
+    std::size_t raw_ts,
+    TurbSimGrid const &grid,
+    TurbSimVelocityData const &velocity) const
+{
+    // Key optimisation: identify the single 2×2 cell that brackets the query
+    // point, then work only with its 4 corners — no large vector allocation.
+    Cell const cell = Locate(point.y(), point.z(), grid);
+    return Blend(cell, point.y(), point.z(), grid.num_y(), velocity.View(raw_ts));
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// InterpolateBatch — all query points of one timestep
+// ─────────────────────────────────────────────────────────────────────────────
+void BilinearTurbSimInterpolator::InterpolateBatch(
+    double const *y,
+    double const *z,
+    std::size_t count,
+    std::size_t raw_ts,
+    TurbSimGrid const &grid,
+    TurbSimVelocityData const &velocity,
+    double *u,
+    double *v,
+    double *w) const
+{
+    // Timestep view and grid metadata are resolved once for the whole batch.
+    TurbSimVelocityData::TimestepView const ts = velocity.View(raw_ts);
+    std::size_t const num_y = grid.num_y();
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        WVPMUtilities::Vec3D<double> const vel =
+            Blend(Locate(y[i], z[i], grid), y[i], z[i], num_y, ts);
+        u[i] = vel.x();
+        v[i] = vel.y();
+        w[i] = vel.z();
+    }
+}
+
 // ─────────────────────────────────────────────────────────────────────────────
 // FindLowerIndex
 //
-// Returns the index i such that axis[i] <= value < axis[i+1].
+// Returns the first index i such that value <= axis[i+1], i.e.
+// axis[i] < value <= axis[i+1] inside the grid.
 // Clamps to [0, axis.size()-2] for points outside the grid.
+//
+// The axis is uniform, so the cell follows from one division; the two
+// correction loops absorb rounding at cell boundaries (at most one step) and
+// keep the result identical to a linear scan.
 // ─────────────────────────────────────────────────────────────────────────────
 std::size_t BilinearTurbSimInterpolator::FindLowerIndex(
     std::vector<double> const &axis,
+    double spacing,
     double value)
 {
     if (axis.size() < 2)
         throw std::invalid_argument("BilinearTurbSimInterpolator: axis must have >= 2 points");
 
+    std::size_t const last = axis.size() - 2;
+
     // Clamp above-maximum points to the last cell.
     if (value >= axis.back())
-        return axis.size() - 2;
+        return last;
 
-    for (std::size_t i = 0; i < axis.size() - 1; ++i)
-    {
-        if (value <= axis[i + 1])
-            return i;
-    }
+    // value <= axis.front() (or NaN) — clamp to first cell
+    if (!(value > axis.front()))
+        return 0;
+
+    std::size_t i = static_cast<std::size_t>((value - axis.front()) / spacing);
+    if (i > last)
+        i = last;
+
+    while (i > 0 && value <= axis[i])
+        --i;
+    while (i < last && value > axis[i + 1])
+        ++i;
 
-    return 0; // value <= axis.front() — clamp to first cell
+    return i;
 }
@@ -24,49 +24,35 @@ static double correctRelThicknessAtRootToCylinder(double value) {
 }
 
 
-std::vector<std::string> BladeGeometryParser::tokenizeLine(const std::string& line, char delimiter) const {
-    std::vector<std::string> tokens;
-    std::stringstream ss(line);
-    std::string token;
-
-    while (std::getline(ss, token, delimiter)) {
-        // Trim leading/trailing whitespace
-        token.erase(0, token.find_first_not_of(" \t"));
-        const auto last = token.find_last_not_of(" \t");
-        if (last != std::string::npos)
-            token.erase(last + 1);
-        else
-            token.clear();
-
-        if (!token.empty()) {
-            tokens.push_back(token);
-        }
-    }
+void BladeGeometryParser::tokenizeLine(std::string_view line,
+                                       std::vector<std::string_view>& tokens,
+                                       char delimiter) const {
+    text::splitFields(line, delimiter, tokens);
 
     // If tab didn't split the line, fall back to space separation
     if (tokens.size() <= 1 && delimiter == '\t') {
-        return tokenizeLine(line, ' ');
+        text::splitFields(line, ' ', tokens);
     }
-
-    return tokens;
 }
 
 // ---------------------------------------------------------------------------
 
-void BladeGeometryParser::parseStandardFormat(std::ifstream& stream,
+void BladeGeometryParser::parseStandardFormat(LineScanner& lines,
                                               const std::string& /*filePath*/,
                                               BladeGeometryData& data,
-                                              const std::string& firstLine) const
+                                              std::string_view firstLine) const
 {
-    auto processLine = [&](const std::string& line, size_t lineNumber) {
+    std::vector<std::string_view> tokens;
+
+    auto processLine = [&](std::string_view line, size_t lineNumber) {
         if (line.empty()) return;
 
         if (line[0] == '#') {
-            data.addHeader(line);
+            data.addHeader(std::string(line));
             return;
         }
 
-        auto tokens = tokenizeLine(line);
+        tokenizeLine(line, tokens);
         if (tokens.empty()) return;
 
         if (tokens[0] == "DEF") {
@@ -82,19 +68,17 @@ void BladeGeometryParser::parseStandardFormat(std::ifstream& stream,
         }
     };
 
-    size_t lineNumber = 1;
-    processLine(firstLine, lineNumber);
+    processLine(firstLine, lines.lineNumber());
 
-    std::string line;
-    while (std::getline(stream, line)) {
-        ++lineNumber;
-        processLine(line, lineNumber);
+    std::string_view line;
+    while (lines.next(line)) {
+        processLine(line, lines.lineNumber());
     }
 }
 
 // ---------------------------------------------------------------------------
 
-void BladeGeometryParser::parseEFormat(std::ifstream& stream,
+void BladeGeometryParser::parseEFormat(LineScanner& lines,
                                        const std::string& /*filePath*/,
                                        BladeGeometryData& data) const
 {
@@ -118,38 +102,31 @@ void BladeGeometryParser::parseEFormat(std::ifstream& stream,
     // [16]  addOns
     // [17]  airfoilName
 
-    std::string line;
-    size_t lineNumber = 1; // VERSIO line already consumed by caller
+    std::string_view line;
+    std::vector<std::string_view> tokens;
     bool headerSkipped = false; // the Sektion column-header line
 
-    while (std::getline(stream, line)) {
-        ++lineNumber;
+    while (lines.next(line)) {
+        const size_t lineNumber = lines.lineNumber();
 
         // Trim
-        const auto first = line.find_first_not_of(" \t\r");
-        if (first == std::string::npos) continue;
-        const auto last = line.find_last_not_of(" \t\r");
-        line = line.substr(first, last - first + 1);
-
+        line = text::trim(line, " \t\r");
         if (line.empty()) continue;
 
-        auto tokens = tokenizeLine(line, '\t');
+        tokenizeLine(line, tokens, '\t');
         if (tokens.empty()) continue;
 
         // FILE header line
         if (tokens[0] == "FILE") {
             if (tokens.size() > 1)
-                data.setSourceFileName(tokens[1]);
+                data.setSourceFileName(std::string(tokens[1]));
             continue;
         }
 
         // Column-header line (first token non-numeric, e.g. "Sektion")
         if (!headerSkipped) {
-            bool isNumeric = true;
-            try { std::stod(tokens[0]); }
-            catch (...) { isNumeric = false; }
-
-            if (!isNumeric) {
+            double firstValue;
+            if (!text::parseDouble(tokens[0], firstValue)) {
                 headerSkipped = true;
                 continue;
             }
@@ -167,23 +144,23 @@ void BladeGeometryParser::parseEFormat(std::ifstream& stream,
             BladeGeometrySection row;
             row.type              = "DEF";
             // col[0] = section index -- discard
-            row.bladeRadius       = std::stod(tokens[1]);
-            row.chord             = std::stod(tokens[2]);
-            row.twist             = std::stod(tokens[3]) * std::numbers::pi / 180.0;
-            row.thicknessAbs_mm   = std::stod(tokens[4]);
-            row.relativeThickness = normaliseRelThickness(correctRelThicknessAtRootToCylinder(std::stod(tokens[5])));
-            row.xt4             = std::stod(tokens[6]);
-            row.yt4             = std::stod(tokens[7]);
-            row.trailingEdge_mm   = std::stod(tokens[8]);
-            row.prebend_mm        = std::stod(tokens[9]);
-            row.chordWithTES_m    = std::stod(tokens[10]);
-            row.gammaPrebend_deg  = std::stod(tokens[11]);
-            row.radiusPrebend_m   = std::stod(tokens[12]);
-            row.relThick001       = std::stod(tokens[13]);
-            row.relThick01        = std::stod(tokens[14]);
-            row.teAngle_deg       = std::stod(tokens[15]);
-            row.addOns            = tokens[16];
-            row.airfoilName       = tokens[17];
+            row.bladeRadius       = text::toDouble(tokens[1]);
+            row.chord             = text::toDouble(tokens[2]);
+            row.twist             = text::toDouble(tokens[3]) * std::numbers::pi / 180.0;
+            row.thicknessAbs_mm   = text::toDouble(tokens[4]);
+            row.relativeThickness = normaliseRelThickness(correctRelThicknessAtRootToCylinder(text::toDouble(tokens[5])));
+            row.xt4             = text::toDouble(tokens[6]);
+            row.yt4             = text::toDouble(tokens[7]);
+            row.trailingEdge_mm   = text::toDouble(tokens[8]);
+            row.prebend_mm        = text::toDouble(tokens[9]);
+            row.chordWithTES_m    = text::toDouble(tokens[10]);
+            row.gammaPrebend_deg  = text::toDouble(tokens[11]);
+            row.radiusPrebend_m   = text::toDouble(tokens[12]);
+            row.relThick001       = text::toDouble(tokens[13]);
+            row.relThick01        = text::toDouble(tokens[14]);
+            row.teAngle_deg       = text::toDouble(tokens[15]);
+            row.addOns            = std::string(tokens[16]);
+            row.airfoilName       = std::string(tokens[17]);
             // relativeTwistAxis, xt4, yt4 stay 0 (not present in E-format)
             row.pcbaX = row.prebend_mm / 1000.0;
             row.relativeTwistAxis = (1.0 + row.xt4 / row.chord) * 100.0;
@@ -203,42 +180,41 @@ void BladeGeometryParser::parseEFormat(std::ifstream& stream,
 // ---------------------------------------------------------------------------
 
 std::unique_ptr<IStructuredData> BladeGeometryParser::parseFile(const std::string& filePath) {
-    std::ifstream file(filePath);
-    if (!file.is_open()) {
+    std::unique_ptr<MappedTextFile> file;
+    try { file = std::make_unique<MappedTextFile>(filePath); }
+    catch (const std::runtime_error&) {
         throw std::runtime_error("Cannot open blade geometry file: " + filePath);
     }
 
     auto bladeData = std::make_unique<BladeGeometryData>();
+    LineScanner lines(file->text());
 
     // Scan until the first non-blank, non-comment line to determine format
-    std::string line;
-    while (std::getline(file, line)) {
+    std::string_view line;
+    std::vector<std::string_view> tokens;
+    while (lines.next(line)) {
         // Trim
-        const auto first = line.find_first_not_of(" \t\r");
-        if (first == std::string::npos) continue;
-        const auto last = line.find_last_not_of(" \t\r");
-        line = line.substr(first, last - first + 1);
-
+        line = text::trim(line, " \t\r");
         if (line.empty()) continue;
 
         if (line[0] == '#') {
-            bladeData->addHeader(line);
+            bladeData->addHeader(std::string(line));
             continue;
         }
 
         // First meaningful line -- detect format by first token
-        auto tokens = tokenizeLine(line, '\t');
-            if (tokens.empty()) continue;
+        tokenizeLine(line, tokens, '\t');
+        if (tokens.empty()) continue;
 
         if (tokens[0] == "VERSIO") {
             // E-format: store version string, delegate rest of file
             if (tokens.size() > 1)
-                bladeData->setVersion(tokens[1]);
-            parseEFormat(file, filePath, *bladeData);
+                bladeData->setVersion(std::string(tokens[1]));
+            parseEFormat(lines, filePath, *bladeData);
         }
         else {
             // Standard format: re-process the already-read line
-            parseStandardFormat(file, filePath, *bladeData, line);
+            parseStandardFormat(lines, filePath, *bladeData, line);
         }
         break;
     }
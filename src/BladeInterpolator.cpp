@@ -14,6 +14,13 @@ BladeInterpolator::BladeInterpolator(
 	interpolateAllSections();
 }
 
+BladeInterpolator::BladeInterpolator(std::vector<std::unique_ptr<BladeGeometrySection>> sections)
+	:
+	bladeGeometry(nullptr),
+	bladeSections(std::move(sections))
+{
+}
+
 void BladeInterpolator::interpolateAllSections()
 {
     const std::vector<double> radiusValues = bladeGeometry->getRadiusValues();
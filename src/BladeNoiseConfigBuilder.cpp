@@ -8,6 +8,7 @@
  *   bladenoise/core/Types.h           – TripConfig, BoundaryLayerMethod, …
  *   bladenoise/noise/NoiseCalculator.h – the physics engine
  *   bladenoise/io/IOTypes.h           – io::AirfoilData (empty for BPM path)
+ *   bladenoise/airfoil/BoundaryLayerCache.h – BL cache statistics
  *
  * Everything else in SolidTurbine depends only on ISectionNoiseConfigBuilder.
  */
@@ -18,10 +19,12 @@
 #include "bladenoise/core/Types.h"
 #include "bladenoise/noise/NoiseCalculator.h"
 #include "bladenoise/io/IOTypes.h"
+#include "bladenoise/airfoil/BoundaryLayerCache.h"
 
 #include <cmath>
 #include <iostream>
 #include <numbers>
+#include <sstream>
 
 using namespace bladenoise;
 
@@ -80,16 +83,11 @@ bool BladeNoiseConfigBuilder::Build(
     // ── Run bladenoise::NoiseCalculator ───────────────────────────────────────
     // BPM path: empty AirfoilData is fine (BL correlations need no geometry).
     // Xfoil path: airfoil x/y coordinates must be present in inp.airfoil_data.
-    //   Use AirfoilDataAdapter::Convert() to populate them before calling Build().
-    io::AirfoilData airfoil_data;
-    if (inp.airfoil_data)
-    {
-        airfoil_data = *inp.airfoil_data; // pre-converted coordinates supplied
-    }
-    else
-    {
-        airfoil_data.num_points = 0;      // BPM: geometry not needed
-    }
+    //   They are shared with the section's SectionNoiseGeometry — read in
+    //   place, never copied.
+    static const io::AirfoilData kNoAirfoil{};
+    io::AirfoilData const &airfoil_data = inp.airfoil_data ? *inp.airfoil_data
+                                                           : kNoAirfoil;
 
     noise::NoiseCalculator calculator;
     CombinedNoiseResults bn;
@@ -108,6 +106,7 @@ bool BladeNoiseConfigBuilder::Build(
     {
         dst.spl.assign(src.spl.begin(), src.spl.end());
         dst.oaspl = src.overall_spl;
+        dst.directivity_crossover_hz = src.directivity_crossover;
     };
 
     mapSpectrum(result.tbl_pressure_side, bn.tbl_pressure_side);
@@ -120,3 +119,16 @@ bool BladeNoiseConfigBuilder::Build(
 
     return true;
 }
+
+// ─────────────────────────────────────────────────────────────────────────────
+std::string BladeNoiseConfigBuilder::CacheStatistics()
+{
+    auto const st = airfoil::BoundaryLayerCache::instance().stats();
+    const std::size_t lookups = st.hits + st.misses;
+
+    std::ostringstream os;
+    os << "BL cache: " << st.hits << " hits / " << st.misses << " misses ("
+       << (lookups > 0 ? 100 * st.hits / lookups : 0) << " % hit rate, "
+       << st.entries << " entries)";
+    return os.str();
+}
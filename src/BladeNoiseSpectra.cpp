@@ -0,0 +1,51 @@
+/**
+ * @file BladeNoiseSpectra.cpp
+ * @brief INoiseSpectra over BladeNoiseResults — see header.
+ */
+#include "BladeNoiseSpectra.h"
+
+#include "bladenoise/math/SpectralKernels.h"
+
+#include <algorithm>
+
+namespace spectral = bladenoise::math::spectral;
+
+BladeNoiseSpectra::BladeNoiseSpectra(std::span<const BladeNoiseResult> results)
+    : results_(results)
+{
+    for (auto const &r : results_)
+        if (!r.frequencies.empty())
+        {
+            frequencies_ = r.frequencies;
+            break;
+        }
+}
+
+NoiseSectionInfo BladeNoiseSpectra::section(std::size_t point, std::size_t sec) const
+{
+    SectionNoiseResult const &s = results_[point].sections[sec];
+
+    NoiseSectionInfo info;
+    info.section_index     = s.section_index;
+    info.radius            = s.radius;
+    info.chord             = s.chord;
+    info.span              = s.span;
+    info.velocity          = s.velocity;
+    info.reynolds          = s.reynolds;
+    info.mach              = s.mach;
+    info.alpha_deg         = s.alpha_deg;
+    info.observer_distance = s.observer_distance;
+    info.observer_theta    = s.observer_theta;
+    info.observer_phi      = s.observer_phi;
+    info.converged         = s.converged;
+    return info;
+}
+
+void BladeNoiseSpectra::spectrum(std::size_t point, std::size_t sec, NoiseSource src,
+                                 std::span<double> out) const
+{
+    std::vector<double> const &spl = Spectrum(point, sec, src).spl;
+    const std::size_t n = std::min(out.size(), spl.size());
+    std::copy_n(spl.begin(), n, out.begin());
+    std::fill(out.begin() + n, out.end(), spectral::FLOOR_DB);
+}
@@ -12,112 +12,161 @@
 
 #include <cmath>
 #include <cstdint>
+#include <algorithm>
+#include <cstring>
 #include <fstream>
+#include <memory>
 #include <stdexcept>
+#include <string_view>
 
-// ─────────────────────────────────────────────────────────────────────────────
-// Read
-// ─────────────────────────────────────────────────────────────────────────────
-TurbSimFileData BladedBinaryReader::Read(std::string const &filename) const
+#include "TextFileScanner.h" // MappedTextFile — the mapping itself is format-agnostic
+
+namespace
 {
-    std::ifstream in(filename, std::ios::binary);
-    if (!in)
-        throw std::runtime_error("BladedBinaryReader: cannot open file: " + filename);
+// Header field at a fixed byte offset (little-endian file, host byte order assumed).
+template <typename T>
+T ReadField(std::string_view bytes, std::size_t offset, char const *what)
+{
+    if (offset + sizeof(T) > bytes.size())
+        throw std::runtime_error(std::string("BladedBinaryReader: ") + what);
+    T value{};
+    std::memcpy(&value, bytes.data() + offset, sizeof(T));
+    return value;
+}
 
-    // ── Hub height and turbulence intensities (offset 16) ────────────────────
-    in.seekg(16);
+constexpr std::size_t kVelocityOffset = 104;
+} // namespace
 
-    auto read_float = [&]()
+// ─────────────────────────────────────────────────────────────────────────────
+// ParseHeader — the fixed 104-byte header shared by both sample backings
+// ─────────────────────────────────────────────────────────────────────────────
+BladedBinaryReader::Header BladedBinaryReader::ParseHeader(std::string_view bytes)
+{
+    auto read_float = [&](std::size_t offset)
     {
-        float v{};
-        in.read(reinterpret_cast<char *>(&v), sizeof(v));
-        if (!in)
-            throw std::runtime_error("BladedBinaryReader: unexpected end of file");
-        return static_cast<double>(v);
+        return static_cast<double>(
+            ReadField<float>(bytes, offset, "unexpected end of file"));
     };
 
-    double centre_height = read_float(); // hub height [m]
-    double ti_u = read_float();          // turbulence intensity u [%]
-    double ti_v = read_float();          // turbulence intensity v [%]
-    double ti_w = read_float();          // turbulence intensity w [%]
+    Header h;
+
+    // ── Hub height and turbulence intensities (offset 16) ────────────────────
+    h.centre_height = read_float(16); // hub height [m]
+    h.ti_u = read_float(20);          // turbulence intensity u [%]
+    h.ti_v = read_float(24);          // turbulence intensity v [%]
+    h.ti_w = read_float(28);          // turbulence intensity w [%]
 
     // ── Grid spacing (offsets follow immediately) ─────────────────────────────
-    double spacing_z = read_float();        // vertical grid spacing [m]
-    double spacing_y = read_float();        // lateral grid spacing  [m]
-    double longitudinal_res = read_float(); // longitudinal Δx [m]
+    h.spacing_z = read_float(32);        // vertical grid spacing [m]
+    h.spacing_y = read_float(36);        // lateral grid spacing  [m]
+    h.longitudinal_res = read_float(40); // longitudinal Δx [m]
 
     // ── Number of timesteps (offset 44) ──────────────────────────────────────
-    in.seekg(44);
+    // TurbSim stores half the timesteps; actual count is nt * 2.
+    int32_t const nt_half = ReadField<int32_t>(bytes, 44, "cannot read nt");
+    if (nt_half <= 0)
+        throw std::runtime_error("BladedBinaryReader: invalid number of timesteps");
+    h.nt = static_cast<std::size_t>(nt_half) * 2;
+
+    // ── Hub velocity ──────────────────────────────────────────────────────────
+    h.hub_velocity = read_float(48);
+
+    // ── Grid dimensions (offset 72) ───────────────────────────────────────────
+    int32_t const num_z_raw = ReadField<int32_t>(bytes, 72, "cannot read grid dims");
+    int32_t const num_y_raw = ReadField<int32_t>(bytes, 76, "cannot read grid dims");
+    if (num_z_raw <= 0 || num_y_raw <= 0)
+        throw std::runtime_error("BladedBinaryReader: invalid grid dims");
+
+    h.num_z = static_cast<unsigned>(num_z_raw);
+    h.num_y = static_cast<unsigned>(num_y_raw);
+    return h;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Read
+//
+// Default: the file is memory-mapped and the int16 velocity samples stay in
+// place; TurbSimVelocityData decodes a grid point only when it is requested
+// (or a whole timestep through its bulk DecodeTimestep()).
+//
+// With a stream window only the header is read here; the samples are pulled
+// into a TurbSimTimestepStream ring buffer as the run advances.
+// ─────────────────────────────────────────────────────────────────────────────
+TurbSimFileData BladedBinaryReader::Read(std::string const &filename) const
+{
+    std::shared_ptr<MappedTextFile> file;
+    std::string header_bytes;
+    std::string_view bytes;
+    std::uint64_t file_size = 0;
+
+    if (stream_window_ == 0)
     {
-        int32_t r{};
-        in.read(reinterpret_cast<char *>(&r), sizeof(r));
-        if (!in)
-            throw std::runtime_error("BladedBinaryReader: cannot read nt");
-        // TurbSim stores half the timesteps; actual count is nt * 2.
-        std::size_t nt = static_cast<std::size_t>(r) * 2;
-
-        // ── Hub velocity ──────────────────────────────────────────────────────
-        double hub_velocity = read_float();
-
-        // ── Grid dimensions (offset 72) ───────────────────────────────────────
-        in.seekg(72);
-        int32_t num_z_raw{}, num_y_raw{};
-        in.read(reinterpret_cast<char *>(&num_z_raw), sizeof(num_z_raw));
-        in.read(reinterpret_cast<char *>(&num_y_raw), sizeof(num_y_raw));
+        try
+        {
+            file = std::make_shared<MappedTextFile>(filename);
+        }
+        catch (std::runtime_error const &)
+        {
+            throw std::runtime_error("BladedBinaryReader: cannot open file: " + filename);
+        }
+        bytes = file->text();
+        file_size = bytes.size();
+    }
+    else
+    {
+        std::ifstream in(filename, std::ios::binary | std::ios::ate);
         if (!in)
-            throw std::runtime_error("BladedBinaryReader: cannot read grid dims");
+            throw std::runtime_error("BladedBinaryReader: cannot open file: " + filename);
+        file_size = static_cast<std::uint64_t>(in.tellg());
+        header_bytes.resize(static_cast<std::size_t>(std::min<std::uint64_t>(file_size, kVelocityOffset)));
+        in.seekg(0);
+        in.read(header_bytes.data(), static_cast<std::streamsize>(header_bytes.size()));
+        bytes = header_bytes;
+    }
 
-        auto num_z = static_cast<unsigned>(num_z_raw);
-        auto num_y = static_cast<unsigned>(num_y_raw);
+    Header const h = ParseHeader(bytes);
 
-        // ── Construct grid and timing objects ─────────────────────────────────
-        TurbSimGrid grid(centre_height, spacing_y, spacing_z, num_y, num_z);
+    // ── Construct grid and timing objects ─────────────────────────────────────
+    TurbSimGrid grid(h.centre_height, h.spacing_y, h.spacing_z, h.num_y, h.num_z);
 
-        double grid_width_y = static_cast<double>(num_y - 1) * spacing_y;
-        TurbSimTimingInfo timing(nt, hub_velocity, longitudinal_res, grid_width_y);
+    double grid_width_y = static_cast<double>(h.num_y - 1) * h.spacing_y;
+    TurbSimTimingInfo timing(h.nt, h.hub_velocity, h.longitudinal_res, grid_width_y);
 
-        // ── Read velocity data (offset 104) ───────────────────────────────────
-        in.seekg(104);
-        TurbSimVelocityData velocity;
+    // ── Velocity data (offset 104): nt × num_z × num_y × (u, v, w) int16 ─────
+    std::size_t const num_points = static_cast<std::size_t>(h.num_z) * h.num_y;
+    std::size_t const num_samples = h.nt * num_points * 3;
+    if (file_size < kVelocityOffset ||
+        (file_size - kVelocityOffset) / sizeof(int16_t) < num_samples)
+        throw std::runtime_error("BladedBinaryReader: file truncated during velocity read");
 
-        for (std::size_t i = 0; i < nt; ++i)
-        {
-            VelocityTimestep vt;
-            vt.reserve(static_cast<std::size_t>(num_z) * num_y);
-
-            for (unsigned z = 0; z < num_z; ++z)
-            {
-                for (unsigned y = 0; y < num_y; ++y)
-                {
-                    auto decode = [&](double /*ti_pct*/)
-                    {
-                        int16_t buf{};
-                        in.read(reinterpret_cast<char *>(&buf), sizeof(buf));
-                        return buf;
-                    };
-
-                    int16_t raw_u = decode(ti_u);
-                    int16_t raw_v = decode(ti_v);
-                    int16_t raw_w = decode(ti_w);
-
-                    // Bladed encoding:  v = hub_vel * ((TI/100) / 1000 * raw + offset)
-                    double u = hub_velocity * ((ti_u / 100.0) / 1000.0 * raw_u + 1.0);
-                    double v = hub_velocity * ((ti_v / 100.0) / 1000.0 * raw_v);
-                    double w = hub_velocity * ((ti_w / 100.0) / 1000.0 * raw_w);
-
-                    vt.emplace_back(u, v, w);
-                }
-            }
-            velocity.AddTimestep(std::move(vt));
-        }
+    // Bladed encoding:  v = hub_vel * ((TI/100) / 1000 * raw + offset)
+    TurbSimVelocityData::PackedEncoding encoding;
+    encoding.hub_velocity = h.hub_velocity;
+    encoding.scale[0] = (h.ti_u / 100.0) / 1000.0;
+    encoding.scale[1] = (h.ti_v / 100.0) / 1000.0;
+    encoding.scale[2] = (h.ti_w / 100.0) / 1000.0;
 
-        if (!in)
-            throw std::runtime_error("BladedBinaryReader: file truncated during velocity read");
+    TurbSimVelocityData velocity;
+    if (stream_window_ == 0)
+    {
+        // The mapping is page-aligned, so the samples at offset 104 are int16-aligned.
+        auto const *samples =
+            reinterpret_cast<int16_t const *>(bytes.data() + kVelocityOffset);
 
-        return TurbSimFileData(
-            std::move(grid),
-            std::move(velocity),
-            std::move(timing),
-            hub_velocity);
+        velocity = TurbSimVelocityData::FromPacked(
+            std::move(file), samples, h.nt, num_points, encoding);
+    }
+    else
+    {
+        velocity = TurbSimVelocityData::FromStream(
+            std::make_shared<TurbSimTimestepStream>(
+                filename, kVelocityOffset, h.nt, num_points, stream_window_),
+            encoding);
     }
+
+    return TurbSimFileData(
+        std::move(grid),
+        std::move(velocity),
+        std::move(timing),
+        h.hub_velocity);
 }
@@ -0,0 +1,242 @@
+/**
+ * @file CheckpointJournal.cpp
+ * @brief Implementation of CheckpointJournal.
+ */
+#include "CheckpointJournal.h"
+
+#include "bladenoise/core/Hash.h"
+
+#include <cstring>
+#include <stdexcept>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <system_error>
+
+namespace
+{
+constexpr char kMagic[8] = {'S', 'O', 'L', 'I', 'D', 'C', 'K', 'P'};
+constexpr std::uint32_t kByteOrderMark = 0x01020304u;
+
+// magic + version + byte-order mark + run key
+constexpr std::size_t kHeaderSize = sizeof(kMagic) + 4 + 4 + 8;
+
+// size + checksum in front of every record
+constexpr std::size_t kRecordHeaderSize = 8 + 8;
+
+template <typename T>
+T Load(std::string_view bytes, std::size_t offset)
+{
+    T value;
+    std::memcpy(&value, bytes.data() + offset, sizeof(T));
+    return value;
+}
+
+template <typename T>
+void Store(std::ostream &out, T value)
+{
+    out.write(reinterpret_cast<char const *>(&value), sizeof(T));
+}
+} // namespace
+
+// ─────────────────────────────────────────────────────────────────────────────
+std::uint64_t CheckpointJournal::RunKey(std::uint64_t inputs_id, std::string_view stage,
+                                        std::string_view build_id)
+{
+    return bladenoise::Fnv1a()
+        .u64(inputs_id)
+        .u64(build_id.size())
+        .bytes(build_id)
+        .bytes(stage)
+        .value();
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Construction / destruction
+// ─────────────────────────────────────────────────────────────────────────────
+CheckpointJournal::CheckpointJournal(std::string path, std::uint64_t run_key, bool resume)
+    : path_(std::move(path)), run_key_(run_key)
+{
+    if (resume)
+        Restore();
+}
+
+CheckpointJournal::~CheckpointJournal()
+{
+    StopWriter();
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Restore — header check, then records up to the first damaged one
+// ─────────────────────────────────────────────────────────────────────────────
+void CheckpointJournal::Restore()
+{
+    std::error_code ec;
+    if (!std::filesystem::is_regular_file(path_, ec))
+        return;
+
+    std::ifstream in(path_, std::ios::binary);
+    std::string const data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    std::string_view const bytes(data);
+
+    if (bytes.size() < kHeaderSize ||
+        bytes.substr(0, sizeof(kMagic)) != std::string_view(kMagic, sizeof(kMagic)))
+    {
+        restore_note_ = "not a checkpoint journal";
+        return;
+    }
+    if (Load<std::uint32_t>(bytes, 8) != FORMAT_VERSION)
+    {
+        restore_note_ = "format version " + std::to_string(Load<std::uint32_t>(bytes, 8)) +
+                        ", expected " + std::to_string(FORMAT_VERSION);
+        return;
+    }
+    if (Load<std::uint32_t>(bytes, 12) != kByteOrderMark)
+    {
+        restore_note_ = "written with a different byte order";
+        return;
+    }
+    if (Load<std::uint64_t>(bytes, 16) != run_key_)
+    {
+        restore_note_ = "written for other inputs or by another build";
+        return;
+    }
+
+    std::size_t pos = kHeaderSize;
+    while (bytes.size() - pos >= kRecordHeaderSize)
+    {
+        const std::uint64_t size = Load<std::uint64_t>(bytes, pos);
+        const std::uint64_t checksum = Load<std::uint64_t>(bytes, pos + 8);
+        if (size > bytes.size() - pos - kRecordHeaderSize)
+            break;
+        std::string_view const payload = bytes.substr(pos + kRecordHeaderSize, size);
+        if (bladenoise::fnv1a(payload) != checksum)
+            break;
+
+        restored_.emplace_back(payload);
+        pos += kRecordHeaderSize + size;
+        restored_end_.push_back(pos);
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+void CheckpointJournal::KeepRestored(std::size_t count)
+{
+    if (started_)
+        throw std::logic_error("CheckpointJournal: KeepRestored() after Append()");
+    if (count < restored_.size())
+    {
+        restored_.resize(count);
+        restored_end_.resize(count);
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+void CheckpointJournal::Append(std::string record)
+{
+    if (!started_)
+        StartWriter();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queue_.push_back(std::move(record));
+    }
+    queued_.notify_one();
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+void CheckpointJournal::Complete()
+{
+    StopWriter();
+    std::error_code ec;
+    std::filesystem::remove(path_, ec);
+    restored_.clear();
+    restored_end_.clear();
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Writer thread
+// ─────────────────────────────────────────────────────────────────────────────
+void CheckpointJournal::StartWriter()
+{
+    const std::uint64_t keep_bytes = restored_end_.empty() ? 0 : restored_end_.back();
+    stop_ = false;
+    started_ = true;
+    writer_ = std::thread(&CheckpointJournal::WriterLoop, this, keep_bytes);
+}
+
+void CheckpointJournal::StopWriter()
+{
+    if (!writer_.joinable())
+        return;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    queued_.notify_one();
+    writer_.join();
+}
+
+// keep_bytes > 0: continue the restored journal (cut after its last kept
+// record); otherwise start a new file.  Write failures are reported once and
+// the run goes on without checkpoints.
+void CheckpointJournal::WriterLoop(std::uint64_t keep_bytes)
+{
+    std::ofstream out;
+    std::error_code ec;
+    if (keep_bytes > 0)
+    {
+        std::filesystem::resize_file(path_, keep_bytes, ec);
+        if (!ec)
+            out.open(path_, std::ios::binary | std::ios::app);
+    }
+    else
+    {
+        std::filesystem::path const parent = std::filesystem::path(path_).parent_path();
+        if (!parent.empty())
+            std::filesystem::create_directories(parent, ec);
+        out.open(path_, std::ios::binary | std::ios::trunc);
+        out.write(kMagic, sizeof(kMagic));
+        Store(out, FORMAT_VERSION);
+        Store(out, kByteOrderMark);
+        Store(out, run_key_);
+        out.flush();
+    }
+
+    bool failed = !out;
+    if (failed)
+        std::cerr << "  Checkpoint: cannot write " << path_ << "; continuing without\n";
+
+    std::vector<std::string> batch;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            queued_.wait(lock, [&] { return stop_ || !queue_.empty(); });
+            if (queue_.empty())
+                return; // stop requested and nothing left
+            batch.swap(queue_);
+        }
+
+        if (failed)
+        {
+            batch.clear();
+            continue;
+        }
+
+        for (std::string const &record : batch)
+        {
+            Store<std::uint64_t>(out, record.size());
+            Store<std::uint64_t>(out, bladenoise::fnv1a(record));
+            out.write(record.data(), static_cast<std::streamsize>(record.size()));
+        }
+        out.flush();
+        batch.clear();
+
+        if (!out)
+        {
+            failed = true;
+            std::cerr << "  Checkpoint: write to " << path_ << " failed; continuing without\n";
+        }
+    }
+}
@@ -49,6 +49,10 @@ bool Configuration::hasValue(const std::string& key) const {
     return values.find(key) != values.end();
 }
 
+const std::unordered_map<std::string, std::any>& Configuration::getValues() const {
+    return values;
+}
+
 double Configuration::getDouble(const std::string& key) const { 
     return getValue<double>(key); }
 
@@ -116,22 +116,8 @@ void ConfigurationParser::loadIndividualAirfoilGeometries(Configuration& config,
     auto validFilePaths = geometryFileList->getValidFilePaths();
     std::cout << "\nLoading " << validFilePaths.size() << " individual airfoil geometry files..." << std::endl;
 
-    for (const auto& geometryFilePath : validFilePaths) {
-        try {
-            // Parse each individual airfoil geometry file
-            auto airfoilGeometry = filePathParser->parseIndividualFile(geometryFilePath, "airfoil_geometry");
-
-            // Add to the collection of loaded airfoil geometries
-            config.addToCollection("loaded_airfoil_geometries", std::move(airfoilGeometry));
-
-            std::cout << "  Loaded: " << std::filesystem::path(geometryFilePath).filename().string() << std::endl;
-
-        }
-        catch (const std::exception& e) {
-            std::cout << "  Failed to load " << geometryFilePath << ": " << e.what() << std::endl;
-            // Continue loading other files even if one fails
-        }
-    }
+    loadIndividualFiles(config, filePathParser, validFilePaths,
+                        "airfoil_geometry", "loaded_airfoil_geometries");
 
     std::cout << "\nSuccessfully loaded " << config.getAirfoilGeometries().size()
         << " airfoil geometries." << std::endl;
@@ -257,24 +243,35 @@ void ConfigurationParser::loadIndividualAirfoilPerformances(Configuration& confi
     auto validFilePaths = performanceFileList->getValidFilePaths();
     std::cout << "\nLoading " << validFilePaths.size() << " individual airfoil performance files..." << std::endl;
 
-    for (const auto& performanceFilePath : validFilePaths) {
-        try {
-            // Parse each individual airfoil performance file
-            auto airfoilPerformance = filePathParser->parseIndividualFile(performanceFilePath, "airfoil_performance");
-
-            // Add to the collection of loaded airfoil performances
-            config.addToCollection("loaded_airfoil_performances", std::move(airfoilPerformance));
-
-            std::cout << "  Loaded: " << std::filesystem::path(performanceFilePath).filename().string() << std::endl;
-
-        }
-        catch (const std::exception& e) {
-            std::cout << "  Failed to load " << performanceFilePath << ": " << e.what() << std::endl;
-            // Continue loading other files even if one fails
-        }
-    }
+    loadIndividualFiles(config, filePathParser, validFilePaths,
+                        "airfoil_performance", "loaded_airfoil_performances");
 
     std::cout << "\nSuccessfully loaded " << config.getAirfoilPerformances().size()
         << " airfoil performance datasets." << std::endl;
 }
 
+void ConfigurationParser::loadIndividualFiles(Configuration& config, const FilePathParser* filePathParser,
+    const std::vector<std::string>& filePaths, const std::string& fileType,
+    const std::string& collectionKey) const {
+    // Files are parsed concurrently; results are added in list order so the
+    // collection is the same for every thread count.
+    FileListLoadResult result = FileListLoader::load(filePaths, [&](const std::string& filePath) {
+        return filePathParser->parseIndividualFile(filePath, fileType);
+    });
+
+    for (std::size_t i = 0; i < result.data.size(); ++i) {
+        for (const auto& warning : result.warnings[i])
+            std::cout << "  Warning: " << warning << std::endl;
+        if (!result.data[i]) continue;
+        config.addToCollection(collectionKey, std::move(result.data[i]));
+        std::cout << "  Loaded: " << std::filesystem::path(filePaths[i]).filename().string() << std::endl;
+    }
+
+    // Failed files do not stop the others; report them together
+    if (!result.errors.empty()) {
+        std::cout << "  Failed to load " << result.errors.size() << " of "
+                  << filePaths.size() << " files:" << std::endl;
+        for (const auto& error : result.errors)
+            std::cout << "    " << error.filePath << ": " << error.message << std::endl;
+    }
+}
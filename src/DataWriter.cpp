@@ -17,11 +17,8 @@ bool DataWriter::write()
         return false;
     }
 
-    // Format the data
-    std::string formattedContent = m_formatter->format(*m_data);
-
-    // Write to output target
-    return m_outputTarget->write(formattedContent);
+    // Format the data straight into the output target
+    return m_formatter->formatTo(*m_data, *m_outputTarget);
 }
 
 void DataWriter::setData(std::shared_ptr<DataFormat> data)
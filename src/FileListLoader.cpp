@@ -0,0 +1,58 @@
+#include "FileListLoader.h"
+
+#include <exception>
+#include <iostream>
+
+namespace {
+
+// Warnings of the file the current thread is parsing; null outside load()
+thread_local std::vector<std::string>* currentWarnings = nullptr;
+
+}
+
+FileListLoadResult FileListLoader::load(const std::vector<std::string>& filePaths,
+                                        const ParseFunction& parse) {
+    const std::ptrdiff_t n = static_cast<std::ptrdiff_t>(filePaths.size());
+
+    FileListLoadResult result;
+    result.data.resize(filePaths.size());
+    result.warnings.resize(filePaths.size());
+
+    // Error text per slot; empty means success
+    std::vector<std::string> messages(filePaths.size());
+
+    #pragma omp parallel for schedule(dynamic, 1)
+    for (std::ptrdiff_t i = 0; i < n; ++i) {
+        currentWarnings = &result.warnings[i];
+        try {
+            result.data[i] = parse(filePaths[i]);
+            if (!result.data[i])
+                messages[i] = "parser returned no data";
+        }
+        catch (const std::exception& e) {
+            messages[i] = e.what();
+            if (messages[i].empty())
+                messages[i] = "unknown error";
+        }
+        catch (...) {
+            messages[i] = "unknown error";
+        }
+        currentWarnings = nullptr;
+    }
+
+    for (std::size_t i = 0; i < messages.size(); ++i) {
+        if (messages[i].empty()) continue;
+        result.data[i].reset();
+        result.errors.push_back({ i, filePaths[i], std::move(messages[i]) });
+    }
+
+    return result;
+}
+
+void FileListLoader::warn(const std::string& message) {
+    if (currentWarnings) {
+        currentWarnings->push_back(message);
+        return;
+    }
+    std::cout << ("Warning: " + message + "\n") << std::flush;
+}
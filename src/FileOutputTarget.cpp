@@ -40,6 +40,47 @@ bool FileOutputTarget::write(const std::string &content)
     }
 }
 
+bool FileOutputTarget::begin()
+{
+    try
+    {
+        if (m_filePath.has_parent_path())
+        {
+            std::filesystem::create_directories(m_filePath.parent_path());
+        }
+
+        m_stream.open(m_filePath);
+        if (!m_stream)
+        {
+            std::cerr << "Failed to open file: " << m_filePath << std::endl;
+            return false;
+        }
+        return true;
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Exception writing file: " << e.what() << std::endl;
+        return false;
+    }
+}
+
+bool FileOutputTarget::append(std::string_view chunk)
+{
+    m_stream.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+    return static_cast<bool>(m_stream);
+}
+
+bool FileOutputTarget::finish()
+{
+    m_stream.close();
+    if (!m_stream)
+    {
+        std::cerr << "Failed to write to file: " << m_filePath << std::endl;
+        return false;
+    }
+    return true;
+}
+
 bool FileOutputTarget::isReady() const
 {
     // Check if we can potentially write to this location
@@ -1,4 +1,7 @@
 #include "FileReader.h"
+#include "TextFileScanner.h"
+
+#include <algorithm>
 
 FileReader::FileReader(const std::string& filename): filename(filename) 
 {
@@ -6,16 +9,16 @@ FileReader::FileReader(const std::string& filename): filename(filename)
 
 // Reads lines from the file and returns them as a vector of strings
 std::vector<std::string> FileReader::readLines(){
-    std::ifstream file(filename);
-    if (!file.is_open()) {
-        throw std::runtime_error("Cannot open file: " + filename);
-    }
+    const MappedTextFile file(filename);
+    const std::string_view text = file.text();
 
     std::vector<std::string> lines;
-    std::string line;
+    lines.reserve(static_cast<std::size_t>(std::count(text.begin(), text.end(), '\n')) + 1);
 
-    while (std::getline(file, line)) {
-        lines.push_back(line);
+    LineScanner scanner(text);
+    std::string_view line;
+    while (scanner.next(line)) {
+        lines.emplace_back(line);
     }
 
     return lines;
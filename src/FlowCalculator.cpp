@@ -38,21 +38,31 @@ FlowCalculator::FlowCalculator(TurbineGeometry const *geometry,
         throw std::invalid_argument("FlowCalculator: transformer must be non-null");
 
     // Compute the full velocity field immediately on construction so all
-    // accessors are valid from the first call.
-    BuildInletField();
-    ApplyShear();
-    ApplyVeer();
+    // accessors are valid from the first call.  Shear and veer are skipped
+    // when the inlet (a TurbSim field) already contains the profile —
+    // ApplyShear() would otherwise overwrite its axial component.
+    std::vector<WVPMUtilities::Vec3D<double>> const global_positions =
+        geometry_->GlobalPositionsAtPsi(psi_);
+
+    BuildInletField(global_positions);
+    if (!inlet_->IncludesAtmosphericProfile())
+    {
+        std::vector<double> heights(global_positions.size());
+        for (std::size_t i = 0; i < heights.size(); ++i)
+            heights[i] = global_positions[i].z();
+
+        ApplyShear(heights);
+        ApplyVeer(heights);
+    }
     BuildLocalField();
 }
 
 // ─────────────────────────────────────────────────────────────────────────────
 // Step 1: Populate global_vels_ from the inlet provider
 // ─────────────────────────────────────────────────────────────────────────────
-void FlowCalculator::BuildInletField()
+void FlowCalculator::BuildInletField(
+    std::vector<WVPMUtilities::Vec3D<double>> const &global_positions)
 {
-    std::vector<WVPMUtilities::Vec3D<double>> global_positions =
-        geometry_->GlobalPositionsAtPsi(psi_);
-
     for (std::size_t i = 0; i < geometry_->num_sections(); ++i)
     {
         global_vels_[i] = inlet_->VelocityAt(global_positions[i], i);
@@ -62,38 +72,23 @@ void FlowCalculator::BuildInletField()
 // ─────────────────────────────────────────────────────────────────────────────
 // Step 2: Apply shear to axial component of each section's global velocity
 // ─────────────────────────────────────────────────────────────────────────────
-void FlowCalculator::ApplyShear()
+void FlowCalculator::ApplyShear(std::vector<double> const &heights)
 {
-    std::vector<WVPMUtilities::Vec3D<double>> global_positions =
-        geometry_->GlobalPositionsAtPsi(psi_);
+    std::vector<double> axial(heights.size());
+    shear_->VelocitiesAt(heights, geometry_->hub_height(), v_inf_, axial);
 
-    ShearInput si;
-    si.hub_height = geometry_->hub_height();
-    si.v_hub = v_inf_;
-
-    for (std::size_t i = 0; i < geometry_->num_sections(); ++i)
+    for (std::size_t i = 0; i < axial.size(); ++i)
     {
-        si.height = global_positions[i].z();
-        global_vels_[i][0] = shear_->VelocityAt(si);
+        global_vels_[i][0] = axial[i];
     }
 }
 
 // ─────────────────────────────────────────────────────────────────────────────
 // Step 3: Apply veer rotation to each section's global velocity vector
 // ─────────────────────────────────────────────────────────────────────────────
-void FlowCalculator::ApplyVeer()
+void FlowCalculator::ApplyVeer(std::vector<double> const &heights)
 {
-    std::vector<WVPMUtilities::Vec3D<double>> global_positions =
-        geometry_->GlobalPositionsAtPsi(psi_);
-
-    VeerInput vi;
-    vi.hub_height = geometry_->hub_height();
-
-    for (std::size_t i = 0; i < geometry_->num_sections(); ++i)
-    {
-        vi.height = global_positions[i].z();
-        global_vels_[i] = veer_->Apply(global_vels_[i], vi);
-    }
+    veer_->ApplyAt(heights, geometry_->hub_height(), global_vels_);
 }
 
 // ─────────────────────────────────────────────────────────────────────────────
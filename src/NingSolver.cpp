@@ -34,6 +34,8 @@ NingSolver::NingSolver(SolverConfig cfg)
         throw std::invalid_argument("NingSolver: all model dependencies must be non-null");
     if (!cfg_.turbine || !cfg_.sim_config || !cfg_.flow_calculator)
         throw std::invalid_argument("NingSolver: turbine, sim_config and flow_calculator must be non-null");
+    if (cfg_.phi_start && cfg_.phi_start->size() != num_sections_)
+        throw std::invalid_argument("NingSolver: phi_start must have one value per section");
 
     result_.phi.assign(num_sections_, 0.0);
     result_.a_ind_axi.assign(num_sections_, 0.0);
@@ -60,6 +62,28 @@ bool NingSolver::Solve()
     return result_.success;
 }
 
+// ─────────────────────────────────────────────────────────────────────────────
+// Staged solve — same steps as Solve(), driven by the caller
+// ─────────────────────────────────────────────────────────────────────────────
+void NingSolver::BeginSolve()
+{
+    Initialise();
+}
+
+void NingSolver::SolveSection(std::size_t sec)
+{
+    if (FindSolutionNearStart(sec))
+        return;
+    if (!FindSolutionPositiveRegion(sec))
+        FindSolutionNegativeRegion(sec);
+}
+
+bool NingSolver::EndSolve()
+{
+    FinaliseResult();
+    return result_.success;
+}
+
 // ─────────────────────────────────────────────────────────────────────────────
 // Initialise per-section constants
 // ─────────────────────────────────────────────────────────────────────────────
@@ -104,11 +128,7 @@ void NingSolver::SolveAllSections()
     #pragma omp parallel for schedule(dynamic, 1) default(none) \
         shared(n)
     for (int sec_i = 0; sec_i < n; ++sec_i)
-    {
-        const std::size_t sec = static_cast<std::size_t>(sec_i);
-        if (!FindSolutionPositiveRegion(sec))
-            FindSolutionNegativeRegion(sec);
-    }
+        SolveSection(static_cast<std::size_t>(sec_i));
 }
 
 // ─────────────────────────────────────────────────────────────────────────────
@@ -123,6 +143,44 @@ void NingSolver::FinaliseResult()
         LogFailedSections();
 }
 
+// ─────────────────────────────────────────────────────────────────────────────
+// Warm start: narrow bracket around cfg_.phi_start[sec]
+//
+// Only used for a start value inside (0, pi/2), the interval the positive
+// search tries first, and accepted under the same k > -1 condition.  A
+// small bracket lets Brent converge in a few residual evaluations; if it
+// holds no sign change the regular search runs unchanged.
+// ─────────────────────────────────────────────────────────────────────────────
+bool NingSolver::FindSolutionNearStart(std::size_t sec)
+{
+    if (!cfg_.phi_start)
+        return false;
+
+    constexpr double eps = 5e-9;
+    constexpr double half_width = 0.1; // [rad]
+    const double half_pi = M_PI / 2.0;
+
+    const double phi0 = (*cfg_.phi_start)[sec];
+    if (!(phi0 > eps && phi0 < half_pi))
+        return false;
+
+    const double lo = std::max(eps, phi0 - half_width);
+    const double hi = std::min(half_pi, phi0 + half_width);
+    if (!(Residual(lo, sec) * Residual(hi, sec) < 0.0))
+        return false;
+
+    auto root = cfg_.root_finder->Solve(
+        [&](double phi)
+        { return Residual(phi, sec); }, lo, hi);
+    if (root && k_cache_[sec] > -1.0)
+    {
+        result_.phi[sec] = *root;
+        converged_[sec] = 1;
+        return true;
+    }
+    return false;
+}
+
 // ─────────────────────────────────────────────────────────────────────────────
 // Search 0 to pi for a valid root
 // ─────────────────────────────────────────────────────────────────────────────
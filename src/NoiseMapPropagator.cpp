@@ -0,0 +1,182 @@
+/**
+ * @file NoiseMapPropagator.cpp
+ * @brief Observer-grid propagation of rotor noise sources — see header.
+ */
+#include "NoiseMapPropagator.h"
+
+#include "bladenoise/math/SpectralKernels.h"
+#include "bladenoise/noise/Directivity.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <stdexcept>
+
+namespace spectral = bladenoise::math::spectral;
+using bladenoise::noise::Directivity;
+
+// ─────────────────────────────────────────────────────────────────────────────
+// NoiseMapGrid
+// ─────────────────────────────────────────────────────────────────────────────
+NoiseMapGrid NoiseMapGrid::FromRanges(double x_start, double x_end, double x_step,
+                                      double y_start, double y_end, double y_step,
+                                      double z)
+{
+    if (x_step <= 0.0 || y_step <= 0.0)
+        throw std::invalid_argument("NoiseMapGrid::FromRanges: step must be > 0");
+
+    auto range = [](double start, double end, double step)
+    {
+        std::vector<double> v;
+        for (double s = start; s <= end + step * 1e-9; s += step)
+            v.push_back(s);
+        return v;
+    };
+
+    NoiseMapGrid grid;
+    grid.x = range(x_start, x_end, x_step);
+    grid.y = range(y_start, y_end, y_step);
+    grid.z = z;
+    return grid;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Construction
+// ─────────────────────────────────────────────────────────────────────────────
+NoiseMapPropagator::NoiseMapPropagator(int    n_blades,
+                                       double hub_height,
+                                       double overhang,
+                                       int    n_azimuth)
+    : n_blades_(n_blades)
+    , hub_height_(hub_height)
+    , overhang_(overhang)
+    , n_azimuth_(n_azimuth)
+{
+    if (n_blades_ < 1)
+        throw std::invalid_argument("NoiseMapPropagator: n_blades must be >= 1");
+    if (n_azimuth_ < 1)
+        throw std::invalid_argument("NoiseMapPropagator: n_azimuth must be >= 1");
+
+    sin_psi_.resize(n_azimuth_);
+    cos_psi_.resize(n_azimuth_);
+    for (int a = 0; a < n_azimuth_; ++a)
+    {
+        const double psi = 2.0 * std::numbers::pi * a / n_azimuth_;
+        sin_psi_[a] = std::sin(psi);
+        cos_psi_[a] = std::cos(psi);
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Accumulate
+// ─────────────────────────────────────────────────────────────────────────────
+void NoiseMapPropagator::Accumulate(RotorNoiseSource const &source,
+                                    double x, double y, double z,
+                                    double *p) const
+{
+    const std::size_t n_bands = source.frequencies.size();
+
+    // Time average over one revolution of all blades
+    const double weight = static_cast<double>(n_blades_) / n_azimuth_;
+
+    // Observer relative to the hub centre
+    const double ox = x + overhang_;
+    const double oz = z - hub_height_;
+
+    for (auto const &sec : source.sections)
+    {
+        const double *p_low  = sec.p_low.data();
+        const double *p_high = sec.p_high.data();
+
+        for (int a = 0; a < n_azimuth_; ++a)
+        {
+            const double s = sin_psi_[a];
+            const double c = cos_psi_[a];
+
+            // Section (hub + r·e_r) to observer
+            const double vx = ox;
+            const double vy = y - sec.radius * s;
+            const double vz = oz - sec.radius * c;
+            const double r2 = vx * vx + vy * vy + vz * vz;
+            if (r2 < 1e-12) continue;
+
+            // Direction cosines in the section frame: chord along -e_t,
+            // normal along the rotor axis, so sin²θ·sin²φ = (v·x̂)² / r²
+            const double cos_t = (s * vz - c * vy) / std::sqrt(r2);
+            const double sin2  = vx * vx / r2;
+
+            const double w = weight / r2;
+            const double d_low  = w * Directivity::low_frequency_cos(sec.mach, cos_t, sin2);
+            const double d_high = w * Directivity::high_frequency_cos(sec.mach, cos_t, sin2);
+
+            #pragma omp simd
+            for (std::size_t k = 0; k < n_bands; ++k)
+                p[k] += d_low * p_low[k] + d_high * p_high[k];
+        }
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Propagate
+// ─────────────────────────────────────────────────────────────────────────────
+NoiseMapResult NoiseMapPropagator::Propagate(RotorNoiseSource const &source,
+                                             NoiseMapGrid     const &grid) const
+{
+    NoiseMapResult out;
+    out.vinf            = source.vinf;
+    out.observer_height = grid.z;
+    out.x               = grid.x;
+    out.y               = grid.y;
+
+    const std::size_t n_obs = out.size();
+    out.oaspl.assign(n_obs, -100.0);
+    out.oasplA.assign(n_obs, -100.0);
+
+    const std::size_t n_bands = source.frequencies.size();
+    if (n_obs == 0 || n_bands == 0 || source.sections.empty())
+        return out;
+
+    // Linear A-weighting factors per band
+    std::vector<double> a_lin(n_bands);
+    for (std::size_t k = 0; k < n_bands; ++k)
+        a_lin[k] = spectral::from_dB(spectral::a_weighting(source.frequencies[k]));
+
+    const std::size_t nx = grid.x.size();
+
+    #pragma omp parallel
+    {
+        std::vector<double> p(n_bands);
+
+        #pragma omp for schedule(static)
+        for (std::size_t idx = 0; idx < n_obs; ++idx)
+        {
+            std::fill(p.begin(), p.end(), 0.0);
+            Accumulate(source, grid.x[idx % nx], grid.y[idx / nx], grid.z, p.data());
+
+            double sum = 0.0, sum_a = 0.0;
+            for (std::size_t k = 0; k < n_bands; ++k)
+            {
+                sum   += p[k];
+                sum_a += p[k] * a_lin[k];
+            }
+            if (sum > 0.0)   out.oaspl[idx]  = spectral::to_dB(sum);
+            if (sum_a > 0.0) out.oasplA[idx] = spectral::to_dB(sum_a);
+        }
+    }
+
+    return out;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Spectrum
+// ─────────────────────────────────────────────────────────────────────────────
+std::vector<double> NoiseMapPropagator::Spectrum(RotorNoiseSource const &source,
+                                                 double x, double y, double z) const
+{
+    std::vector<double> p(source.frequencies.size(), 0.0);
+    Accumulate(source, x, y, z, p.data());
+
+    for (double &v : p)
+        v = v > 0.0 ? spectral::to_dB(v) : -100.0;
+    return p;
+}
@@ -0,0 +1,131 @@
+/**
+ * @file NoiseSpectrumStore.cpp
+ * @brief Columnar float32 noise spectra — see header.
+ */
+#include "NoiseSpectrumStore.h"
+
+#include "bladenoise/math/SpectralKernels.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace spectral = bladenoise::math::spectral;
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Construction
+// ─────────────────────────────────────────────────────────────────────────────
+NoiseSpectrumStore::NoiseSpectrumStore(std::size_t         n_points,
+                                       std::size_t         n_sections,
+                                       std::vector<double> frequencies)
+    : n_points_(n_points)
+    , n_sections_(n_sections)
+    , frequencies_(std::move(frequencies))
+{
+    const std::size_t n_slots = n_points_ * n_sections_ * N_SOURCES;
+    const float floor_db = static_cast<float>(spectral::FLOOR_DB);
+
+    vinf_.assign(n_points_, 0.0);
+    counts_.assign(n_points_, 0);
+    info_.assign(n_points_ * n_sections_, NoiseSectionInfo{});
+    oaspl_.assign(n_slots, floor_db);
+    crossover_.assign(n_slots, 0.0);
+    spl_.assign(n_slots * frequencies_.size(), floor_db);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Writing
+// ─────────────────────────────────────────────────────────────────────────────
+void NoiseSpectrumStore::BeginPoint(std::size_t point, BladeNoiseResult const &layout)
+{
+    if (point >= n_points_ || layout.sections.size() > n_sections_)
+        throw std::invalid_argument("NoiseSpectrumStore::BeginPoint: point or sections out of range");
+
+    vinf_[point]   = layout.vinf;
+    counts_[point] = layout.sections.size();
+    for (std::size_t s = 0; s < layout.sections.size(); ++s)
+        AssignInfo(point, s, layout.sections[s]);
+}
+
+void NoiseSpectrumStore::Assign(std::size_t point, std::size_t sec,
+                                SectionNoiseResult const &result)
+{
+    AssignInfo(point, sec, result);
+
+    const std::size_t n_bands = bands();
+    for (std::size_t k = 0; k < N_SOURCES; ++k)
+    {
+        SectionNoiseSpectrum const &sp = result.*kNoiseSourceSpectra[k];
+        const std::size_t slot = Slot(point, sec, static_cast<NoiseSource>(k));
+
+        oaspl_[slot]     = static_cast<float>(sp.oaspl);
+        crossover_[slot] = sp.directivity_crossover_hz;
+
+        float *dst = spl_.data() + slot * n_bands;
+        const std::size_t n = std::min(n_bands, sp.spl.size());
+        for (std::size_t b = 0; b < n; ++b)
+            dst[b] = static_cast<float>(sp.spl[b]);
+        std::fill(dst + n, dst + n_bands, static_cast<float>(spectral::FLOOR_DB));
+    }
+}
+
+void NoiseSpectrumStore::AssignInfo(std::size_t point, std::size_t sec,
+                                    SectionNoiseResult const &result)
+{
+    CheckSlot(point, sec);
+
+    NoiseSectionInfo &info = info_[point * n_sections_ + sec];
+    info.section_index     = result.section_index;
+    info.radius            = result.radius;
+    info.chord             = result.chord;
+    info.span              = result.span;
+    info.velocity          = result.velocity;
+    info.reynolds          = result.reynolds;
+    info.mach              = result.mach;
+    info.alpha_deg         = result.alpha_deg;
+    info.observer_distance = result.observer_distance;
+    info.observer_theta    = result.observer_theta;
+    info.observer_phi      = result.observer_phi;
+    info.converged         = result.converged;
+}
+
+void NoiseSpectrumStore::CopySpectra(std::size_t from, std::size_t to, std::size_t sec)
+{
+    CheckSlot(from, sec);
+    CheckSlot(to, sec);
+
+    const std::size_t src = Slot(from, sec, NoiseSource{});
+    const std::size_t dst = Slot(to, sec, NoiseSource{});
+    std::copy_n(oaspl_.begin() + src, N_SOURCES, oaspl_.begin() + dst);
+    std::copy_n(crossover_.begin() + src, N_SOURCES, crossover_.begin() + dst);
+    std::copy_n(spl_.begin() + src * bands(), N_SOURCES * bands(),
+                spl_.begin() + dst * bands());
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Reading
+// ─────────────────────────────────────────────────────────────────────────────
+void NoiseSpectrumStore::spectrum(std::size_t point, std::size_t sec, NoiseSource src,
+                                  std::span<double> out) const
+{
+    const float *spl = spl_.data() + Slot(point, sec, src) * bands();
+    const std::size_t n = std::min(out.size(), bands());
+    std::copy_n(spl, n, out.begin());
+    std::fill(out.begin() + n, out.end(), spectral::FLOOR_DB);
+}
+
+std::size_t NoiseSpectrumStore::memory_bytes() const
+{
+    return frequencies_.size() * sizeof(double)
+         + vinf_.size()      * sizeof(double)
+         + counts_.size()    * sizeof(std::size_t)
+         + info_.size()      * sizeof(NoiseSectionInfo)
+         + oaspl_.size()     * sizeof(float)
+         + crossover_.size() * sizeof(double)
+         + spl_.size()       * sizeof(float);
+}
+
+void NoiseSpectrumStore::CheckSlot(std::size_t point, std::size_t sec) const
+{
+    if (point >= n_points_ || sec >= n_sections_)
+        throw std::invalid_argument("NoiseSpectrumStore: (point, section) out of range");
+}
@@ -52,9 +52,14 @@ OperationSolver::OperationSolver(OperationSolverParams params,
 
 // ─────────────────────────────────────────────────────────────────────────────
 // Run — iterate over all wind speeds at fixed pitch_deg
+//
+// Journal records: the sweep (pitch, wind speeds) first, then per wind speed
+// the PowerCurvePoint and the (lambda, pitch) of its FULL_LOADS callback.
 // ─────────────────────────────────────────────────────────────────────────────
 std::vector<PowerCurvePoint>
-OperationSolver::Run(double pitch_deg, std::vector<double> const &vinf_vec)
+OperationSolver::Run(double pitch_deg,
+                     std::vector<double> const &vinf_vec,
+                     CheckpointJournal *journal)
 {
     if (vinf_vec.empty())
         return {};
@@ -62,21 +67,75 @@ OperationSolver::Run(double pitch_deg, std::vector<double> const &vinf_vec)
     std::vector<PowerCurvePoint> results;
     results.reserve(vinf_vec.size());
 
+    std::size_t n_restored = 0;
+    std::vector<std::string> const *restored = nullptr;
+    if (journal)
+    {
+        BinaryWriter sweep;
+        sweep.f64(pitch_deg);
+        sweep.doubles(vinf_vec);
+
+        restored = &journal->restored();
+        if (!restored->empty() && restored->front() == sweep.bytes())
+        {
+            n_restored = std::min(restored->size() - 1, vinf_vec.size());
+        }
+        else
+        {
+            journal->KeepRestored(0);
+            journal->Append(sweep.take());
+        }
+        if (n_restored > 0)
+            std::cout << "  OperationSolver: " << n_restored << "/" << vinf_vec.size()
+                      << " wind speeds restored from " << journal->path() << "\n";
+    }
+
     // Warm-start vtip: ask the controller what it would do at the first wind
     // speed with zero electrical power (sub-rated, initial guess).
     ControllerInput ci0{vinf_vec.front(), 0.0};
     ControllerOutput co0 = controller_->ComputeOperatingPoint(ci0);
     double vtip = co0.vtip;
 
-    for (double vinf : vinf_vec)
+    for (std::size_t k = 0; k < vinf_vec.size(); ++k)
     {
-        PowerCurvePoint pt = ConvergeOnePoint(vinf, vtip, pitch_deg);
+        const double vinf = vinf_vec[k];
+        PowerCurvePoint pt;
+        if (k < n_restored)
+        {
+            BinaryReader in((*restored)[k + 1]);
+            pt = in.pod<PowerCurvePoint>();
+            const double lambda = in.f64();
+            const double pitch = in.f64();
+            FullLoads(vinf, lambda, pitch);
+        }
+        else
+        {
+            pt = ConvergeOnePoint(vinf, vtip, pitch_deg);
+            if (journal)
+            {
+                BinaryWriter rec;
+                rec.pod(pt);
+                rec.f64(full_loads_lambda_);
+                rec.f64(full_loads_pitch_);
+                journal->Append(rec.take());
+            }
+        }
         vtip = pt.vtip; // warm-start next wind speed
         results.push_back(pt);
     }
     return results;
 }
 
+// ─────────────────────────────────────────────────────────────────────────────
+// FullLoads — the one detailed callback per wind speed
+// ─────────────────────────────────────────────────────────────────────────────
+void OperationSolver::FullLoads(double vinf, double lambda, double pitch_deg)
+{
+    full_loads_lambda_ = lambda;
+    full_loads_pitch_ = pitch_deg;
+    bem_(vinf, lambda, pitch_deg, PostprocessDetail::FULL_LOADS);
+}
+
 // ─────────────────────────────────────────────────────────────────────────────
 // ConvergeOnePoint — inner loop for a single wind speed
 // ─────────────────────────────────────────────────────────────────────────────
@@ -92,12 +151,14 @@ PowerCurvePoint OperationSolver::ConvergeOnePoint(double vinf,
     double p_el = 0.0;
     double vtip = vtip_inout;
     double lambda = 0;
+    double gamma_bem = gamma; // pitch of the most recent scalar BEM call
 
     for (int iter = 0; iter < static_cast<int>(p_.max_iter); ++iter)
     {
         // ── BEM solve ──────────────────────────────────────────────────────
         lambda = (vinf > 0.0) ? vtip / vinf : 0.0;
-        auto [cp, ct] = bem_(vinf, lambda, gamma);
+        gamma_bem = gamma;
+        auto [cp, ct] = bem_(vinf, lambda, gamma, PostprocessDetail::ROTOR_SCALARS);
 
         // ── Mechanical quantities ──────────────────────────────────────────
         double p_aero = cp * pt.p_wind;
@@ -117,7 +178,7 @@ PowerCurvePoint OperationSolver::ConvergeOnePoint(double vinf,
             gamma = co.pitch;
             lambda = (vinf > 0.0) ? vtip / vinf : 0.0;
 
-            auto [cp2, ct2] = bem_(vinf, lambda, gamma);
+            auto [cp2, ct2] = bem_(vinf, lambda, gamma, PostprocessDetail::ROTOR_SCALARS);
             p_aero = cp2 * pt.p_wind;
             omega = (p_.rotor_radius > 0.0) ? vtip / p_.rotor_radius : 0.0;
             torque = (omega > 1e-9) ? p_aero / omega : 0.0;
@@ -126,6 +187,7 @@ PowerCurvePoint OperationSolver::ConvergeOnePoint(double vinf,
             p_el = std::min(eta * p_aero, p_.p_max);
 
             FillResult(pt, vtip, lambda, gamma, cp2, p_aero, n_rpm, torque, eta, p_el, ct2);
+            FullLoads(vinf, lambda, gamma);
             vtip_inout = vtip;
             return pt;
         }
@@ -145,6 +207,7 @@ PowerCurvePoint OperationSolver::ConvergeOnePoint(double vinf,
         if (res < 1e-3 && iter >= static_cast<int>(p_.min_iter))
         {
             FillResult(pt, vtip, lambda, gamma, cp, p_aero, n_rpm, torque, eta, p_el, ct);
+            FullLoads(vinf, lambda, gamma_bem);
             vtip_inout = vtip;
             return pt;
         }
@@ -153,6 +216,10 @@ PowerCurvePoint OperationSolver::ConvergeOnePoint(double vinf,
     std::cout << " * WARNING: OperationSolver did not converge for v_inf = "
               << vinf << " m/s\n";
 
+    // Still emit the detailed result for the last iterate so callers that
+    // collect one FULL_LOADS result per wind speed stay index-aligned.
+    FullLoads(vinf, lambda, gamma_bem);
+
     // Return best estimate even if not fully converged
     // double lambda = (vinf > 0.0) ? vtip / vinf : 0.0;
     // auto [cp, ct] = bem_(vinf, lambda, gamma);
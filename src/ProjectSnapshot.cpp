@@ -0,0 +1,597 @@
+#include "ProjectSnapshot.h"
+
+#include "BinaryRecord.h"
+#include "bladenoise/core/Hash.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace {
+
+constexpr char MAGIC[8] = { 'S', 'O', 'L', 'I', 'D', 'S', 'N', 'P' };
+constexpr std::uint32_t BYTE_ORDER_MARK = 0x01020304u;
+
+// Header: magic, version, byte-order mark, build identity (u64 length +
+// bytes), payload size, checksum.  Magic through byte-order mark are fixed.
+constexpr std::size_t FIXED_HEADER_SIZE = sizeof(MAGIC) + 4 + 4;
+
+// Type tags of stored configuration values
+enum class ValueType : std::uint8_t { Double = 0, Int = 1, Bool = 2, String = 3 };
+
+constexpr char SNAPSHOT[] = "Project snapshot";
+
+// ---------------------------------------------------------------------------
+// Coordinates
+// ---------------------------------------------------------------------------
+
+void writeCoordinates(BinaryWriter& out, const std::vector<AirfoilCoordinate>& coords) {
+    out.u64(coords.size());
+    for (const auto& c : coords) {
+        out.i32(c.index);
+        out.f64(c.x);
+        out.f64(c.y);
+        out.f64(c.z);
+        out.flag(c.isTopSurface);
+        out.flag(c.isTrailingEdge);
+        out.flag(c.isTETopEdge);
+        out.flag(c.isTEBottomEdge);
+    }
+}
+
+std::vector<AirfoilCoordinate> readCoordinates(BinaryReader& in) {
+    const std::size_t n = in.count(4 + 3 * 8 + 4);
+    std::vector<AirfoilCoordinate> coords;
+    coords.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const int index = in.i32();
+        const double x = in.f64();
+        const double y = in.f64();
+        const double z = in.f64();
+        const bool isTop = in.flag();
+        const bool isTE = in.flag();
+        const bool isTETE = in.flag();
+        const bool isTEBE = in.flag();
+        coords.emplace_back(index, x, y, z, isTop, isTE, isTETE, isTEBE);
+    }
+    return coords;
+}
+
+// ---------------------------------------------------------------------------
+// Input fingerprints
+// ---------------------------------------------------------------------------
+
+struct Fingerprint {
+    std::string path;
+    std::int64_t size = -1;   ///< -1 if the file does not exist
+    std::int64_t mtime = 0;   ///< Last write time (file clock ticks)
+};
+
+Fingerprint fingerprintOf(const std::string& path) {
+    Fingerprint fp;
+    fp.path = path;
+
+    std::error_code ec;
+    const auto size = std::filesystem::file_size(path, ec);
+    if (ec) return fp;
+    const auto time = std::filesystem::last_write_time(path, ec);
+    if (ec) return fp;
+
+    fp.size = static_cast<std::int64_t>(size);
+    fp.mtime = static_cast<std::int64_t>(time.time_since_epoch().count());
+    return fp;
+}
+
+// Project file first, then every referenced data file (string values naming
+// an existing file plus all entries of the airfoil file lists).
+std::vector<std::string> collectInputFiles(const std::string& projectFile, const Configuration& config) {
+    std::vector<std::string> files;
+
+    for (const auto& [key, value] : config.getValues()) {
+        const auto* text = std::any_cast<std::string>(&value);
+        std::error_code ec;
+        if (text && std::filesystem::is_regular_file(*text, ec))
+            files.push_back(*text);
+    }
+    if (const auto* list = config.getAirfoilPerformanceFileList())
+        for (const auto& info : list->getFileInfos()) files.push_back(info.filePath);
+    if (const auto* list = config.getAirfoilGeometryFileList())
+        for (const auto& info : list->getFileInfos()) files.push_back(info.filePath);
+
+    std::sort(files.begin(), files.end());
+    files.erase(std::unique(files.begin(), files.end()), files.end());
+    files.erase(std::remove(files.begin(), files.end(), projectFile), files.end());
+    files.insert(files.begin(), projectFile);
+    return files;
+}
+
+// ---------------------------------------------------------------------------
+// Data objects
+// ---------------------------------------------------------------------------
+
+void writePolar(BinaryWriter& out, const AirfoilPolarData& polar) {
+    out.flag(polar.hasInterpolationStrategy());
+    out.str(polar.getName());
+    out.f64(polar.getRelativeThickness());
+    out.f64(polar.getDepang());
+    out.i32(polar.getNAlpha());
+    out.i32(polar.getNVals());
+    out.f64(polar.getXa());
+    out.strings(polar.getHeaders());
+
+    const auto& points = polar.getPolarData();
+    out.u64(points.size());
+    for (const auto& p : points) {
+        out.f64(p.condition.reynolds);
+        out.f64(p.condition.mach);
+        out.f64(p.condition.alpha);
+        out.f64(p.coefficients.cl);
+        out.f64(p.coefficients.cd);
+        out.f64(p.coefficients.cm);
+    }
+}
+
+std::unique_ptr<AirfoilPolarData> readPolar(BinaryReader& in) {
+    const bool hasStrategy = in.flag();
+    std::string name = in.str();
+
+    // The named constructor attaches the linear strategy interpolated polars use
+    auto polar = hasStrategy ? std::make_unique<AirfoilPolarData>(name)
+                             : std::make_unique<AirfoilPolarData>();
+    polar->setName(name);
+    polar->setRelativeThickness(in.f64());
+    polar->setDepang(in.f64());
+    polar->setNAlpha(in.i32());
+    polar->setNVals(in.i32());
+    polar->setXa(in.f64());
+    for (const auto& header : in.strings()) polar->addHeader(header);
+
+    const std::size_t n = in.count(6 * 8);
+    for (std::size_t i = 0; i < n; ++i) {
+        const double reynolds = in.f64();
+        const double mach = in.f64();
+        const double alpha = in.f64();
+        AirfoilAeroCoefficients coefficients;
+        coefficients.cl = in.f64();
+        coefficients.cd = in.f64();
+        coefficients.cm = in.f64();
+        polar->addPolarPoint(AirfoilOperationCondition(reynolds, mach, alpha), coefficients);
+    }
+    return polar;
+}
+
+void writeAirfoilGeometry(BinaryWriter& out, const AirfoilGeometryData& geometry) {
+    out.str(geometry.getName());
+    out.f64(geometry.getRelativeThickness());
+
+    const auto& markers = geometry.getMarkers();
+    out.u64(markers.size());
+    for (const auto& marker : markers) {
+        out.str(marker.type);
+        out.i32(marker.index);
+    }
+
+    writeCoordinates(out, geometry.getCoordinates());
+    writeCoordinates(out, geometry.getScaledAndRotatedCoordinates());
+    out.strings(geometry.getHeaders());
+    out.flag(geometry.getCoordinateOrientation());
+}
+
+std::unique_ptr<AirfoilGeometryData> readAirfoilGeometry(BinaryReader& in) {
+    auto geometry = std::make_unique<AirfoilGeometryData>();
+    geometry->setName(in.str());
+    geometry->setRelativeThickness(in.f64());
+
+    const std::size_t nMarkers = in.count(8 + 4);
+    for (std::size_t i = 0; i < nMarkers; ++i) {
+        std::string type = in.str();
+        geometry->addMarker(type, in.i32());
+    }
+
+    for (const auto& c : readCoordinates(in))
+        geometry->addCoordinate(c.index, c.x, c.y, c.z,
+                                c.isTopSurface, c.isTrailingEdge, c.isTETopEdge, c.isTEBottomEdge);
+    geometry->setScaledCoordinates(readCoordinates(in));
+    for (const auto& header : in.strings()) geometry->addHeader(header);
+    geometry->setCoordinateOrientation(in.flag());
+    return geometry;
+}
+
+void writeSection(BinaryWriter& out, const BladeGeometrySection& section) {
+    out.str(section.type);
+    for (const double value : { section.bladeRadius, section.chord, section.twist,
+                                section.relativeThickness, section.xt4, section.yt4,
+                                section.pcbaX, section.pcbaY, section.relativeTwistAxis,
+                                section.thicknessAbs_mm, section.trailingEdge_mm,
+                                section.prebend_mm, section.chordWithTES_m,
+                                section.gammaPrebend_deg, section.radiusPrebend_m,
+                                section.relThick001, section.relThick01, section.teAngle_deg })
+        out.f64(value);
+    out.str(section.addOns);
+    out.str(section.airfoilName);
+    writeCoordinates(out, section.coordinates);
+    writeCoordinates(out, section.scaledCoordinates);
+    writeCoordinates(out, section.transformedCoordinates);
+
+    out.flag(section.airfoilPolar != nullptr);
+    if (section.airfoilPolar) writePolar(out, *section.airfoilPolar);
+    out.flag(section.airfoilGeometry != nullptr);
+    if (section.airfoilGeometry) writeAirfoilGeometry(out, *section.airfoilGeometry);
+}
+
+// Fills in place: the copy constructor of BladeGeometrySection (also used for
+// moves) does not carry the polar and airfoil geometry over.
+void readSection(BinaryReader& in, BladeGeometrySection& section) {
+    section.type = in.str();
+    for (double* value : { &section.bladeRadius, &section.chord, &section.twist,
+                           &section.relativeThickness, &section.xt4, &section.yt4,
+                           &section.pcbaX, &section.pcbaY, &section.relativeTwistAxis,
+                           &section.thicknessAbs_mm, &section.trailingEdge_mm,
+                           &section.prebend_mm, &section.chordWithTES_m,
+                           &section.gammaPrebend_deg, &section.radiusPrebend_m,
+                           &section.relThick001, &section.relThick01, &section.teAngle_deg })
+        *value = in.f64();
+    section.addOns = in.str();
+    section.airfoilName = in.str();
+    section.coordinates = readCoordinates(in);
+    section.scaledCoordinates = readCoordinates(in);
+    section.transformedCoordinates = readCoordinates(in);
+
+    if (in.flag()) section.airfoilPolar = readPolar(in);
+    if (in.flag()) section.airfoilGeometry = readAirfoilGeometry(in);
+}
+
+void writeBladeGeometry(BinaryWriter& out, const BladeGeometryData& blade) {
+    out.strings(blade.getHeaders());
+    out.str(blade.getVersion());
+    out.str(blade.getSourceFileName());
+    out.f64(blade.getHubRadius());
+    out.u64(blade.getRows().size());
+    for (const auto& row : blade.getRows()) writeSection(out, row);
+}
+
+std::unique_ptr<BladeGeometryData> readBladeGeometry(BinaryReader& in) {
+    auto blade = std::make_unique<BladeGeometryData>();
+    for (const auto& header : in.strings()) blade->addHeader(header);
+    blade->setVersion(in.str());
+    blade->setSourceFileName(in.str());
+    blade->setHubRadius(in.f64());
+    const std::size_t n = in.count(8);
+    for (std::size_t i = 0; i < n; ++i) {
+        BladeGeometrySection row;
+        readSection(in, row);
+        blade->addRow(std::move(row));
+    }
+    return blade;
+}
+
+template <typename FileList>
+void writeFileList(BinaryWriter& out, const FileList& list) {
+    out.strings(list.getHeaders());
+    out.u64(list.getFileInfos().size());
+    for (const auto& info : list.getFileInfos()) out.str(info.filePath);
+}
+
+template <typename FileList>
+std::unique_ptr<FileList> readFileList(BinaryReader& in) {
+    auto list = std::make_unique<FileList>();
+    for (const auto& header : in.strings()) list->addHeader(header);
+    for (const auto& path : in.strings()) list->addFilePath(path);
+    return list;
+}
+
+void writeControlSettings(BinaryWriter& out, const TurbineControlSettingsData& settings) {
+    out.u64(settings.features.size());
+    for (const auto& feature : settings.features) {
+        out.str(feature.name);
+        out.f64(feature.factor);
+        out.str(feature.unit);
+        out.u64(feature.entries.size());
+        for (const auto& entry : feature.entries) {
+            out.str(entry.scope);
+            out.str(entry.turbine_id);
+            out.str(entry.mode);
+            out.str(entry.power_type);
+            out.doubles(entry.values);
+        }
+    }
+}
+
+TurbineControlSettingsData readControlSettings(BinaryReader& in) {
+    TurbineControlSettingsData settings;
+    settings.features.resize(in.count(8 + 8 + 8 + 8));
+    for (auto& feature : settings.features) {
+        feature.name = in.str();
+        feature.factor = in.f64();
+        feature.unit = in.str();
+        feature.entries.resize(in.count(5 * 8));
+        for (auto& entry : feature.entries) {
+            entry.scope = in.str();
+            entry.turbine_id = in.str();
+            entry.mode = in.str();
+            entry.power_type = in.str();
+            entry.values = in.doubles();
+        }
+    }
+    return settings;
+}
+
+void writeValue(BinaryWriter& out, const std::string& key, const std::any& value) {
+    out.str(key);
+    if (const auto* d = std::any_cast<double>(&value)) {
+        out.pod(ValueType::Double);
+        out.f64(*d);
+    }
+    else if (const auto* i = std::any_cast<int>(&value)) {
+        out.pod(ValueType::Int);
+        out.i32(*i);
+    }
+    else if (const auto* b = std::any_cast<bool>(&value)) {
+        out.pod(ValueType::Bool);
+        out.flag(*b);
+    }
+    else if (const auto* s = std::any_cast<std::string>(&value)) {
+        out.pod(ValueType::String);
+        out.str(*s);
+    }
+    else {
+        throw std::runtime_error("Configuration value '" + key + "' has a type the snapshot cannot store");
+    }
+}
+
+void readValue(BinaryReader& in, Configuration& config) {
+    std::string key = in.str();
+    switch (in.pod<ValueType>()) {
+    case ValueType::Double: config.setValue(key, in.f64()); break;
+    case ValueType::Int:    config.setValue(key, static_cast<int>(in.i32())); break;
+    case ValueType::Bool:   config.setValue(key, in.flag()); break;
+    case ValueType::String: config.setValue(key, in.str()); break;
+    default:
+        throw std::runtime_error("Project snapshot has an unknown value type for '" + key + "'");
+    }
+}
+
+}  // namespace
+
+// ---------------------------------------------------------------------------
+// ProjectSnapshot
+// ---------------------------------------------------------------------------
+
+ProjectSnapshot::ProjectSnapshot(MappedTextFile mapped) : file(std::move(mapped)) {
+}
+
+std::string ProjectSnapshot::defaultPath(const std::string& projectFile) {
+    return projectFile + ".snap";
+}
+
+std::uint64_t ProjectSnapshot::schemaId(const ConfigurationSchema& schema) {
+    std::uint64_t hash = bladenoise::Fnv1a::OFFSET_BASIS;
+    for (const auto& param : schema.getParameters()) {
+        hash = bladenoise::fnv1a(param.name, hash);
+        hash = bladenoise::fnv1a(param.required ? "R" : "O", hash);
+        if (param.isMultiValue)
+            for (const auto& key : param.multiParser->getOutputKeys())
+                hash = bladenoise::fnv1a(key + '\n', hash);
+        hash = bladenoise::fnv1a("\n", hash);
+    }
+    return hash;
+}
+
+std::uint64_t ProjectSnapshot::inputsId(const std::string& projectFile, const Configuration& config) {
+    BinaryWriter out;
+    for (const auto& path : collectInputFiles(projectFile, config)) {
+        const Fingerprint fp = fingerprintOf(path);
+        out.str(fp.path);
+        out.i64(fp.size);
+        out.i64(fp.mtime);
+    }
+    return bladenoise::fnv1a(out.bytes());
+}
+
+void ProjectSnapshot::write(const std::string& snapshotPath, const std::string& projectFile,
+                            std::uint64_t schemaId, const Configuration& config,
+                            const BladeInterpolator& blade, std::string_view buildId) {
+    BinaryWriter out;
+
+    out.u64(schemaId);
+
+    const std::vector<std::string> inputs = collectInputFiles(projectFile, config);
+    out.u64(inputs.size());
+    for (const auto& path : inputs) {
+        const Fingerprint fp = fingerprintOf(path);
+        out.str(fp.path);
+        out.i64(fp.size);
+        out.i64(fp.mtime);
+    }
+
+    // Sorted keys keep the file identical for identical input
+    std::vector<std::string> keys;
+    for (const auto& [key, value] : config.getValues()) keys.push_back(key);
+    std::sort(keys.begin(), keys.end());
+    out.u64(keys.size());
+    for (const auto& key : keys) writeValue(out, key, config.getValues().at(key));
+
+    const BladeGeometryData* bladeGeometry = config.getBladeGeometry();
+    out.flag(bladeGeometry != nullptr);
+    if (bladeGeometry) writeBladeGeometry(out, *bladeGeometry);
+
+    const auto* performanceList = config.getAirfoilPerformanceFileList();
+    out.flag(performanceList != nullptr);
+    if (performanceList) writeFileList(out, *performanceList);
+
+    const auto* geometryList = config.getAirfoilGeometryFileList();
+    out.flag(geometryList != nullptr);
+    if (geometryList) writeFileList(out, *geometryList);
+
+    const TurbineControlSettingsData* settings = config.getTurbineControlSettings();
+    out.flag(settings != nullptr);
+    if (settings) writeControlSettings(out, *settings);
+
+    const auto geometries = config.getAirfoilGeometries();
+    out.u64(geometries.size());
+    for (const auto* geometry : geometries) writeAirfoilGeometry(out, *geometry);
+
+    const auto polars = config.getAirfoilPerformances();
+    out.u64(polars.size());
+    for (const auto* polar : polars) writePolar(out, *polar);
+
+    const auto& sections = blade.getBladeSections();
+    out.u64(sections.size());
+    for (const auto& section : sections) writeSection(out, *section);
+
+    BinaryWriter header;
+    header.raw(std::string_view(MAGIC, sizeof(MAGIC)));
+    header.pod(FORMAT_VERSION);
+    header.pod(BYTE_ORDER_MARK);
+    header.str(buildId);
+    header.u64(out.bytes().size());
+    header.u64(bladenoise::fnv1a(out.bytes()));
+
+    const std::string tmpPath = snapshotPath + ".tmp";
+    {
+        std::ofstream stream(tmpPath, std::ios::binary | std::ios::trunc);
+        if (!stream)
+            throw std::runtime_error("Cannot open snapshot file for writing: " + tmpPath);
+        stream.write(header.bytes().data(), static_cast<std::streamsize>(header.bytes().size()));
+        stream.write(out.bytes().data(), static_cast<std::streamsize>(out.bytes().size()));
+        if (!stream)
+            throw std::runtime_error("Cannot write snapshot file: " + tmpPath);
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tmpPath, snapshotPath, ec);
+    if (ec) {
+        std::filesystem::remove(tmpPath, ec);
+        throw std::runtime_error("Cannot replace snapshot file: " + snapshotPath);
+    }
+}
+
+std::unique_ptr<ProjectSnapshot> ProjectSnapshot::load(const std::string& snapshotPath,
+                                                       const std::string& projectFile,
+                                                       std::uint64_t schemaId,
+                                                       std::string& reason,
+                                                       std::string_view buildId) {
+    reason.clear();
+
+    std::error_code ec;
+    if (!std::filesystem::is_regular_file(snapshotPath, ec))
+        return nullptr;
+
+    try {
+        std::unique_ptr<ProjectSnapshot> snapshot(new ProjectSnapshot(MappedTextFile(snapshotPath)));
+        const std::string_view bytes = snapshot->file.text();
+
+        // ── Header ──
+        if (bytes.size() < FIXED_HEADER_SIZE || bytes.substr(0, sizeof(MAGIC)) != std::string_view(MAGIC, sizeof(MAGIC))) {
+            reason = "not a project snapshot";
+            return nullptr;
+        }
+        BinaryReader head(bytes, sizeof(MAGIC), SNAPSHOT);
+        const auto version = head.pod<std::uint32_t>();
+        const auto byteOrder = head.pod<std::uint32_t>();
+
+        if (version != FORMAT_VERSION) {
+            reason = "format version " + std::to_string(version) + ", expected " + std::to_string(FORMAT_VERSION);
+            return nullptr;
+        }
+        if (byteOrder != BYTE_ORDER_MARK) {
+            reason = "written with a different byte order";
+            return nullptr;
+        }
+
+        const std::string writtenBy = head.str();
+        if (writtenBy != buildId) {
+            reason = "written by build " + writtenBy + ", this is " + std::string(buildId);
+            return nullptr;
+        }
+
+        const std::uint64_t payloadSize = head.u64();
+        const std::uint64_t checksum = head.u64();
+        const std::size_t payloadOffset = head.position();
+        if (payloadSize != bytes.size() - payloadOffset ||
+            bladenoise::fnv1a(bytes.substr(payloadOffset)) != checksum) {
+            reason = "checksum mismatch";
+            return nullptr;
+        }
+
+        // ── Validity ──
+        BinaryReader in(bytes, payloadOffset, SNAPSHOT);
+        if (in.u64() != schemaId) {
+            reason = "configuration schema changed";
+            return nullptr;
+        }
+
+        const std::size_t nInputs = in.count(8 + 8 + 8);
+        for (std::size_t i = 0; i < nInputs; ++i) {
+            Fingerprint stored;
+            stored.path = in.str();
+            stored.size = in.i64();
+            stored.mtime = in.i64();
+
+            if (i == 0 && stored.path != projectFile) {
+                reason = "written for project file " + stored.path;
+                return nullptr;
+            }
+            const Fingerprint current = fingerprintOf(stored.path);
+            if (current.size != stored.size || current.mtime != stored.mtime) {
+                reason = "input changed: " + stored.path;
+                return nullptr;
+            }
+        }
+
+        // ── Configuration ──
+        Configuration& config = snapshot->config;
+
+        const std::size_t nValues = in.count(8 + 1);
+        for (std::size_t i = 0; i < nValues; ++i) readValue(in, config);
+
+        if (in.flag())
+            config.setStructuredData("blade_geometry", readBladeGeometry(in));
+        if (in.flag())
+            config.setStructuredData("airfoil_performance_files",
+                                     readFileList<AirfoilPerformanceFileListData>(in));
+        if (in.flag())
+            config.setStructuredData("airfoil_geometry_files",
+                                     readFileList<AirfoilGeometryFileListData>(in));
+        if (in.flag())
+            config.setStructuredData("turbine_controller",
+                std::make_unique<TurbineControlSettingsStructuredData>(
+                    readControlSettings(in), TurbineControlSettingsStructuredData::UnitsConverted{}));
+
+        const std::size_t nGeometries = in.count(8);
+        for (std::size_t i = 0; i < nGeometries; ++i)
+            config.addToCollection("loaded_airfoil_geometries", readAirfoilGeometry(in));
+
+        const std::size_t nPolars = in.count(8);
+        for (std::size_t i = 0; i < nPolars; ++i)
+            config.addToCollection("loaded_airfoil_performances", readPolar(in));
+
+        snapshot->sectionsOffset = in.position();
+        return snapshot;
+    }
+    catch (const std::exception& e) {
+        reason = e.what();
+        return nullptr;
+    }
+}
+
+Configuration ProjectSnapshot::takeConfiguration() {
+    return std::move(config);
+}
+
+std::unique_ptr<BladeInterpolator> ProjectSnapshot::createBladeInterpolator() const {
+    BinaryReader in(file.text(), sectionsOffset, SNAPSHOT);
+
+    std::vector<std::unique_ptr<BladeGeometrySection>> sections(in.count(8));
+    for (auto& section : sections) {
+        section = std::make_unique<BladeGeometrySection>();
+        readSection(in, *section);
+    }
+
+    return std::make_unique<BladeInterpolator>(std::move(sections));
+}
@@ -3,11 +3,17 @@
  * @brief Rotor-level noise aggregation — see header for algorithm description.
  */
 #include "RotorNoiseAggregator.h"
+#include "BladeNoiseSpectra.h"
 
+#include "bladenoise/math/SpectralKernels.h"
+
+#include <algorithm>
 #include <cmath>
 #include <numbers>
 #include <stdexcept>
 
+namespace spectral = bladenoise::math::spectral;
+
 // ─────────────────────────────────────────────────────────────────────────────
 // Construction
 // ─────────────────────────────────────────────────────────────────────────────
@@ -39,33 +45,40 @@ RotorNoiseAggregator::RotorNoiseAggregator(int    n_blades,
 RotorNoiseResult RotorNoiseAggregator::Aggregate(
     BladeNoiseResult const &blade_result) const
 {
+    return Aggregate(BladeNoiseSpectra({ &blade_result, 1 }), 0);
+}
+
+RotorNoiseResult RotorNoiseAggregator::Aggregate(
+    INoiseSpectra const &spectra,
+    std::size_t          point) const
+{
+    if (point >= spectra.points())
+        throw std::invalid_argument("RotorNoiseAggregator::Aggregate: point out of range");
+
     RotorNoiseResult result;
-    result.vinf              = blade_result.vinf;
+    result.vinf              = spectra.vinf(point);
     result.observer_distance = observer_distance_;
     result.n_blades          = n_blades_;
-    result.frequencies       = blade_result.frequencies;
+    result.frequencies       = spectra.frequencies();
 
-    if (blade_result.sections.empty() || blade_result.frequencies.empty())
+    if (spectra.sections(point) == 0 || spectra.bands() == 0)
         return result;
 
-    const std::vector<double> a_weights =
-        ComputeAWeights(blade_result.frequencies);
-
+    const std::vector<double> a_weights = ComputeAWeights(spectra.frequencies());
     const double As = GeometricAttenuation(observer_distance_);
 
-    auto agg = [&](SectionNoiseSpectrum SectionNoiseResult::*src)
+    auto agg = [&](NoiseSource src)
     {
-        return AggregateSource(blade_result.sections, src,
-                               a_weights, As, n_blades_);
+        return AggregateSource(spectra, point, src, a_weights, As, n_blades_);
     };
 
-    result.tbl_pressure_side = agg(&SectionNoiseResult::tbl_pressure_side);
-    result.tbl_suction_side  = agg(&SectionNoiseResult::tbl_suction_side);
-    result.separation        = agg(&SectionNoiseResult::separation);
-    result.laminar_vortex    = agg(&SectionNoiseResult::laminar_vortex);
-    result.bluntness         = agg(&SectionNoiseResult::bluntness);
-    result.turbulent_inflow  = agg(&SectionNoiseResult::turbulent_inflow);
-    result.total             = agg(&SectionNoiseResult::total);
+    result.tbl_pressure_side = agg(NoiseSource::TblPressureSide);
+    result.tbl_suction_side  = agg(NoiseSource::TblSuctionSide);
+    result.separation        = agg(NoiseSource::Separation);
+    result.laminar_vortex    = agg(NoiseSource::LaminarVortex);
+    result.bluntness         = agg(NoiseSource::Bluntness);
+    result.turbulent_inflow  = agg(NoiseSource::TurbulentInflow);
+    result.total             = agg(NoiseSource::Total);
 
     return result;
 }
@@ -77,28 +90,10 @@ RotorNoiseResult RotorNoiseAggregator::Aggregate(
 std::vector<double> RotorNoiseAggregator::ComputeAWeights(
     std::vector<double> const &frequencies)
 {
-    // Standard A-weighting formula (matches Python calc_weight_A):
-    //   RA(f) = 12200² · f⁴ /
-    //           [ (f²+20.6²) · sqrt((f²+107.7²)(f²+737.9²)) · (f²+12200²) ]
-    //   A(f)  = 2 + 20·log10(RA(f))   [dB]
-    constexpr double f1  = 20.6;
-    constexpr double f2  = 107.7;
-    constexpr double f3  = 737.9;
-    constexpr double f4  = 12200.0;
-    constexpr double f4sq = f4 * f4;
-
     std::vector<double> aw;
     aw.reserve(frequencies.size());
-
     for (double f : frequencies)
-    {
-        const double f2_  = f * f;
-        const double RA   = f4sq * f2_ * f2_
-                          / ((f2_ + f1 * f1)
-                             * std::sqrt((f2_ + f2 * f2) * (f2_ + f3 * f3))
-                             * (f2_ + f4sq));
-        aw.push_back(2.0 + 20.0 * std::log10(RA));
-    }
+        aw.push_back(spectral::a_weighting(f));
     return aw;
 }
 
@@ -115,46 +110,43 @@ double RotorNoiseAggregator::EnergySum(std::vector<double> const &levels)
 {
     // 10·log10( Σ_i 10^(L_i/10) )
     // Levels below -99 dB are treated as inactive and skipped.
-    double sum = 0.0;
-    for (double L : levels)
-        if (L > -99.0)
-            sum += std::pow(10.0, L / 10.0);
-
-    if (sum <= 0.0) return -100.0;
-    return 10.0 * std::log10(sum);
+    return spectral::energy_sum(levels.data(), levels.size());
 }
 
 RotorNoiseSourceResult RotorNoiseAggregator::AggregateSource(
-    std::vector<SectionNoiseResult> const &sections,
-    SectionNoiseSpectrum SectionNoiseResult::*src,
-    std::vector<double>  const &a_weights,
-    double               As,
-    int                  n_blades)
+    INoiseSpectra       const &spectra,
+    std::size_t                point,
+    NoiseSource                src,
+    std::vector<double> const &a_weights,
+    double                     As,
+    int                        n_blades)
 {
     RotorNoiseSourceResult out;
-    if (sections.empty()) return out;
-
-    const std::size_t n_bands = (sections.front().*src).spl.size();
+    const std::size_t n_bands = spectra.bands();
     if (n_bands == 0) return out;
 
     // ── Step 1: energy-sum per frequency band over all blade sections ─────────
     // spl_band[k] = 10·log10( Σ_sections  10^(spl_section[k]/10) )
-    out.spl_spectrum.resize(n_bands, -100.0);
-    out.splA_spectrum.resize(n_bands, -100.0);
+    out.spl_spectrum.resize(n_bands, spectral::FLOOR_DB);
+    out.splA_spectrum.resize(n_bands, spectral::FLOOR_DB);
+
+    // Section-major accumulation keeps the inner loop on contiguous bands.
+    std::vector<double> sum_lin(n_bands, 0.0);
+    std::vector<double> spl(n_bands);
+    for (std::size_t s = 0; s < spectra.sections(point); ++s)
+    {
+        if (!spectra.section(point, s).converged) continue;
+        spectra.spectrum(point, s, src, spl);
+        #pragma omp simd
+        for (std::size_t k = 0; k < n_bands; ++k)
+            sum_lin[k] += spl[k] > spectral::INACTIVE_DB ? spectral::from_dB(spl[k]) : 0.0;
+    }
 
     for (std::size_t k = 0; k < n_bands; ++k)
     {
-        double sum_lin = 0.0;
-        for (auto const &sec : sections)
-        {
-            if (!sec.converged) continue;
-            const SectionNoiseSpectrum &sp = sec.*src;
-            if (k < sp.spl.size() && sp.spl[k] > -99.0)
-                sum_lin += std::pow(10.0, sp.spl[k] / 10.0);
-        }
-        if (sum_lin > 0.0)
+        if (sum_lin[k] > 0.0)
         {
-            out.spl_spectrum[k] = 10.0 * std::log10(sum_lin);
+            out.spl_spectrum[k] = spectral::to_dB(sum_lin[k]);
             // A-weight the blade SPL spectrum
             const double aw = (k < a_weights.size()) ? a_weights[k] : 0.0;
             out.splA_spectrum[k] = out.spl_spectrum[k] + aw;
@@ -176,9 +168,9 @@ RotorNoiseSourceResult RotorNoiseAggregator::AggregateSource(
     std::vector<double> lwA_spectrum(n_bands, -100.0);
     for (std::size_t k = 0; k < n_bands; ++k)
     {
-        if (out.spl_spectrum[k] > -99.0)
+        if (out.spl_spectrum[k] > spectral::INACTIVE_DB)
             lw_spectrum[k] = out.spl_spectrum[k] - As;
-        if (out.splA_spectrum[k] > -99.0)
+        if (out.splA_spectrum[k] > spectral::INACTIVE_DB)
             lwA_spectrum[k] = out.splA_spectrum[k] - As + n_blades_dB;
     }
 
@@ -9,12 +9,85 @@
 #include <cmath>
 #include <iostream>
 #include <numbers>
+#include <optional>
 #include <stdexcept>
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
 #endif
 
+namespace
+{
+// ── Journal records ──────────────────────────────────────────────────────────
+// First record: the sweep (so a journal of another sweep is not reused).
+// Then one record per solved point: flat index + point.
+
+std::string SweepRecord(RotormapResult const &result, std::size_t num_sections)
+{
+    BinaryWriter rec;
+    rec.f64(result.v_tip);
+    rec.u64(num_sections);
+    rec.doubles(result.lambda_vec);
+    rec.doubles(result.pitch_vec);
+    return rec.take();
+}
+
+void PutResult(BinaryWriter &rec, BEMPostprocessResult const &pp)
+{
+    for (double v : {pp.cp, pp.ct, pp.p, pp.thrust, pp.torque, pp.ctorque,
+                     pp.sum_fy, pp.mx, pp.my, pp.mz})
+        rec.f64(v);
+    for (auto const *vec : {&pp.local_velocity, &pp.local_mach, &pp.local_reynolds,
+                            &pp.alpha_eff, &pp.cl, &pp.cd, &pp.cm, &pp.cp_loc, &pp.ct_loc,
+                            &pp.element_length, &pp.element_thrust, &pp.element_torque,
+                            &pp.element_fy, &pp.element_mz, &pp.element_airfoil_moment,
+                            &pp.integral_fx, &pp.integral_fy, &pp.integral_mx,
+                            &pp.integral_my, &pp.integral_mz})
+        rec.doubles(*vec);
+}
+
+BEMPostprocessResult GetResult(BinaryReader &in)
+{
+    BEMPostprocessResult pp;
+    for (double *v : {&pp.cp, &pp.ct, &pp.p, &pp.thrust, &pp.torque, &pp.ctorque,
+                      &pp.sum_fy, &pp.mx, &pp.my, &pp.mz})
+        *v = in.f64();
+    for (auto *vec : {&pp.local_velocity, &pp.local_mach, &pp.local_reynolds,
+                      &pp.alpha_eff, &pp.cl, &pp.cd, &pp.cm, &pp.cp_loc, &pp.ct_loc,
+                      &pp.element_length, &pp.element_thrust, &pp.element_torque,
+                      &pp.element_fy, &pp.element_mz, &pp.element_airfoil_moment,
+                      &pp.integral_fx, &pp.integral_fy, &pp.integral_mx,
+                      &pp.integral_my, &pp.integral_mz})
+        *vec = in.doubles();
+    return pp;
+}
+
+std::string PointRecord(std::size_t index, RotormapPoint const &pt)
+{
+    BinaryWriter rec;
+    rec.u64(index);
+    rec.f64(pt.pitch_rad);
+    rec.f64(pt.lambda);
+    rec.f64(pt.v_tip);
+    rec.f64(pt.v_inf);
+    rec.flag(pt.converged);
+    PutResult(rec, pt.pp);
+    return rec.take();
+}
+
+RotormapPoint GetPoint(BinaryReader &in)
+{
+    RotormapPoint pt;
+    pt.pitch_rad = in.f64();
+    pt.lambda    = in.f64();
+    pt.v_tip     = in.f64();
+    pt.v_inf     = in.f64();
+    pt.converged = in.flag();
+    pt.pp        = GetResult(in);
+    return pt;
+}
+} // namespace
+
 // ─────────────────────────────────────────────────────────────────────────────
 RotormapSolver::RotormapSolver(TurbineGeometry const   *turbine,
                                ISimulationConfig const *sim_config)
@@ -27,7 +100,8 @@ RotormapSolver::RotormapSolver(TurbineGeometry const   *turbine,
 }
 
 // ─────────────────────────────────────────────────────────────────────────────
-RotormapResult RotormapSolver::Solve(RotormapParams const &params) const
+RotormapResult RotormapSolver::Solve(RotormapParams const &params,
+                                     CheckpointJournal *journal) const
 {
     RotormapResult result;
     result.v_tip      = params.v_tip;
@@ -49,12 +123,53 @@ RotormapResult RotormapSolver::Solve(RotormapParams const &params) const
               << " lambda = " << total << " points  (v_tip="
               << params.v_tip << " m/s)\n";
 
+    // ── Points of an interrupted run ──────────────────────────────────────────
+    std::vector<std::optional<RotormapPoint>> restored(static_cast<std::size_t>(total));
+    if (journal)
+    {
+        const std::string sweep = SweepRecord(result, turbine_->num_sections());
+        std::vector<std::string> const &records = journal->restored();
+
+        int n_restored = 0;
+        if (!records.empty() && records.front() == sweep)
+        {
+            for (std::size_t r = 1; r < records.size(); ++r)
+            {
+                BinaryReader in(records[r]);
+                const auto index = in.u64();
+                if (index < restored.size() && !restored[index])
+                {
+                    restored[index] = GetPoint(in);
+                    ++n_restored;
+                }
+            }
+        }
+        else
+        {
+            journal->KeepRestored(0);
+            journal->Append(sweep);
+        }
+
+        if (n_restored > 0)
+            std::cout << "  Rotormap: " << n_restored << "/" << total
+                      << " points restored from " << journal->path() << "\n";
+    }
+
     for (int j = 0; j < J; ++j)
         for (int i = 0; i < I; ++i)
         {
-            RotormapPoint pt = SolvePoint(result.pitch_vec[j],
-                                          result.lambda_vec[i],
-                                          params.v_tip);
+            const std::size_t index = static_cast<std::size_t>(j * I + i);
+            RotormapPoint pt;
+            if (restored[index])
+            {
+                pt = std::move(*restored[index]);
+            }
+            else
+            {
+                pt = SolvePoint(result.pitch_vec[j], result.lambda_vec[i], params.v_tip);
+                if (journal)
+                    journal->Append(PointRecord(index, pt));
+            }
             if (pt.converged) ++converged;
             result.points.push_back(std::move(pt));
         }
@@ -19,10 +19,83 @@
 #include "ISectionNoiseConfigBuilder.h"
 #include "BladeNoiseConfigBuilder.h"   // default implementation
 #include "TurbineGeometry.h"
+#include "CheckpointJournal.h"
 
 #include <cmath>
+#include <iomanip>
 #include <iostream>
 #include <numbers>
+#include <sstream>
+
+namespace
+{
+// ── Journal records ──────────────────────────────────────────────────────────
+// First record: the jobs (so a journal of another power curve is not reused).
+// Then one record per computed section: point, section, result.
+
+std::string SweepRecord(std::vector<BladeNoiseJob> const &jobs)
+{
+    BinaryWriter rec;
+    rec.u64(jobs.size());
+    for (auto const &job : jobs)
+    {
+        rec.f64(job.result.vinf);
+        rec.u64(job.inputs.size());
+        for (auto const &inp : job.inputs)
+            for (double v : {inp.velocity, inp.mach, inp.reynolds, inp.alpha_deg,
+                             inp.chord, inp.span, inp.observer_distance})
+                rec.f64(v);
+    }
+    return rec.take();
+}
+
+std::string SectionRecord(std::size_t point, std::size_t i, SectionNoiseResult const &sr)
+{
+    BinaryWriter rec;
+    rec.u64(point);
+    rec.u64(i);
+    for (double v : {sr.velocity, sr.mach, sr.reynolds, sr.alpha_deg,
+                     sr.observer_distance, sr.observer_theta, sr.observer_phi,
+                     sr.surrogate_error_db})
+        rec.f64(v);
+    rec.flag(sr.converged);
+    for (auto member : kNoiseSourceSpectra)
+    {
+        SectionNoiseSpectrum const &sp = sr.*member;
+        rec.doubles(sp.spl);
+        rec.f64(sp.oaspl);
+        rec.f64(sp.directivity_crossover_hz);
+    }
+    return rec.take();
+}
+
+void GetSection(BinaryReader &in, SectionNoiseResult &sr)
+{
+    for (double *v : {&sr.velocity, &sr.mach, &sr.reynolds, &sr.alpha_deg,
+                      &sr.observer_distance, &sr.observer_theta, &sr.observer_phi,
+                      &sr.surrogate_error_db})
+        *v = in.f64();
+    sr.converged = in.flag();
+    for (auto member : kNoiseSourceSpectra)
+    {
+        SectionNoiseSpectrum &sp = sr.*member;
+        sp.spl                      = in.doubles();
+        sp.oaspl                    = in.f64();
+        sp.directivity_crossover_hz = in.f64();
+    }
+}
+
+// Hand a finished section to the job's store, if any (see BladeNoiseJob).
+void StoreSection(BladeNoiseJob &job, std::size_t i)
+{
+    if (!job.store)
+        return;
+    SectionNoiseResult &sr = job.result.sections[i];
+    job.store->Assign(job.store_point, i, sr);
+    for (auto member : kNoiseSourceSpectra)
+        std::vector<double>().swap((sr.*member).spl);
+}
+} // namespace
 
 // ─────────────────────────────────────────────────────────────────────────────
 // Constructor
@@ -50,96 +123,202 @@ BladeNoiseResult SectionNoiseCalculator::Calculate(
     std::vector<double> const   &local_mach,
     std::vector<double> const   &local_re) const
 {
-    BladeNoiseResult blade_result;
-    blade_result.vinf = vinf;
+    BladeNoiseJob job = Prepare(pp, turbine, sim_config, vinf,
+                                local_vel, local_mach, local_re);
+
+    for (std::size_t i = 0; i < job.inputs.size(); ++i)
+        CalculateSection(job, i);
+
+    return Finalize(std::move(job));
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Prepare
+// ─────────────────────────────────────────────────────────────────────────────
+BladeNoiseJob SectionNoiseCalculator::Prepare(
+    BEMPostprocessResult const  &pp,
+    TurbineGeometry const       *turbine,
+    ISimulationConfig const     &sim_config,
+    double                       vinf,
+    std::vector<double> const   &local_vel,
+    std::vector<double> const   &local_mach,
+    std::vector<double> const   &local_re) const
+{
+    BladeNoiseJob job;
+    job.result.vinf = vinf;
 
     if (!turbine || !adapter_ || !config_builder_)
     {
         error_ = "SectionNoiseCalculator: null turbine, adapter or config_builder";
-        return blade_result;
+        return job;
     }
 
     // ── Build per-section inputs from BEM postprocessor data ──────────────────
-    auto inputs = adapter_->Build(pp, turbine, sim_config, vinf);
-    if (inputs.empty())
+    job.inputs = adapter_->Build(pp, turbine, sim_config, vinf);
+    if (job.inputs.empty())
     {
         error_ = "SectionNoiseCalculator: adapter returned no inputs";
-        return blade_result;
+        return job;
     }
 
     // ── Fill per-section velocities from stored BEM fields ────────────────────
-    const std::size_t n = inputs.size();
+    const std::size_t n = job.inputs.size();
     for (std::size_t i = 0; i < n; ++i)
     {
-        if (i < local_vel.size())  inputs[i].velocity = local_vel[i];
-        if (i < local_mach.size()) inputs[i].mach     = local_mach[i];
-        if (i < local_re.size())   inputs[i].reynolds = local_re[i];
+        SectionNoiseInput &inp = job.inputs[i];
+        if (i < local_vel.size())  inp.velocity = local_vel[i];
+        if (i < local_mach.size()) inp.mach     = local_mach[i];
+        if (i < local_re.size())   inp.reynolds = local_re[i];
     }
 
-    // ── Frequency vector — derived from bladenoise constants, but only the
-    //    count matters here; actual values come back in SectionNoiseSpectrum.
-    //    We query from the first successful result below; pre-allocate 34 bands.
-    blade_result.sections.reserve(n);
-    int n_failed = 0;
-
+    // ── One result slot per section; geometry known up front ──────────────────
+    job.result.sections.resize(n);
     for (std::size_t i = 0; i < n; ++i)
     {
-        SectionNoiseInput const &inp = inputs[i];
-
-        // ── Guard: skip sections with no flow ─────────────────────────────────
-        if (inp.velocity <= 0.0)
-        {
-            SectionNoiseResult sr;
-            sr.section_index = i;
-            sr.radius        = turbine->radius(i);
-            sr.chord         = inp.chord;
-            sr.span          = inp.span;
-            sr.converged     = false;
-            blade_result.sections.push_back(sr);
-            continue;
-        }
+        SectionNoiseInput const &inp = job.inputs[i];
+        SectionNoiseResult      &sr  = job.result.sections[i];
 
-        // ── Delegate translate-and-run to ISectionNoiseConfigBuilder ──────────
-        SectionNoiseResult sr;
         sr.section_index = i;
         sr.radius        = turbine->radius(i);
         sr.chord         = inp.chord;
         sr.span          = inp.span;
-        sr.velocity      = inp.velocity;
-        sr.mach          = inp.mach;
-        sr.reynolds      = inp.reynolds;
-        sr.alpha_deg     = inp.alpha_deg;
+        sr.converged     = false;
+    }
 
-        sr.converged = config_builder_->Build(inp, noise_config_, sr);
+    return job;
+}
 
-        if (!sr.converged)
-            ++n_failed;
+// ─────────────────────────────────────────────────────────────────────────────
+// CalculateSection
+// ─────────────────────────────────────────────────────────────────────────────
+bool SectionNoiseCalculator::CalculateSection(BladeNoiseJob &job, std::size_t i) const
+{
+    SectionNoiseInput const &inp = job.inputs[i];
+    SectionNoiseResult      &sr  = job.result.sections[i];
 
-        blade_result.sections.push_back(std::move(sr));
-    }
+    // ── Guard: skip sections with no flow ─────────────────────────────────────
+    if (inp.velocity <= 0.0)
+        return false;
+
+    sr.velocity  = inp.velocity;
+    sr.mach      = inp.mach;
+    sr.reynolds  = inp.reynolds;
+    sr.alpha_deg = inp.alpha_deg;
+
+    sr.observer_distance = inp.observer_distance;
+    sr.observer_theta    = inp.observer_theta;
+    sr.observer_phi      = inp.observer_phi;
+
+    // ── Delegate translate-and-run to ISectionNoiseConfigBuilder ──────────────
+    sr.converged = config_builder_->Build(inp, noise_config_, sr);
 
+    if (job.journal)
+        job.journal->Append(SectionRecord(job.journal_point, i, sr));
+    StoreSection(job, i);
+    return sr.converged;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Finalize
+// ─────────────────────────────────────────────────────────────────────────────
+BladeNoiseResult SectionNoiseCalculator::Finalize(BladeNoiseJob &&job) const
+{
+    BladeNoiseResult blade_result = std::move(job.result);
+
+    // Sections skipped for lack of flow are not counted as failures
+    const std::size_t n = job.inputs.size();
+    std::size_t n_failed = 0;
+    for (std::size_t i = 0; i < n; ++i)
+        if (job.inputs[i].velocity > 0.0 && !blade_result.sections[i].converged)
+            ++n_failed;
+
+    // Finalize runs concurrently for different wind speeds: one write per line
     if (n_failed > 0)
-        std::cout << "  SectionNoiseCalculator: " << (n - n_failed) << "/"
-                  << n << " sections converged\n";
+    {
+        std::ostringstream line;
+        line << "  SectionNoiseCalculator: v_inf = " << std::fixed
+             << std::setprecision(1) << blade_result.vinf << " m/s, "
+             << (n - n_failed) << "/" << n << " sections converged\n";
+        std::cout << line.str();
+    }
 
-    // ── Populate frequency list from first converged section ──────────────────
+    // ── Populate frequency list if any section converged ──────────────────────
     for (auto const &sec : blade_result.sections)
-        if (sec.converged && !sec.total.spl.empty())
+        if (sec.converged)
         {
-            // Rebuild standard 1/3-octave centres — they are constant
-            // (34 bands, 10 Hz – 20 kHz); we can't easily query from the
-            // bladenoise constants here without including bladenoise headers,
-            // so we infer the count and reconstruct the same sequence used
-            // by bladenoise::constants::THIRD_OCTAVE_BANDS.
-            static const std::vector<double> kBands = {
-                10,12.5,16,20,25,31.5,40,50,63,80,
-                100,125,160,200,250,315,400,500,630,800,
-                1000,1250,1600,2000,2500,3150,
-                4000,5000,6300,8000,10000,12500,16000,20000
-            };
-            blade_result.frequencies = kBands;
+            blade_result.frequencies = BandFrequencies();
             break;
         }
 
     return blade_result;
 }
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Resume
+// ─────────────────────────────────────────────────────────────────────────────
+std::vector<std::vector<bool>> SectionNoiseCalculator::Resume(
+    std::vector<BladeNoiseJob> &jobs,
+    CheckpointJournal          &journal) const
+{
+    std::vector<std::vector<bool>> restored(jobs.size());
+    std::size_t n_sections = 0;
+    for (std::size_t j = 0; j < jobs.size(); ++j)
+    {
+        restored[j].assign(jobs[j].inputs.size(), false);
+        n_sections += jobs[j].inputs.size();
+    }
+
+    const std::string sweep = SweepRecord(jobs);
+    std::vector<std::string> const &records = journal.restored();
+
+    std::size_t n_restored = 0;
+    if (!records.empty() && records.front() == sweep)
+    {
+        for (std::size_t r = 1; r < records.size(); ++r)
+        {
+            BinaryReader in(records[r]);
+            const auto j = in.u64();
+            const auto i = in.u64();
+            if (j < jobs.size() && i < restored[j].size() && !restored[j][i])
+            {
+                GetSection(in, jobs[j].result.sections[i]);
+                StoreSection(jobs[j], i);
+                restored[j][i] = true;
+                ++n_restored;
+            }
+        }
+    }
+    else
+    {
+        journal.KeepRestored(0);
+        journal.Append(sweep);
+    }
+
+    for (std::size_t j = 0; j < jobs.size(); ++j)
+    {
+        jobs[j].journal       = &journal;
+        jobs[j].journal_point = j;
+    }
+
+    if (n_restored > 0)
+        std::cout << "  SectionNoiseCalculator: " << n_restored << "/" << n_sections
+                  << " sections restored from " << journal.path() << "\n";
+    return restored;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// BandFrequencies
+// ─────────────────────────────────────────────────────────────────────────────
+std::vector<double> const &SectionNoiseCalculator::BandFrequencies()
+{
+    // The standard 1/3-octave centres (34 bands, 10 Hz – 20 kHz), the same
+    // sequence as bladenoise::constants::THIRD_OCTAVE_BANDS; repeated here
+    // because this file includes no bladenoise headers.
+    static const std::vector<double> kBands = {
+        10,12.5,16,20,25,31.5,40,50,63,80,
+        100,125,160,200,250,315,400,500,630,800,
+        1000,1250,1600,2000,2500,3150,
+        4000,5000,6300,8000,10000,12500,16000,20000
+    };
+    return kBands;
+}
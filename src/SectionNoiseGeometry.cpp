@@ -0,0 +1,76 @@
+/**
+ * @file SectionNoiseGeometry.cpp
+ * @brief Builds the per-section noise geometry table.
+ */
+#include "SectionNoiseGeometry.h"
+#include "AirfoilDataAdapter.h"
+#include "TurbineGeometry.h"
+
+#include "bladenoise/airfoil/AirfoilGeometryAnalyzer.h"
+
+#include <cmath>
+#include <iostream>
+#include <numbers>
+
+// ─────────────────────────────────────────────────────────────────────────────
+std::shared_ptr<const SectionNoiseGeometryTable>
+SectionNoiseGeometryBuilder::Build(TurbineGeometry const &turbine)
+{
+    auto table = std::make_shared<SectionNoiseGeometryTable>();
+    table->reserve(turbine.num_sections());
+
+    for (std::size_t i = 0; i < turbine.num_sections(); ++i)
+        table->push_back(BuildSection(turbine, i));
+
+    return table;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+SectionNoiseGeometry SectionNoiseGeometryBuilder::BuildSection(
+    TurbineGeometry const &turbine,
+    std::size_t            index)
+{
+    SectionNoiseGeometry geo;
+
+    // Section relative thickness t/c [-] (TurbineGeometry stores percent)
+    const double tc = turbine.thickness(index) / 100.0;
+    geo.thickness_1_percent  = tc;
+    geo.thickness_10_percent = tc;
+
+    // ── Airfoil coordinates ───────────────────────────────────────────────────
+    // TurbineGeometry::airfoilGeometry(i) returns the normalised (0..1)
+    // AirfoilGeometryData for section i via BladeGeometrySection.
+    // getCoordinates() is safe because applyScalingWithChordAndMaxThickness
+    // writes into scaledCoordinates and leaves coordinates untouched.
+    const AirfoilGeometryData *ag = turbine.airfoilGeometry(index);
+    if (!ag || !AirfoilDataAdapter::IsUsableForXfoil(*ag))
+        return geo;
+
+    auto adata = std::make_shared<bladenoise::io::AirfoilData>();
+    AirfoilDataAdapter::Convert(*ag, *adata);
+    geo.airfoil_data = adata;
+
+    // ── Derived TE / thickness parameters ─────────────────────────────────────
+    bladenoise::airfoil::AirfoilGeometryAnalyzer analyzer;
+    bladenoise::airfoil::AirfoilGeometry ag_props;
+    if (!analyzer.analyze(*adata, ag_props) || ag_props.max_thickness <= 0.0)
+    {
+        std::cerr << "  SectionNoiseGeometry: section " << index
+                  << " airfoil analysis failed (" << analyzer.get_error()
+                  << "); using BPM TE defaults\n";
+        return geo;
+    }
+
+    // Coordinates carry the shape only; scale y to the section's t/c
+    const double scale = tc > 0.0 ? tc / ag_props.max_thickness : 1.0;
+
+    geo.te_thickness_over_chord = ag_props.trailing_edge_thickness * scale;
+    geo.thickness_1_percent     = ag_props.thickness_at_1_percent * scale;
+    geo.thickness_10_percent    = ag_props.thickness_at_10_percent * scale;
+
+    // tan(PSI/2) scales linearly with the thickness
+    const double half_psi = 0.5 * ag_props.trailing_edge_angle * std::numbers::pi / 180.0;
+    geo.te_angle_deg = 2.0 * std::atan(scale * std::tan(half_psi)) * 180.0 / std::numbers::pi;
+
+    return geo;
+}
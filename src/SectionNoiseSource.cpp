@@ -0,0 +1,87 @@
+/**
+ * @file SectionNoiseSource.cpp
+ * @brief Directivity-free section source spectra — see header.
+ */
+#include "SectionNoiseSource.h"
+
+#include "bladenoise/math/SpectralKernels.h"
+#include "bladenoise/noise/Directivity.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace spectral = bladenoise::math::spectral;
+using bladenoise::noise::Directivity;
+
+// ─────────────────────────────────────────────────────────────────────────────
+RotorNoiseSource SectionNoiseSourceBuilder::Build(INoiseSpectra const &spectra,
+                                                  std::size_t          point)
+{
+    RotorNoiseSource out;
+    out.vinf        = spectra.vinf(point);
+    out.frequencies = spectra.frequencies();
+
+    const std::size_t n_bands = spectra.bands();
+    if (n_bands == 0)
+        return out;
+
+    // Individual sources only; `total` already mixes directivity forms
+    static constexpr NoiseSource kSources[] = {
+        NoiseSource::TblPressureSide,
+        NoiseSource::TblSuctionSide,
+        NoiseSource::Separation,
+        NoiseSource::LaminarVortex,
+        NoiseSource::Bluntness,
+        NoiseSource::TurbulentInflow,
+    };
+
+    std::vector<double> spl(n_bands);
+    for (std::size_t s = 0; s < spectra.sections(point); ++s)
+    {
+        const NoiseSectionInfo sec = spectra.section(point, s);
+        if (!sec.converged) continue;
+
+        // Directivity and spreading of the observer the section was run for
+        const double d_low  = Directivity::low_frequency(
+                                  sec.mach, sec.observer_theta, sec.observer_phi);
+        const double d_high = Directivity::high_frequency(
+                                  sec.mach, sec.observer_theta, sec.observer_phi);
+        const double r2     = sec.observer_distance * sec.observer_distance;
+
+        if (d_low <= 0.0 || d_high <= 0.0 || r2 <= 0.0)
+            throw std::invalid_argument(
+                "SectionNoiseSourceBuilder: observer of section "
+                + std::to_string(sec.section_index)
+                + " lies in a directivity null or at zero distance");
+
+        SectionNoiseSource src;
+        src.section_index = sec.section_index;
+        src.radius        = sec.radius;
+        src.mach          = sec.mach;
+        src.p_low.assign(n_bands, 0.0);
+        src.p_high.assign(n_bands, 0.0);
+
+        const double w_low  = r2 / d_low;
+        const double w_high = r2 / d_high;
+
+        for (NoiseSource source : kSources)
+        {
+            spectra.spectrum(point, s, source, spl);
+            const double crossover_hz = spectra.crossover_hz(point, s, source);
+            for (std::size_t k = 0; k < n_bands; ++k)
+            {
+                if (spl[k] <= spectral::INACTIVE_DB) continue;
+                const double p = spectral::from_dB(spl[k]);
+                if (out.frequencies[k] <= crossover_hz)
+                    src.p_low[k] += p * w_low;
+                else
+                    src.p_high[k] += p * w_high;
+            }
+        }
+
+        out.sections.push_back(std::move(src));
+    }
+
+    return out;
+}
@@ -0,0 +1,373 @@
+/**
+ * @file TabulatedNoiseConfigBuilder.cpp
+ * @brief Surrogate section noise from an on-demand (ln Re, alpha) table —
+ *        see header.
+ */
+#include "TabulatedNoiseConfigBuilder.h"
+
+#include "bladenoise/core/Hash.h"
+#include "bladenoise/math/SpectralKernels.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace spectral = bladenoise::math::spectral;
+
+namespace
+{
+
+// Spectra carried by a SectionNoiseResult
+constexpr SectionNoiseSpectrum SectionNoiseResult::*kSpectra[] = {
+    &SectionNoiseResult::tbl_pressure_side,
+    &SectionNoiseResult::tbl_suction_side,
+    &SectionNoiseResult::separation,
+    &SectionNoiseResult::laminar_vortex,
+    &SectionNoiseResult::bluntness,
+    &SectionNoiseResult::turbulent_inflow,
+    &SectionNoiseResult::total,
+};
+
+bool active(double level) { return level > spectral::INACTIVE_DB; }
+
+} // namespace
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Construction
+// ─────────────────────────────────────────────────────────────────────────────
+TabulatedNoiseConfigBuilder::TabulatedNoiseConfigBuilder(
+    std::shared_ptr<ISectionNoiseConfigBuilder> exact,
+    double                                      tolerance_db,
+    TabulatedNoiseGrid                          grid)
+    : exact_(std::move(exact))
+    , tolerance_db_(tolerance_db)
+    , grid_(grid)
+{
+    if (!exact_)
+        throw std::invalid_argument("TabulatedNoiseConfigBuilder: null exact builder");
+    if (tolerance_db_ <= 0.0)
+        throw std::invalid_argument("TabulatedNoiseConfigBuilder: tolerance must be > 0");
+    if (grid_.log_re_step <= 0.0 || grid_.alpha_step_deg <= 0.0)
+        throw std::invalid_argument("TabulatedNoiseConfigBuilder: grid steps must be > 0");
+    if (grid_.max_refinement < 0)
+        throw std::invalid_argument("TabulatedNoiseConfigBuilder: max_refinement must be >= 0");
+    if (grid_.re_min <= 0.0 || grid_.re_max <= grid_.re_min
+        || grid_.alpha_max_deg <= grid_.alpha_min_deg)
+        throw std::invalid_argument("TabulatedNoiseConfigBuilder: empty grid bounds");
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Build
+// ─────────────────────────────────────────────────────────────────────────────
+bool TabulatedNoiseConfigBuilder::Build(
+    SectionNoiseInput const &inp,
+    NoiseConfig       const &noise_cfg,
+    SectionNoiseResult      &result) const
+{
+    if (inp.velocity <= 0.0 || inp.chord <= 0.0 || inp.kinematic_viscosity <= 0.0)
+        return Exact(inp, noise_cfg, result);
+
+    // ── Locate the cell; outside the table → exact model ─────────────────────
+    const double re = inp.velocity * inp.chord / inp.kinematic_viscosity;
+    if (re < grid_.re_min || re >= grid_.re_max
+        || inp.alpha_deg < grid_.alpha_min_deg || inp.alpha_deg >= grid_.alpha_max_deg)
+        return Exact(inp, noise_cfg, result);
+
+    const double x0 = std::log(re / grid_.re_min) / grid_.log_re_step;
+    const double y0 = (inp.alpha_deg - grid_.alpha_min_deg) / grid_.alpha_step_deg;
+    const std::uint64_t section = Fingerprint(inp, noise_cfg);
+
+    // ── Coarsest cell within the tolerance, halving the steps on rejection ──
+    for (int level = 0; level <= grid_.max_refinement; ++level)
+    {
+        const double x  = std::ldexp(x0, level);
+        const double y  = std::ldexp(y0, level);
+        const double fx = std::floor(x);
+        const double fy = std::floor(y);
+
+        Key cell;
+        cell.section   = section;
+        cell.level     = level;
+        cell.re_idx    = static_cast<std::int64_t>(fx);
+        cell.alpha_idx = static_cast<std::int64_t>(fy);
+
+        // Corner nodes, (0,0) (1,0) (0,1) (1,1)
+        NodePtr corners[4];
+        for (int c = 0; c < 4; ++c)
+        {
+            Key key = cell;
+            key.re_idx    += c & 1;
+            key.alpha_idx += c >> 1;
+            corners[c] = GetNode(key, inp, noise_cfg);
+        }
+
+        // Cell error, checked once per cell while it stays stored
+        double error;
+        if (auto known = cell_error_.find(cell))
+        {
+            error = *known;
+        }
+        else
+        {
+            auto mine = std::make_shared<const double>(CellError(cell, corners, inp, noise_cfg));
+            auto stored = cell_error_.insert(cell, mine);
+            error = *stored;
+            if (stored == mine)
+            {
+                cells_.fetch_add(1, std::memory_order_relaxed);
+                if (!(error <= tolerance_db_))
+                    rejected_.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        if (error <= tolerance_db_)
+        {
+            Interpolate(corners, x - fx, y - fy, result);
+            result.surrogate_error_db = error;
+            interpolated_.fetch_add(1, std::memory_order_relaxed);
+            if (level > 0)
+                refined_.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    return Exact(inp, noise_cfg, result);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Statistics
+// ─────────────────────────────────────────────────────────────────────────────
+TabulatedNoiseConfigBuilder::Stats TabulatedNoiseConfigBuilder::stats() const
+{
+    Stats s;
+    s.interpolated = interpolated_.load(std::memory_order_relaxed);
+    s.refined      = refined_.load(std::memory_order_relaxed);
+    s.fallbacks    = fallbacks_.load(std::memory_order_relaxed);
+    s.nodes        = evaluated_.load(std::memory_order_relaxed);
+    s.cells        = cells_.load(std::memory_order_relaxed);
+    s.rejected     = rejected_.load(std::memory_order_relaxed);
+    s.evicted      = nodes_.stats().evictions;
+    return s;
+}
+
+std::string TabulatedNoiseConfigBuilder::Statistics() const
+{
+    const Stats st = stats();
+    std::ostringstream os;
+    os << "Noise surrogate: " << st.interpolated << " interpolated ("
+       << st.refined << " refined) / " << st.fallbacks << " exact ("
+       << st.nodes << " nodes, " << st.evicted << " evicted, "
+       << st.cells << " cells, " << st.rejected << " above "
+       << tolerance_db_ << " dB)";
+    return os.str();
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Helpers
+// ─────────────────────────────────────────────────────────────────────────────
+std::size_t TabulatedNoiseConfigBuilder::KeyHash::operator()(Key const &key) const
+{
+    return static_cast<std::size_t>(bladenoise::Fnv1a()
+        .u64(key.section)
+        .u64(static_cast<std::uint64_t>(key.level))
+        .u64(static_cast<std::uint64_t>(key.re_idx))
+        .u64(static_cast<std::uint64_t>(key.alpha_idx))
+        .value());
+}
+
+std::uint64_t TabulatedNoiseConfigBuilder::Fingerprint(SectionNoiseInput const &inp,
+                                                       NoiseConfig       const &noise_cfg)
+{
+    bladenoise::Fnv1a h;
+    h.real(inp.speed_of_sound)
+     .real(inp.kinematic_viscosity)
+     .real(inp.air_density)
+     .real(inp.chord)
+     .real(inp.span)
+     .real(inp.te_thickness)
+     .real(inp.te_angle_deg)
+     .real(inp.turbulence_intensity)
+     .real(inp.turbulence_length_scale)
+     .real(inp.thickness_1_percent)
+     .real(inp.thickness_10_percent)
+     .real(inp.observer_distance)
+     .real(inp.observer_theta)
+     .real(inp.observer_phi);
+
+    // Airfoil by content: sections sharing a shape share their nodes, and a
+    // reused address never aliases a different shape.
+    h.u64(inp.airfoil_file.size()).bytes(inp.airfoil_file);
+    if (auto const *af = inp.airfoil_data.get())
+    {
+        const std::size_t n = std::min({ af->num_points, af->x.size(), af->y.size() });
+        h.u64(n).u64(af->is_closed ? 1u : 0u);
+        h.reals(af->x.data(), n).reals(af->y.data(), n);
+    }
+    else
+    {
+        h.u64(~std::uint64_t{0});
+    }
+
+    h.u64(static_cast<std::uint64_t>(noise_cfg.bl_tripping))
+     .u64(static_cast<std::uint64_t>(noise_cfg.bl_properties_method))
+     .u64(static_cast<std::uint64_t>(noise_cfg.tbl_noise_method))
+     .u64(static_cast<std::uint64_t>(noise_cfg.ti_noise_method))
+     .u64(noise_cfg.compute_bluntness ? 1u : 0u)
+     .u64(noise_cfg.compute_laminar ? 1u : 0u);
+    return h.value();
+}
+
+SectionNoiseInput TabulatedNoiseConfigBuilder::AtState(SectionNoiseInput const &inp,
+                                                       double re, double alpha_deg)
+{
+    SectionNoiseInput out = inp;
+    out.velocity  = re * inp.kinematic_viscosity / inp.chord;
+    out.mach      = out.velocity / inp.speed_of_sound;
+    out.reynolds  = re;
+    out.alpha_deg = alpha_deg;
+    return out;
+}
+
+TabulatedNoiseConfigBuilder::NodePtr TabulatedNoiseConfigBuilder::GetNode(
+    Key                      key,
+    SectionNoiseInput const &inp,
+    NoiseConfig       const &noise_cfg) const
+{
+    // Coarsest level holding this node
+    while (key.level > 0 && key.re_idx % 2 == 0 && key.alpha_idx % 2 == 0)
+    {
+        key.re_idx    /= 2;
+        key.alpha_idx /= 2;
+        --key.level;
+    }
+
+    return nodes_.get_or_compute(key, [&]
+    {
+        const double re    = grid_.re_min
+                           * std::exp(std::ldexp(static_cast<double>(key.re_idx), -key.level)
+                                      * grid_.log_re_step);
+        const double alpha = grid_.alpha_min_deg
+                           + std::ldexp(static_cast<double>(key.alpha_idx), -key.level)
+                             * grid_.alpha_step_deg;
+
+        auto node = std::make_shared<Node>();
+        node->converged = exact_->Build(AtState(inp, re, alpha), noise_cfg, node->result);
+        evaluated_.fetch_add(1, std::memory_order_relaxed);
+        return NodePtr(std::move(node));
+    });
+}
+
+double TabulatedNoiseConfigBuilder::CellError(Key               const &cell,
+                                              NodePtr const            corners[4],
+                                              SectionNoiseInput const &inp,
+                                              NoiseConfig       const &noise_cfg) const
+{
+    constexpr double kInf = std::numeric_limits<double>::infinity();
+    for (int c = 0; c < 4; ++c)
+        if (!corners[c]->converged)
+            return kInf;
+
+    // Centre and quarter points: nodes of the next two levels, i.e. the
+    // corners and centres of the sub-cells a rejection refines to.
+    struct Probe { int dl; std::int64_t di, dj; double u, v; };
+    constexpr Probe kProbes[] = {
+        { 1, 1, 1, 0.50, 0.50 },
+        { 2, 1, 1, 0.25, 0.25 }, { 2, 3, 1, 0.75, 0.25 },
+        { 2, 1, 3, 0.25, 0.75 }, { 2, 3, 3, 0.75, 0.75 },
+    };
+
+    double error = 0.0;
+    for (Probe const &p : kProbes)
+    {
+        Key key = cell;
+        key.level     += p.dl;
+        key.re_idx     = (cell.re_idx << p.dl) + p.di;
+        key.alpha_idx  = (cell.alpha_idx << p.dl) + p.dj;
+
+        NodePtr exact = GetNode(key, inp, noise_cfg);
+        if (!exact->converged)
+            return kInf;
+
+        SectionNoiseResult interp;
+        Interpolate(corners, p.u, p.v, interp);
+        error = std::max(error, MaxDifference(interp, exact->result));
+    }
+    return error;
+}
+
+void TabulatedNoiseConfigBuilder::Interpolate(NodePtr const corners[4],
+                                              double u, double v,
+                                              SectionNoiseResult &result)
+{
+    const double w[4] = { (1.0 - u) * (1.0 - v), u * (1.0 - v),
+                          (1.0 - u) * v,         u * v };
+    const int nearest = (u >= 0.5 ? 1 : 0) + (v >= 0.5 ? 2 : 0);
+
+    // Bilinear in dB where all corners are active, else the nearest corner
+    auto blend = [&](double const l[4])
+    {
+        if (active(l[0]) && active(l[1]) && active(l[2]) && active(l[3]))
+            return w[0] * l[0] + w[1] * l[1] + w[2] * l[2] + w[3] * l[3];
+        return l[nearest];
+    };
+
+    for (auto member : kSpectra)
+    {
+        SectionNoiseSpectrum const *sp[4];
+        std::size_t n = std::numeric_limits<std::size_t>::max();
+        for (int c = 0; c < 4; ++c)
+        {
+            sp[c] = &(corners[c]->result.*member);
+            n = std::min(n, sp[c]->spl.size());
+        }
+
+        SectionNoiseSpectrum &dst = result.*member;
+        dst.spl.resize(n);
+        for (std::size_t k = 0; k < n; ++k)
+        {
+            const double l[4] = { sp[0]->spl[k], sp[1]->spl[k],
+                                  sp[2]->spl[k], sp[3]->spl[k] };
+            dst.spl[k] = blend(l);
+        }
+
+        const double o[4] = { sp[0]->oaspl, sp[1]->oaspl, sp[2]->oaspl, sp[3]->oaspl };
+        dst.oaspl = blend(o);
+        dst.directivity_crossover_hz = sp[nearest]->directivity_crossover_hz;
+    }
+}
+
+double TabulatedNoiseConfigBuilder::MaxDifference(SectionNoiseResult const &a,
+                                                  SectionNoiseResult const &b)
+{
+    // A band off in one result counts at the floor level, so a source
+    // switching on or off inside the cell rejects it.
+    double error = 0.0;
+    auto compare = [&](double la, double lb)
+    {
+        if (active(la) || active(lb))
+            error = std::max(error, std::abs(std::max(la, spectral::FLOOR_DB)
+                                             - std::max(lb, spectral::FLOOR_DB)));
+    };
+
+    for (auto member : kSpectra)
+    {
+        SectionNoiseSpectrum const &sa = a.*member;
+        SectionNoiseSpectrum const &sb = b.*member;
+        for (std::size_t k = 0; k < std::min(sa.spl.size(), sb.spl.size()); ++k)
+            compare(sa.spl[k], sb.spl[k]);
+        compare(sa.oaspl, sb.oaspl);
+    }
+    return error;
+}
+
+bool TabulatedNoiseConfigBuilder::Exact(SectionNoiseInput  const &inp,
+                                        NoiseConfig        const &noise_cfg,
+                                        SectionNoiseResult       &result) const
+{
+    fallbacks_.fetch_add(1, std::memory_order_relaxed);
+    result.surrogate_error_db = 0.0;
+    return exact_->Build(inp, noise_cfg, result);
+}
@@ -1,90 +1,167 @@
 #include "TecplotFormatter.h"
 
+#include <charconv>
+#include <cstdio>
+#include <system_error>
+
 std::string TecplotFormatter::format(const DataFormat &data) const
 {
-    std::ostringstream oss;
+    std::string out;
 
     // Write title
-    oss << "TITLE=\"" << data.getTitle() << "\"\n";
+    out += "TITLE=\"";
+    out += data.getTitle();
+    out += "\"\n";
 
     // Write variables
-    oss << formatVariables(data.getVariables()) << "\n";
+    appendVariables(out, data.getVariables());
+    out += '\n';
 
     // Write all zones
     for (const auto &zone : data.getZones())
     {
-        oss << formatZoneHeader(zone) << "\n";
-        oss << formatZoneData(zone);
+        appendZoneHeader(out, zone);
+        out += '\n';
+        for (const auto &row : zone.data)
+        {
+            appendRow(out, row, zone.columnPrecisions);
+        }
+    }
+
+    return out;
+}
+
+bool TecplotFormatter::formatTo(const DataFormat &data, IOutputTarget &target) const
+{
+    if (!target.begin())
+    {
+        return target.write(format(data));
+    }
+
+    std::string buffer;
+    buffer.reserve(kChunkBytes + 4096);
+
+    buffer += "TITLE=\"";
+    buffer += data.getTitle();
+    buffer += "\"\n";
+    appendVariables(buffer, data.getVariables());
+    buffer += '\n';
+
+    bool ok = true;
+    for (const auto &zone : data.getZones())
+    {
+        appendZoneHeader(buffer, zone);
+        buffer += '\n';
+        for (const auto &row : zone.data)
+        {
+            appendRow(buffer, row, zone.columnPrecisions);
+            if (buffer.size() >= kChunkBytes)
+            {
+                ok = target.append(buffer);
+                buffer.clear();
+                if (!ok)
+                {
+                    break;
+                }
+            }
+        }
+        if (!ok)
+        {
+            break;
+        }
+    }
+
+    if (ok && !buffer.empty())
+    {
+        ok = target.append(buffer);
+    }
+    return target.finish() && ok;
+}
+
+void TecplotFormatter::appendFixed(std::string &out, double value, int precision)
+{
+    if (precision < 0)
+    {
+        precision = 6;
     }
 
-    return oss.str();
+    char buf[128];
+    const auto [end, ec] = std::to_chars(buf, buf + sizeof(buf), value,
+                                         std::chars_format::fixed, precision);
+    if (ec == std::errc{})
+    {
+        out.append(buf, end);
+        return;
+    }
+
+    // Very large magnitudes or precisions: size the text first
+    const int len = std::snprintf(nullptr, 0, "%.*f", precision, value);
+    const std::size_t pos = out.size();
+    out.resize(pos + static_cast<std::size_t>(len) + 1);
+    std::snprintf(out.data() + pos, static_cast<std::size_t>(len) + 1, "%.*f", precision, value);
+    out.resize(pos + static_cast<std::size_t>(len));
 }
 
-std::string TecplotFormatter::formatVariables(const std::vector<std::string> &vars) const
+void TecplotFormatter::appendVariables(std::string &out, const std::vector<std::string> &vars) const
 {
-    std::ostringstream oss;
-    oss << "VARIABLES=";
+    out += "VARIABLES=";
 
     for (size_t i = 0; i < vars.size(); ++i)
     {
-        oss << "\"" << vars[i] << "\"";
+        out += '"';
+        out += vars[i];
+        out += '"';
         if (i < vars.size() - 1)
         {
-            oss << " ";
+            out += ' ';
         }
     }
-
-    return oss.str();
 }
 
-std::string TecplotFormatter::formatZoneHeader(const DataZone &zone) const
+void TecplotFormatter::appendZoneHeader(std::string &out, const DataZone &zone) const
 {
-    std::ostringstream oss;
-    oss << "ZONE I=" << zone.I;
+    out += "ZONE I=";
+    out += std::to_string(zone.I);
 
     if (zone.J > 0)
     {
-        oss << ", J=" << zone.J;
+        out += ", J=";
+        out += std::to_string(zone.J);
     }
 
     if (zone.K > 0)
     {
-        oss << ", K=" << zone.K;
+        out += ", K=";
+        out += std::to_string(zone.K);
     }
 
     if (zone.dataPacking != "POINT")
     {
-        oss << ", DATAPACKING=" << zone.dataPacking;
+        out += ", DATAPACKING=";
+        out += zone.dataPacking;
     }
 
     if (!zone.title.empty())
     {
-        oss << ",T=\"" << zone.title << "\"";
+        out += ",T=\"";
+        out += zone.title;
+        out += '"';
     }
-
-    return oss.str();
 }
 
-std::string TecplotFormatter::formatZoneData(const DataZone &zone) const
+void TecplotFormatter::appendRow(std::string &out, const std::vector<double> &row,
+                                 const std::vector<int> &precisions) const
 {
-    constexpr int kDefaultPrecision = 9;
-    std::ostringstream oss;
-
-    for (const auto &row : zone.data)
+    for (size_t i = 0; i < row.size(); ++i)
     {
-        for (size_t i = 0; i < row.size(); ++i)
+        const int prec = (i < precisions.size())
+                       ? precisions[i]
+                       : kDefaultPrecision;
+        appendFixed(out, row[i], prec);
+        if (i < row.size() - 1)
         {
-            const int prec = (i < zone.columnPrecisions.size())
-                           ? zone.columnPrecisions[i]
-                           : kDefaultPrecision;
-            oss << std::fixed << std::setprecision(prec) << row[i];
-            if (i < row.size() - 1)
-            {
-                oss << " ";
-            }
+            out += ' ';
         }
-        oss << "\n";
     }
-
-    return oss.str();
+    out += '\n';
 }
@@ -6,13 +6,17 @@
 #include "DataWriter.h"
 #include "FileOutputTarget.h"
 
+#include "bladenoise/math/SpectralKernels.h"
+
 #include <cmath>
 #include <filesystem>
 #include <iomanip>
 #include <iostream>
+#include <numbers>
 #include <sstream>
 
-namespace fs = std::filesystem;
+namespace fs       = std::filesystem;
+namespace spectral = bladenoise::math::spectral;
 
 // ─────────────────────────────────────────────────────────────────────────────
 // Construction
@@ -32,10 +36,10 @@ bool TecplotNoiseExporter::ExportBladeNoise(
 }
 
 bool TecplotNoiseExporter::ExportPowerCurveNoise(
-    std::vector<BladeNoiseResult> const &results,
-    std::string                   const &output_path) const
+    INoiseSpectra const &spectra,
+    std::string   const &output_path) const
 {
-    return Write(BuildPowerCurveFormat(results), output_path);
+    return Write(BuildPowerCurveFormat(spectra), output_path);
 }
 
 // ─────────────────────────────────────────────────────────────────────────────
@@ -178,23 +182,25 @@ std::vector<std::string> TecplotNoiseExporter::PowerCurveVariables(
 // LWA_total  = 10·log10( Σ_i 10^(LW_section_i / 10) )
 // ─────────────────────────────────────────────────────────────────────────────
 double TecplotNoiseExporter::ComputeLWA(
-    BladeNoiseResult const &result,
-    SectionNoiseSpectrum SectionNoiseResult::*src)
+    INoiseSpectra const &spectra,
+    std::size_t          point,
+    NoiseSource          src)
 {
     double sum_linear = 0.0;
-    for (auto const &sec : result.sections)
+    for (std::size_t s = 0; s < spectra.sections(point); ++s)
     {
+        const NoiseSectionInfo sec = spectra.section(point, s);
         if (!sec.converged) continue;
-        SectionNoiseSpectrum const &sp = sec.*src;
-        if (sp.oaspl <= -99.0) continue;
+        const double oaspl = spectra.oaspl(point, s, src);
+        if (oaspl <= spectral::INACTIVE_DB) continue;
         // Radiating area per section: chord × span.
         const double area_proxy = (sec.span > 0.0)
                                 ? sec.chord * sec.span
                                 : sec.chord; // fallback: per-unit-span
-        const double lw_sec = sp.oaspl + 10.0 * std::log10(area_proxy + 1e-30);
+        const double lw_sec = oaspl + 10.0 * std::log10(area_proxy + 1e-30);
         sum_linear += std::pow(10.0, lw_sec / 10.0);
     }
-    if (sum_linear <= 0.0) return -100.0;
+    if (sum_linear <= 0.0) return spectral::FLOOR_DB;
     return 10.0 * std::log10(sum_linear);
 }
 
@@ -203,46 +209,51 @@ double TecplotNoiseExporter::ComputeLWA(
 // One row per blade section; all noise source OASPLs + total SPL spectrum.
 // ─────────────────────────────────────────────────────────────────────────────
 DataZone TecplotNoiseExporter::BuildOperatingPointZone(
-    BladeNoiseResult const &result)
+    INoiseSpectra const &spectra,
+    std::size_t          point)
 {
-    const int n_sec = static_cast<int>(result.sections.size());
+    const std::size_t n_sec = spectra.sections(point);
     std::ostringstream zone_title;
     zone_title << std::fixed << std::setprecision(2)
-               << "v_inf=" << result.vinf << "m_s";
-    DataZone zone(zone_title.str(), n_sec);
-
-    // Per-column precision — derive band count from first section's total SPL
-    const int n_bands = result.sections.empty()
-                      ? 0
-                      : static_cast<int>(result.sections.front().total.spl.size());
-    zone.columnPrecisions = PowerCurvePrecisions(n_bands);
+               << "v_inf=" << spectra.vinf(point) << "m_s";
+    DataZone zone(zone_title.str(), static_cast<int>(n_sec));
+    zone.columnPrecisions = PowerCurvePrecisions(static_cast<int>(spectra.bands()));
 
     // Pre-compute LWA for the total source at this operating point
     // (same value for every row in the zone — it is an integrated quantity)
-    const double lwa_total = ComputeLWA(result, &SectionNoiseResult::total);
+    const double lwa_total = ComputeLWA(spectra, point, NoiseSource::Total);
 
-    for (auto const &sec : result.sections)
+    std::vector<double> spl(spectra.bands());
+    zone.data.reserve(n_sec);
+    for (std::size_t s = 0; s < n_sec; ++s)
     {
+        const NoiseSectionInfo sec = spectra.section(point, s);
+        auto oaspl = [&](NoiseSource src)
+        {
+            return spectra.oaspl(point, s, src);
+        };
+
         std::vector<double> row = {
-            result.vinf,
+            spectra.vinf(point),
             sec.radius,
             sec.chord,
             sec.velocity,
             sec.reynolds,
             sec.mach,
             sec.alpha_deg,
-            sec.total.oaspl,
-            sec.tbl_pressure_side.oaspl,
-            sec.tbl_suction_side.oaspl,
-            sec.separation.oaspl,
-            sec.laminar_vortex.oaspl,
-            sec.bluntness.oaspl,
-            sec.turbulent_inflow.oaspl,
+            oaspl(NoiseSource::Total),
+            oaspl(NoiseSource::TblPressureSide),
+            oaspl(NoiseSource::TblSuctionSide),
+            oaspl(NoiseSource::Separation),
+            oaspl(NoiseSource::LaminarVortex),
+            oaspl(NoiseSource::Bluntness),
+            oaspl(NoiseSource::TurbulentInflow),
             lwa_total,
         };
         // SPL spectrum of total source
-        for (double v : sec.total.spl) row.push_back(v);
-        zone.data.push_back(row);
+        spectra.spectrum(point, s, NoiseSource::Total, spl);
+        row.insert(row.end(), spl.begin(), spl.end());
+        zone.data.push_back(std::move(row));
     }
     return zone;
 }
@@ -251,21 +262,15 @@ DataZone TecplotNoiseExporter::BuildOperatingPointZone(
 // BuildPowerCurveFormat
 // ─────────────────────────────────────────────────────────────────────────────
 DataFormat TecplotNoiseExporter::BuildPowerCurveFormat(
-    std::vector<BladeNoiseResult> const &results)
+    INoiseSpectra const &spectra)
 {
     DataFormat fmt("PowerCurveNoise");
+    fmt.setVariables(PowerCurveVariables(spectra.frequencies()));
 
-    // Derive frequency list from first valid result
-    std::vector<double> frequencies;
-    for (auto const &r : results)
-        if (!r.frequencies.empty()) { frequencies = r.frequencies; break; }
-
-    fmt.setVariables(PowerCurveVariables(frequencies));
-
-    for (auto const &r : results)
+    for (std::size_t p = 0; p < spectra.points(); ++p)
     {
-        if (r.sections.empty()) continue;
-        fmt.addZone(BuildOperatingPointZone(r));
+        if (spectra.sections(p) == 0) continue;
+        fmt.addZone(BuildOperatingPointZone(spectra, p));
     }
     return fmt;
 }
@@ -434,3 +439,118 @@ DataFormat TecplotNoiseExporter::BuildRotorNoiseFormat(
 
     return fmt;
 }
+
+// ─────────────────────────────────────────────────────────────────────────────
+// ExportNoiseMap
+// ─────────────────────────────────────────────────────────────────────────────
+bool TecplotNoiseExporter::ExportNoiseMap(
+    std::vector<NoiseMapResult> const &results,
+    std::string                 const &output_path) const
+{
+    DataFormat fmt("RotorNoiseMap");
+    fmt.setVariables({
+        "x_[m]",
+        "y_[m]",
+        "OASPL_[dB]",
+        "OASPL_A_[dB(A)]",
+    });
+
+    for (auto const &r : results)
+    {
+        if (r.size() == 0) continue;
+        fmt.addZone(BuildNoiseMapZone(r));
+    }
+    return Write(fmt, output_path);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// BuildNoiseMapZone
+// Ordered zone, x varies fastest (Tecplot POINT order for I×J).
+// ─────────────────────────────────────────────────────────────────────────────
+DataZone TecplotNoiseExporter::BuildNoiseMapZone(NoiseMapResult const &result)
+{
+    std::ostringstream zone_title;
+    zone_title << std::fixed << std::setprecision(2)
+               << "v_inf=" << result.vinf << "m_s";
+
+    const int nx = static_cast<int>(result.x.size());
+    const int ny = static_cast<int>(result.y.size());
+    DataZone zone(zone_title.str(), nx, ny);
+    zone.columnPrecisions = {2, 2, 2, 2};
+
+    zone.data.reserve(result.size());
+    for (int j = 0; j < ny; ++j)
+        for (int i = 0; i < nx; ++i)
+        {
+            const std::size_t idx = static_cast<std::size_t>(j) * nx + i;
+            zone.data.push_back({
+                result.x[i],
+                result.y[j],
+                result.oaspl[idx],
+                result.oasplA[idx],
+            });
+        }
+    return zone;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// ExportAzimuthNoise
+// ─────────────────────────────────────────────────────────────────────────────
+bool TecplotNoiseExporter::ExportAzimuthNoise(
+    std::vector<AzimuthNoiseResult> const &results,
+    std::string                     const &output_path) const
+{
+    DataFormat fmt("RotorNoiseAzimuth");
+    fmt.setVariables({
+        "psi_[deg]",
+        "t_[s]",
+        "OASPL_blade_[dB]",
+        "OASPL_A_blade_[dB(A)]",
+        "LWA_blade_[dB(A)]",
+        "OASPL_rotor_[dB]",
+        "OASPL_A_rotor_[dB(A)]",
+        "LWA_rotor_[dB(A)]",
+    });
+
+    for (auto const &r : results)
+    {
+        if (r.size() == 0) continue;
+        fmt.addZone(BuildAzimuthNoiseZone(r));
+    }
+    return Write(fmt, output_path);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// BuildAzimuthNoiseZone
+// ─────────────────────────────────────────────────────────────────────────────
+DataZone TecplotNoiseExporter::BuildAzimuthNoiseZone(AzimuthNoiseResult const &result)
+{
+    std::ostringstream zone_title;
+    zone_title << std::fixed << std::setprecision(2)
+               << "v_inf=" << result.vinf << "m_s"
+               << " dLA=" << result.rotor_oasplA_depth << "dB";
+
+    const int n = static_cast<int>(result.size());
+    DataZone zone(zone_title.str(), n);
+    zone.columnPrecisions = {2, 5, 2, 2, 2, 2, 2, 2};
+
+    constexpr double deg2rad = std::numbers::pi / 180.0;
+    zone.data.reserve(result.size());
+    for (std::size_t p = 0; p < result.size(); ++p)
+    {
+        const double t = result.rot_rate > 0.0
+                       ? result.psi_deg[p] * deg2rad / result.rot_rate
+                       : 0.0;
+        zone.data.push_back({
+            result.psi_deg[p],
+            t,
+            result.blade_oaspl[p],
+            result.blade_oasplA[p],
+            result.blade_lwA[p],
+            result.rotor_oaspl[p],
+            result.rotor_oasplA[p],
+            result.rotor_lwA[p],
+        });
+    }
+    return zone;
+}
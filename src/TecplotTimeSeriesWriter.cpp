@@ -0,0 +1,69 @@
+/**
+ * @file TecplotTimeSeriesWriter.cpp
+ * @brief Implementation of TecplotTimeSeriesWriter.
+ */
+#include "TecplotTimeSeriesWriter.h"
+
+#include <filesystem>
+#include <stdexcept>
+
+#include "DataFormat.h"
+#include "TecplotFormatter.h"
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Construction — header through TecplotFormatter (zone without data rows)
+// ─────────────────────────────────────────────────────────────────────────────
+TecplotTimeSeriesWriter::TecplotTimeSeriesWriter(std::string const &path,
+                                                 std::string const &title,
+                                                 std::vector<std::string> const &variables,
+                                                 std::size_t num_rows)
+    : num_columns_(variables.size())
+{
+    namespace fs = std::filesystem;
+
+    fs::path const file_path(path);
+    if (file_path.has_parent_path())
+    {
+        std::error_code ec;
+        fs::create_directories(file_path.parent_path(), ec);
+    }
+
+    out_.open(file_path);
+    if (!out_)
+        throw std::runtime_error("TecplotTimeSeriesWriter: cannot create file: " + path);
+
+    DataFormat fmt(title);
+    fmt.setVariables(variables);
+    fmt.addZone(DataZone(title, static_cast<int>(num_rows)));
+    out_ << TecplotFormatter{}.format(fmt);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// AppendRow — same number format as TecplotFormatter's default precision
+// ─────────────────────────────────────────────────────────────────────────────
+void TecplotTimeSeriesWriter::AppendRow(std::vector<double> const &row)
+{
+    if (row.size() != num_columns_)
+        throw std::invalid_argument("TecplotTimeSeriesWriter: row has wrong column count");
+
+    line_.clear();
+    for (std::size_t i = 0; i < row.size(); ++i)
+    {
+        TecplotFormatter::appendFixed(line_, row[i], TecplotFormatter::kDefaultPrecision);
+        if (i < row.size() - 1)
+            line_ += ' ';
+    }
+    line_ += '\n';
+    out_.write(line_.data(), static_cast<std::streamsize>(line_.size()));
+
+    if (++rows_written_ % kFlushRows == 0)
+        out_.flush();
+}
+
+bool TecplotTimeSeriesWriter::Close()
+{
+    out_.flush();
+    bool const ok = static_cast<bool>(out_);
+    out_.close();
+    return ok;
+}
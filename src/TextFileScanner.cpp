@@ -0,0 +1,241 @@
+#include "TextFileScanner.h"
+
+#include <cctype>
+#include <charconv>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// ---------------------------------------------------------------------------
+// MappedTextFile
+// ---------------------------------------------------------------------------
+
+MappedTextFile::MappedTextFile(const std::string& filePath) {
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        throw std::runtime_error("Cannot open file: " + filePath);
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize)) {
+        CloseHandle(file);
+        throw std::runtime_error("Cannot read size of file: " + filePath);
+    }
+    size = static_cast<std::size_t>(fileSize.QuadPart);
+
+    if (size > 0) {
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping != nullptr) {
+            data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+            CloseHandle(mapping);
+        }
+    }
+    CloseHandle(file);
+#else
+    const int fd = ::open(filePath.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw std::runtime_error("Cannot open file: " + filePath);
+
+    struct stat st {};
+    if (::fstat(fd, &st) != 0) {
+        ::close(fd);
+        throw std::runtime_error("Cannot read size of file: " + filePath);
+    }
+    size = static_cast<std::size_t>(st.st_size);
+
+    if (size > 0) {
+        void* p = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p != MAP_FAILED) {
+            ::madvise(p, size, MADV_SEQUENTIAL);
+            data = static_cast<const char*>(p);
+        }
+    }
+    ::close(fd);
+#endif
+
+    if (size > 0 && data == nullptr) {
+        size = 0;
+        throw std::runtime_error("Cannot map file: " + filePath);
+    }
+}
+
+MappedTextFile::~MappedTextFile() {
+    release();
+}
+
+MappedTextFile::MappedTextFile(MappedTextFile&& other) noexcept
+    : data(std::exchange(other.data, nullptr)),
+      size(std::exchange(other.size, 0)) {
+}
+
+MappedTextFile& MappedTextFile::operator=(MappedTextFile&& other) noexcept {
+    if (this != &other) {
+        release();
+        data = std::exchange(other.data, nullptr);
+        size = std::exchange(other.size, 0);
+    }
+    return *this;
+}
+
+void MappedTextFile::release() noexcept {
+    if (data == nullptr) return;
+#if defined(_WIN32)
+    UnmapViewOfFile(data);
+#else
+    ::munmap(const_cast<char*>(data), size);
+#endif
+    data = nullptr;
+    size = 0;
+}
+
+// ---------------------------------------------------------------------------
+// LineScanner
+// ---------------------------------------------------------------------------
+
+LineScanner::LineScanner(std::string_view text) : rest(text) {
+    if (rest.substr(0, 3) == "\xEF\xBB\xBF")
+        rest.remove_prefix(3);
+}
+
+bool LineScanner::next(std::string_view& line) {
+    if (rest.empty()) return false;
+
+    const auto end = rest.find('\n');
+    if (end == std::string_view::npos) {
+        line = rest;
+        rest = {};
+    }
+    else {
+        line = rest.substr(0, end);
+        rest.remove_prefix(end + 1);
+    }
+
+    if (!line.empty() && line.back() == '\r')
+        line.remove_suffix(1);
+
+    ++number;
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// text helpers
+// ---------------------------------------------------------------------------
+
+namespace text {
+
+namespace {
+
+bool isSpace(char c) {
+    return std::isspace(static_cast<unsigned char>(c)) != 0;
+}
+
+char lower(char c) {
+    return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+}
+
+// Skips leading whitespace and a '+' sign, which std::from_chars rejects.
+std::string_view numberStart(std::string_view s) {
+    std::size_t i = 0;
+    while (i < s.size() && isSpace(s[i])) ++i;
+    if (i < s.size() && s[i] == '+' && i + 1 < s.size() && s[i + 1] != '-') ++i;
+    return s.substr(i);
+}
+
+template <typename T>
+std::errc convert(std::string_view s, T& value) {
+    s = numberStart(s);
+    T parsed{};
+    const auto result = std::from_chars(s.data(), s.data() + s.size(), parsed);
+    if (result.ec == std::errc{})
+        value = parsed;
+    return result.ec;
+}
+
+template <typename T>
+T convertOrThrow(std::string_view s, const char* what) {
+    T value{};
+    const std::errc ec = convert(s, value);
+    if (ec == std::errc::result_out_of_range)
+        throw std::out_of_range(std::string(what) + " out of range: '" + std::string(s) + "'");
+    if (ec != std::errc{})
+        throw std::invalid_argument(std::string("invalid ") + what + ": '" + std::string(s) + "'");
+    return value;
+}
+
+}  // namespace
+
+std::string_view trim(std::string_view s, std::string_view chars) {
+    const auto first = s.find_first_not_of(chars);
+    if (first == std::string_view::npos) return {};
+    const auto last = s.find_last_not_of(chars);
+    return s.substr(first, last - first + 1);
+}
+
+void splitFields(std::string_view line, char delimiter, std::vector<std::string_view>& out) {
+    out.clear();
+    while (true) {
+        const auto end = line.find(delimiter);
+        const std::string_view field = trim(line.substr(0, end), " \t\r");
+        if (!field.empty())
+            out.push_back(field);
+        if (end == std::string_view::npos) break;
+        line.remove_prefix(end + 1);
+    }
+}
+
+void splitWhitespace(std::string_view line, std::vector<std::string_view>& out) {
+    out.clear();
+    std::size_t i = 0;
+    while (i < line.size()) {
+        while (i < line.size() && isSpace(line[i])) ++i;
+        const std::size_t start = i;
+        while (i < line.size() && !isSpace(line[i])) ++i;
+        if (i > start)
+            out.push_back(line.substr(start, i - start));
+    }
+}
+
+bool startsWithNoCase(std::string_view s, std::string_view prefix) {
+    if (s.size() < prefix.size()) return false;
+    for (std::size_t i = 0; i < prefix.size(); ++i)
+        if (lower(s[i]) != lower(prefix[i])) return false;
+    return true;
+}
+
+std::size_t findNoCase(std::string_view s, std::string_view needle, std::size_t from) {
+    if (needle.size() > s.size()) return std::string_view::npos;
+    for (std::size_t i = from; i + needle.size() <= s.size(); ++i)
+        if (startsWithNoCase(s.substr(i), needle)) return i;
+    return std::string_view::npos;
+}
+
+bool parseDouble(std::string_view s, double& value) {
+    return convert(s, value) == std::errc{};
+}
+
+bool parseInt(std::string_view s, int& value) {
+    return convert(s, value) == std::errc{};
+}
+
+double toDouble(std::string_view s) {
+    return convertOrThrow<double>(s, "number");
+}
+
+int toInt(std::string_view s) {
+    return convertOrThrow<int>(s, "integer");
+}
+
+}  // namespace text
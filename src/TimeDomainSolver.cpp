@@ -0,0 +1,299 @@
+/**
+ * @file TimeDomainSolver.cpp
+ * @brief Implementation of TimeDomainSolver.
+ */
+#define _USE_MATH_DEFINES
+#include "TimeDomainSolver.h"
+#include "BEMPostprocessor.h"
+#include "FlowCalculator.h"
+#include "FlowCalculatorFactory.h"
+#include "NingSolverFactory.h"
+#include "TurbSimSamplingPlan.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace
+{
+// ── Journal records ──────────────────────────────────────────────────────────
+// First record: the run definition.  Then, tagged, one 'R' record per step
+// and an 'S' record (next step, converged count, flow angles per blade)
+// every kStateInterval steps.
+constexpr std::uint8_t kRowTag = 'R';
+constexpr std::uint8_t kStateTag = 'S';
+
+std::string StepRecord(TimeDomainStep const &s)
+{
+    BinaryWriter rec;
+    rec.pod(kRowTag);
+    rec.pod(s.step);
+    rec.f64(s.time);
+    rec.f64(s.psi);
+    rec.f64(s.v_hub);
+    rec.f64(s.power);
+    rec.f64(s.thrust);
+    rec.f64(s.torque);
+    rec.pod(s.converged_blades);
+    rec.doubles(s.blade_thrust);
+    rec.doubles(s.root_mx);
+    rec.doubles(s.root_my);
+    return rec.take();
+}
+
+TimeDomainStep GetStep(BinaryReader &in)
+{
+    TimeDomainStep s;
+    s.step   = in.pod<unsigned>();
+    s.time   = in.f64();
+    s.psi    = in.f64();
+    s.v_hub  = in.f64();
+    s.power  = in.f64();
+    s.thrust = in.f64();
+    s.torque = in.f64();
+    s.converged_blades = in.pod<unsigned>();
+    s.blade_thrust = in.doubles();
+    s.root_mx = in.doubles();
+    s.root_my = in.doubles();
+    return s;
+}
+} // namespace
+
+// ─────────────────────────────────────────────────────────────────────────────
+TimeDomainSolver::TimeDomainSolver(TurbineGeometry const   *turbine,
+                                   ISimulationConfig const *sim_config,
+                                   TurbSimManager const    *wind)
+    : turbine_(turbine), sim_config_(sim_config), wind_(wind)
+{
+    if (!turbine_)
+        throw std::invalid_argument("TimeDomainSolver: turbine must be non-null");
+    if (!sim_config_)
+        throw std::invalid_argument("TimeDomainSolver: sim_config must be non-null");
+    if (!wind_)
+        throw std::invalid_argument("TimeDomainSolver: wind must be non-null");
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+unsigned TimeDomainSolver::StepCount(TimeDomainParams const &params) const
+{
+    const unsigned available = wind_->requested_num_iterations();
+    return params.num_steps == 0 ? available
+                                 : std::min(params.num_steps, available);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+double TimeDomainSolver::BladeAzimuth(TimeDomainParams const &params,
+                                      unsigned step, int blade) const
+{
+    const double two_pi = 2.0 * M_PI;
+    const double time = static_cast<double>(step) * wind_->timestep();
+    const double psi = std::fmod(params.psi_start + params.rot_rate * time, two_pi);
+    if (blade == 0)
+        return psi;
+    const double spacing = two_pi / static_cast<double>(turbine_->num_blades());
+    return std::fmod(psi + static_cast<double>(blade) * spacing, two_pi);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Run
+//
+// Per step:
+//   0. (every kPlanBlock steps) plan the sample stencils of the next block
+//   1. gather the inflow of all sections, then one FlowCalculator +
+//      NingSolver per blade, warm-started from the blade's last step
+//   2. all (blade, section) pairs in one dynamic parallel loop
+//   3. per-blade postprocessing (single blade) and reduction to rotor loads
+//
+// The factories live for one step only, so memory does not grow with the
+// length of the run.
+// ─────────────────────────────────────────────────────────────────────────────
+unsigned TimeDomainSolver::Run(TimeDomainParams const &params,
+                               TimeDomainStepCallback const &on_step,
+                               CheckpointJournal *journal) const
+{
+    const unsigned n_steps = StepCount(params);
+    const int n_blades = turbine_->num_blades();
+    if (n_blades <= 0)
+        throw std::invalid_argument("TimeDomainSolver: turbine has no blades");
+
+    const std::size_t n_blades_sz = static_cast<std::size_t>(n_blades);
+    const int n_sec = static_cast<int>(turbine_->num_sections());
+    const int n_tasks = n_blades * n_sec;
+    const std::size_t n_sec_sz = turbine_->num_sections();
+    const double dt = wind_->timestep();
+    const double v_hub_mean = wind_->hub_velocity();
+    const WVPMUtilities::Vec3D<double> hub_centre(0.0, 0.0, turbine_->hub_height());
+
+    // Converged flow angles of each blade's previous step (empty → cold start).
+    std::vector<std::vector<double>> phi_prev(n_blades_sz);
+
+    std::unique_ptr<TurbSimSamplingPlan> plan;
+    std::vector<double> u(n_blades_sz * n_sec_sz), v(u.size()), w(u.size());
+
+    unsigned fully_converged = 0;
+    unsigned first_step = 0;
+
+    // ── Resume: replay journaled steps up to the last saved state ─────────────
+    if (journal)
+    {
+        BinaryWriter run;
+        run.f64(params.rot_rate);
+        run.f64(params.pitch_rad);
+        run.f64(params.psi_start);
+        run.pod(n_steps);
+        run.pod(n_blades);
+        run.pod(n_sec);
+        run.f64(dt);
+
+        std::vector<std::string> const &records = journal->restored();
+        std::size_t keep = 0;
+        if (!records.empty() && records.front() == run.bytes())
+        {
+            keep = 1;
+            for (std::size_t r = records.size(); r-- > 1;)
+            {
+                BinaryReader in(records[r]);
+                if (in.pod<std::uint8_t>() != kStateTag)
+                    continue;
+                first_step = in.pod<unsigned>();
+                fully_converged = in.pod<unsigned>();
+                for (auto &phi : phi_prev)
+                    phi = in.doubles();
+                keep = r + 1;
+                break;
+            }
+        }
+
+        if (keep == 0)
+        {
+            journal->KeepRestored(0);
+            journal->Append(run.take());
+        }
+        else
+        {
+            journal->KeepRestored(keep);
+            for (std::size_t r = 1; r < keep; ++r)
+            {
+                BinaryReader in(records[r]);
+                if (in.pod<std::uint8_t>() == kRowTag)
+                    on_step(GetStep(in));
+            }
+        }
+    }
+
+    for (unsigned step = first_step; step < n_steps; ++step)
+    {
+        TimeDomainStep out;
+        out.step = step;
+        out.time = static_cast<double>(step) * dt;
+        out.psi  = BladeAzimuth(params, step, 0);
+        out.v_hub = wind_->VelocityAt(hub_centre, step).x();
+        out.blade_thrust.assign(n_blades_sz, 0.0);
+        out.root_mx.assign(n_blades_sz, 0.0);
+        out.root_my.assign(n_blades_sz, 0.0);
+
+        // ── 0. Sample stencils for the next block of steps ────────────────────
+        if (!plan || !plan->Covers(step))
+        {
+            const unsigned block = std::min(kPlanBlock, n_steps - step);
+            std::vector<double> azimuths;
+            azimuths.reserve(static_cast<std::size_t>(block) * n_blades_sz);
+            for (unsigned s = step; s < step + block; ++s)
+                for (int b = 0; b < n_blades; ++b)
+                    azimuths.push_back(BladeAzimuth(params, s, b));
+            plan = std::make_unique<TurbSimSamplingPlan>(turbine_, wind_->grid(), step, azimuths);
+        }
+
+        // ── 1. Flow field and solver per blade ────────────────────────────────
+        plan->Gather(step, wind_->Timestep(step), u.data(), v.data(), w.data());
+
+        FlowCalculatorFactory fc_factory;
+        NingSolverFactory     solver_factory;
+
+        std::vector<std::unique_ptr<FlowCalculator>> fcs(n_blades_sz);
+        std::vector<std::unique_ptr<NingSolver>>     solvers(n_blades_sz);
+
+        for (std::size_t b = 0; b < n_blades_sz; ++b)
+        {
+            const double psi_b = BladeAzimuth(params, step, static_cast<int>(b));
+
+            std::vector<WVPMUtilities::Vec3D<double>> inflow;
+            inflow.reserve(n_sec_sz);
+            for (std::size_t i = b * n_sec_sz; i < (b + 1) * n_sec_sz; ++i)
+                inflow.emplace_back(u[i], v[i], w[i]);
+
+            fcs[b] = fc_factory.BuildSampled(turbine_, params.rot_rate, psi_b,
+                                             std::move(inflow), v_hub_mean);
+            solvers[b] = solver_factory.Build(
+                turbine_, sim_config_, fcs[b].get(), params.pitch_rad, psi_b,
+                /*verbose=*/false,
+                phi_prev[b].empty() ? nullptr : &phi_prev[b]);
+            solvers[b]->BeginSolve();
+        }
+
+        // ── 2. All blade sections of the step in one loop ─────────────────────
+        #pragma omp parallel for schedule(dynamic, 1) default(none) \
+            shared(solvers, n_tasks, n_sec)
+        for (int k = 0; k < n_tasks; ++k)
+            solvers[static_cast<std::size_t>(k / n_sec)]
+                ->SolveSection(static_cast<std::size_t>(k % n_sec));
+
+        // ── 3. Blade loads → rotor loads ──────────────────────────────────────
+        for (std::size_t b = 0; b < n_blades_sz; ++b)
+        {
+            if (!solvers[b]->EndSolve())
+            {
+                phi_prev[b].clear();
+                continue;
+            }
+
+            BEMPostprocessor postproc(turbine_, sim_config_, fcs[b].get(),
+                                      /*num_blades=*/1.0,
+                                      PostprocessDetail::FULL_LOADS);
+            postproc.Process(*solvers[b]);
+            if (!postproc.Success())
+            {
+                phi_prev[b].clear();
+                continue;
+            }
+
+            BEMPostprocessResult const &pp = postproc.Result();
+            out.power  += pp.p;
+            out.thrust += pp.thrust;
+            out.torque += pp.torque;
+            out.blade_thrust[b] = pp.thrust;
+            out.root_mx[b] = pp.mx;
+            out.root_my[b] = pp.my;
+            ++out.converged_blades;
+
+            phi_prev[b] = solvers[b]->phi();
+        }
+
+        if (out.converged_blades == n_blades_sz)
+            ++fully_converged;
+
+        on_step(out);
+
+        if (journal)
+        {
+            journal->Append(StepRecord(out));
+            if ((step + 1) % kStateInterval == 0)
+            {
+                BinaryWriter state;
+                state.pod(kStateTag);
+                state.pod(step + 1);
+                state.pod(fully_converged);
+                for (auto const &phi : phi_prev)
+                    state.doubles(phi);
+                journal->Append(state.take());
+            }
+        }
+    }
+
+    return fully_converged;
+}
@@ -52,6 +52,22 @@ TurbSimManager::VelocityAt(WVPMUtilities::Vec3D<double> const &point,
     return interpolator_->Interpolate(point, raw_ts, grid_, velocity_);
 }
 
+// ─────────────────────────────────────────────────────────────────────────────
+// VelocitiesAt — batched VelocityAt for one iteration
+// ─────────────────────────────────────────────────────────────────────────────
+void TurbSimManager::VelocitiesAt(double const *y,
+                                  double const *z,
+                                  std::size_t count,
+                                  unsigned iteration,
+                                  double *u,
+                                  double *v,
+                                  double *w) const
+{
+    AssertLoaded();
+    std::size_t raw_ts = timing_->RawIndex(iteration);
+    interpolator_->InterpolateBatch(y, z, count, raw_ts, grid_, velocity_, u, v, w);
+}
+
 // ─────────────────────────────────────────────────────────────────────────────
 // Accessors
 // ─────────────────────────────────────────────────────────────────────────────
@@ -73,12 +89,18 @@ unsigned TurbSimManager::requested_num_iterations() const
     return timing_->usable_iterations();
 }
 
-TurbSimGrid TurbSimManager::grid() const
+TurbSimGrid const &TurbSimManager::grid() const
 {
     AssertLoaded();
     return grid_;
 }
 
+TurbSimVelocityData::TimestepView TurbSimManager::Timestep(unsigned iteration) const
+{
+    AssertLoaded();
+    return velocity_.View(timing_->RawIndex(iteration));
+}
+
 // ─────────────────────────────────────────────────────────────────────────────
 // velocity_data_not_padded_as_vectors — legacy diagnostic API
 // ─────────────────────────────────────────────────────────────────────────────
@@ -87,15 +109,10 @@ TurbSimManager::velocity_data_not_padded_as_vectors(unsigned iteration) const
 {
     AssertLoaded();
     std::size_t raw_ts = timing_->RawIndex(iteration);
-    VelocityTimestep const &ts = velocity_.Timestep(raw_ts);
 
-    std::vector<double> u(ts.size()), v(ts.size()), w(ts.size());
-    for (std::size_t i = 0; i < ts.size(); ++i)
-    {
-        u[i] = ts[i].x();
-        v[i] = ts[i].y();
-        w[i] = ts[i].z();
-    }
+    std::size_t const n = velocity_.num_points();
+    std::vector<double> u(n), v(n), w(n);
+    velocity_.DecodeTimestep(raw_ts, u.data(), v.data(), w.data());
     return {u, v, w};
 }
 
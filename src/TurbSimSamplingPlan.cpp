@@ -0,0 +1,123 @@
+/**
+ * @file TurbSimSamplingPlan.cpp
+ * @brief Implementation of TurbSimSamplingPlan.
+ */
+#include "TurbSimSamplingPlan.h"
+#include "BilinearTurbSimInterpolator.h"
+
+#include <limits>
+#include <stdexcept>
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Construction — one stencil per (step, blade, section)
+// ─────────────────────────────────────────────────────────────────────────────
+TurbSimSamplingPlan::TurbSimSamplingPlan(TurbineGeometry const *turbine,
+                                         TurbSimGrid const &grid,
+                                         unsigned first_step,
+                                         std::vector<double> const &azimuths)
+    : first_step_(first_step), num_y_(grid.num_y())
+{
+    if (!turbine)
+        throw std::invalid_argument("TurbSimSamplingPlan: turbine must be non-null");
+    if (static_cast<std::size_t>(grid.num_y()) * grid.num_z() >
+        std::numeric_limits<std::uint32_t>::max())
+        throw std::invalid_argument("TurbSimSamplingPlan: grid too large for 32-bit stencils");
+
+    const std::size_t n_blades = static_cast<std::size_t>(turbine->num_blades());
+    const std::size_t n_sec = turbine->num_sections();
+    if (n_blades == 0 || azimuths.empty() || azimuths.size() % n_blades != 0)
+        throw std::invalid_argument("TurbSimSamplingPlan: azimuth table must hold num_steps x num_blades values");
+
+    num_steps_ = static_cast<unsigned>(azimuths.size() / n_blades);
+    points_per_step_ = n_blades * n_sec;
+
+    const std::size_t total = azimuths.size() * n_sec;
+    corner_.resize(total);
+    ty_.resize(total);
+    tz_.resize(total);
+
+    std::size_t k = 0;
+    for (double psi : azimuths)
+    {
+        // Same positions FlowCalculator would sample at this azimuth.
+        for (WVPMUtilities::Vec3D<double> const &p : turbine->GlobalPositionsAtPsi(psi))
+        {
+            BilinearTurbSimInterpolator::Stencil const st =
+                BilinearTurbSimInterpolator::StencilAt(p.y(), p.z(), grid);
+            corner_[k] = static_cast<std::uint32_t>(st.corner);
+            ty_[k] = st.ty;
+            tz_[k] = st.tz;
+            ++k;
+        }
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Gather — 4-corner gather and multiply-add per planned point
+//
+// Packed fields are blended on the raw int16 samples and decoded once per
+// point: the encoding is affine and the four weights sum to one.
+// ─────────────────────────────────────────────────────────────────────────────
+void TurbSimSamplingPlan::Gather(unsigned step,
+                                 TurbSimVelocityData::TimestepView const &ts,
+                                 double *u,
+                                 double *v,
+                                 double *w) const
+{
+    if (!Covers(step))
+        throw std::out_of_range("TurbSimSamplingPlan: step not planned");
+
+    const std::size_t base = static_cast<std::size_t>(step - first_step_) * points_per_step_;
+    std::uint32_t const *corner = corner_.data() + base;
+    double const *ty = ty_.data() + base;
+    double const *tz = tz_.data() + base;
+    const std::size_t n = points_per_step_;
+    const std::size_t ny = num_y_;
+
+    if (std::int16_t const *s = ts.packed())
+    {
+        TurbSimVelocityData::PackedEncoding const &enc = *ts.encoding();
+        const double hub = enc.hub_velocity;
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const double w_lo_lo = (1.0 - ty[i]) * (1.0 - tz[i]);
+            const double w_hi_lo = ty[i] * (1.0 - tz[i]);
+            const double w_lo_hi = (1.0 - ty[i]) * tz[i];
+            const double w_hi_hi = ty[i] * tz[i];
+
+            std::int16_t const *c00 = s + 3 * static_cast<std::size_t>(corner[i]);
+            std::int16_t const *c10 = c00 + 3;
+            std::int16_t const *c01 = c00 + 3 * ny;
+            std::int16_t const *c11 = c01 + 3;
+
+            double raw[3];
+            for (int k = 0; k < 3; ++k)
+                raw[k] = w_lo_lo * c00[k] + w_hi_lo * c10[k] + w_lo_hi * c01[k] + w_hi_hi * c11[k];
+
+            u[i] = hub * (enc.scale[0] * raw[0] + enc.offset[0]);
+            v[i] = hub * (enc.scale[1] * raw[1] + enc.offset[1]);
+            w[i] = hub * (enc.scale[2] * raw[2] + enc.offset[2]);
+        }
+        return;
+    }
+
+    WVPMUtilities::Vec3D<double> const *g = ts.decoded();
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const double w_lo_lo = (1.0 - ty[i]) * (1.0 - tz[i]);
+        const double w_hi_lo = ty[i] * (1.0 - tz[i]);
+        const double w_lo_hi = (1.0 - ty[i]) * tz[i];
+        const double w_hi_hi = ty[i] * tz[i];
+
+        const std::size_t c = corner[i];
+        auto const &c00 = g[c];
+        auto const &c10 = g[c + 1];
+        auto const &c01 = g[c + ny];
+        auto const &c11 = g[c + ny + 1];
+
+        u[i] = w_lo_lo * c00.x() + w_hi_lo * c10.x() + w_lo_hi * c01.x() + w_hi_hi * c11.x();
+        v[i] = w_lo_lo * c00.y() + w_hi_lo * c10.y() + w_lo_hi * c01.y() + w_hi_hi * c11.y();
+        w[i] = w_lo_lo * c00.z() + w_hi_lo * c10.z() + w_lo_hi * c01.z() + w_hi_hi * c11.z();
+    }
+}
@@ -0,0 +1,131 @@
+/**
+ * @file TurbSimTimestepStream.cpp
+ * @brief Implementation of TurbSimTimestepStream.
+ */
+#include "TurbSimTimestepStream.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Construction / destruction
+// ─────────────────────────────────────────────────────────────────────────────
+TurbSimTimestepStream::TurbSimTimestepStream(std::string const &filename,
+                                             std::uint64_t data_offset,
+                                             std::size_t num_timesteps,
+                                             std::size_t num_points,
+                                             std::size_t capacity,
+                                             std::size_t history)
+    : file_(filename, std::ios::binary),
+      data_offset_(data_offset),
+      num_timesteps_(num_timesteps),
+      num_points_(num_points),
+      capacity_(std::min(capacity, num_timesteps)),
+      history_(history)
+{
+    if (num_timesteps_ == 0 || num_points_ == 0)
+        throw std::invalid_argument("TurbSimTimestepStream: empty wind field");
+    // A window shorter than the file recycles slots; a whole file never does
+    if (capacity_ < num_timesteps_ && capacity_ < history_ + 2)
+        throw std::invalid_argument("TurbSimTimestepStream: capacity must exceed history by at least 2");
+    if (!file_)
+        throw std::runtime_error("TurbSimTimestepStream: cannot open file: " + filename);
+
+    ring_.resize(capacity_ * num_points_ * 3);
+    slot_ts_.assign(capacity_, kEmpty);
+
+    worker_ = std::thread(&TurbSimTimestepStream::Prefetch, this);
+}
+
+TurbSimTimestepStream::~TurbSimTimestepStream()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    advanced_.notify_all();
+    worker_.join();
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Acquire — move the window if needed, then wait for the slot
+// ─────────────────────────────────────────────────────────────────────────────
+std::int16_t const *TurbSimTimestepStream::Acquire(std::size_t ts)
+{
+    if (ts >= num_timesteps_)
+        throw std::out_of_range("TurbSimTimestepStream: timestep index out of range");
+
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    const bool behind = ts < WindowStart();
+    if (behind || ts > head_)
+    {
+        head_ = ts;
+        // Behind the window: reload from there.  Far ahead: skip the gap.
+        if (behind || next_ < WindowStart())
+            next_ = WindowStart();
+        advanced_.notify_one();
+    }
+
+    const std::size_t slot = ts % capacity_;
+    if (slot_ts_[slot] != ts && error_.empty())
+    {
+        ++stalls_;
+        loaded_.wait(lock, [&] { return slot_ts_[slot] == ts || !error_.empty(); });
+    }
+    if (!error_.empty())
+        throw std::runtime_error(error_);
+
+    return Slot(ts);
+}
+
+std::size_t TurbSimTimestepStream::stalls() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stalls_;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Prefetch — background thread: fill the window ahead of the head
+//
+// A slot is reused only for a timestep one capacity further on, which the
+// window admits once the head has moved more than `history` past the old
+// one.  The file is read without holding the lock.
+// ─────────────────────────────────────────────────────────────────────────────
+void TurbSimTimestepStream::Prefetch()
+{
+    const std::size_t step_bytes = num_points_ * 3 * sizeof(std::int16_t);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true)
+    {
+        advanced_.wait(lock, [&]
+                       { return stop_ ||
+                                (next_ < num_timesteps_ && next_ < WindowStart() + capacity_); });
+        if (stop_)
+            return;
+
+        const std::size_t ts = next_++;
+        const std::size_t slot = ts % capacity_;
+        if (slot_ts_[slot] == ts)
+            continue; // still resident after a reposition
+
+        slot_ts_[slot] = kEmpty;
+        std::int16_t *dst = Slot(ts);
+        lock.unlock();
+
+        file_.seekg(static_cast<std::streamoff>(data_offset_ + ts * step_bytes));
+        file_.read(reinterpret_cast<char *>(dst), static_cast<std::streamsize>(step_bytes));
+        const bool ok = static_cast<bool>(file_);
+
+        lock.lock();
+        if (!ok)
+        {
+            error_ = "TurbSimTimestepStream: read failed at timestep " + std::to_string(ts);
+            loaded_.notify_all();
+            return;
+        }
+        slot_ts_[slot] = ts;
+        loaded_.notify_all();
+    }
+}
@@ -11,11 +11,12 @@
  *      so that a single malformed line does not abort the whole file.
  */
 #include "TurbineControlSettingsParser.h"
+#include "TextFileScanner.h"
 
 #include <algorithm>
 #include <cmath>
-#include <fstream>
 #include <iostream>
+#include <memory>
 #include <sstream>
 #include <stdexcept>
 
@@ -60,20 +61,23 @@ std::vector<std::string> splitWS(const std::string& s)
 TurbineControlSettingsData TurbineControlSettingsParser::parse(
     const std::string& file_path) const
 {
-    std::ifstream file(file_path);
-    if (!file.is_open())
+    std::unique_ptr<MappedTextFile> file;
+    try { file = std::make_unique<MappedTextFile>(file_path); }
+    catch (const std::runtime_error&)
+    {
         throw std::runtime_error(
             "TurbineControlSettingsParser: cannot open '" + file_path + "'");
+    }
 
     TurbineControlSettingsData data;
     ControlFeature* activeFeature = nullptr;
-    int line_number = 0;
 
-    std::string line;
-    while (std::getline(file, line))
+    LineScanner lines(file->text());
+    std::string_view line;
+    while (lines.next(line))
     {
-        ++line_number;
-        std::string t = trim(line);
+        const std::size_t line_number = lines.lineNumber();
+        const std::string t(text::trim(line));
         if (t.empty() || isComment(t)) continue;
 
         try
@@ -167,11 +171,8 @@ std::pair<double, std::string> TurbineControlSettingsParser::parseFactorAndUnit(
         return {1.0, raw};
 
     double factor = 1.0;
-    try {
-        factor = std::stod(raw.substr(0, pos));
-    } catch (...) {
+    if (!text::parseDouble(std::string_view(raw).substr(0, pos), factor))
         return {1.0, raw};
-    }
 
     std::string unit = trim(raw.substr(pos));
     return {factor, unit};
@@ -304,11 +305,10 @@ std::vector<double> TurbineControlSettingsParser::parseValues(
     }
 
     // Single value (may be negative, e.g. "-274")
-    try {
-        return {std::stod(t)};
-    } catch (...) {
+    double value;
+    if (!text::parseDouble(t, value))
         throw std::runtime_error("cannot parse value token: '" + t + "'");
-    }
+    return {value};
 }
 
 std::vector<double> TurbineControlSettingsParser::expandRange(
@@ -320,9 +320,9 @@ std::vector<double> TurbineControlSettingsParser::expandRange(
         throw std::runtime_error(
             "range must have exactly 3 ':'-parts, got: '" + inner + "'");
 
-    double start = std::stod(trim(parts[0]));
-    double step  = std::stod(trim(parts[1]));
-    double end   = std::stod(trim(parts[2]));
+    double start = text::toDouble(trim(parts[0]));
+    double step  = text::toDouble(trim(parts[1]));
+    double end   = text::toDouble(trim(parts[2]));
 
     if (std::abs(step) < 1e-15)
         throw std::runtime_error("range step must not be zero");
@@ -349,12 +349,11 @@ std::vector<double> TurbineControlSettingsParser::parseList(
     {
         std::string t = trim(p);
         if (t.empty()) continue;
-        try {
-            result.push_back(std::stod(t));
-        } catch (...) {
+        double value;
+        if (!text::parseDouble(t, value))
             throw std::runtime_error(
                 "cannot parse list element: '" + t + "'");
-        }
+        result.push_back(value);
     }
     return result;
 }
@@ -0,0 +1,142 @@
+#include "bladenoise/airfoil/BoundaryLayerCache.h"
+#include "bladenoise/airfoil/IBoundaryLayerCalculator.h"
+#include "bladenoise/core/Constants.h"
+#include "bladenoise/core/Hash.h"
+#include <algorithm>
+#include <cmath>
+#include <memory>
+
+namespace bladenoise {
+namespace airfoil {
+
+namespace {
+
+std::int64_t quantize(Real value, Real step) {
+    return static_cast<std::int64_t>(std::llround(value / step));
+}
+
+// Dimensional <-> non-dimensional BL state (chord c, freestream U, Re_c)
+BoundaryLayerState to_unit(const BoundaryLayerState& bl, const ProjectConfig& config) {
+    BoundaryLayerState out = bl;
+    out.boundary_layer_thickness /= config.chord;
+    out.displacement_thickness /= config.chord;
+    out.momentum_thickness /= config.chord;
+    out.edge_velocity /= config.freestream_velocity;
+    out.reynolds_theta /= config.reynolds_number();
+    return out;
+}
+
+BoundaryLayerState from_unit(const BoundaryLayerState& bl, const ProjectConfig& config) {
+    BoundaryLayerState out = bl;
+    out.boundary_layer_thickness *= config.chord;
+    out.displacement_thickness *= config.chord;
+    out.momentum_thickness *= config.chord;
+    out.edge_velocity *= config.freestream_velocity;
+    out.reynolds_theta *= config.reynolds_number();
+    return out;
+}
+
+bool has_valid_bins(const BoundaryLayerKey& key, const ProjectConfig& config) {
+    return key.mach_bin > 0 && config.reynolds_number() > 0.0;
+}
+
+}  // namespace
+
+BoundaryLayerCache& BoundaryLayerCache::instance() {
+    static BoundaryLayerCache cache;
+    return cache;
+}
+
+BoundaryLayerKey BoundaryLayerCache::make_key(const io::AirfoilData& airfoil,
+                                              const ProjectConfig& config) {
+    BoundaryLayerKey key;
+
+    const size_t n = std::min({airfoil.num_points, airfoil.x.size(), airfoil.y.size()});
+    Fnv1a h;
+    h.u64(n);
+    h.reals(airfoil.x.data(), n);
+    h.reals(airfoil.y.data(), n);
+    key.airfoil_id = h.value();
+
+    key.method = static_cast<int>(config.bl_method);
+    key.trip = static_cast<int>(config.trip_config);
+
+    const Real re = config.reynolds_number();
+    key.re_bin = re > 0.0 ? quantize(std::log(re), RE_LOG_STEP) : 0;
+    key.mach_bin = quantize(config.mach_number(), MACH_STEP);
+    key.alpha_bin = quantize(config.angle_of_attack, ALPHA_STEP);
+    key.xtr_upper_bin = quantize(config.xtr_upper, XTR_STEP);
+    key.xtr_lower_bin = quantize(config.xtr_lower, XTR_STEP);
+    return key;
+}
+
+ProjectConfig BoundaryLayerCache::bin_centre(const BoundaryLayerKey& key,
+                                             const ProjectConfig& config) {
+    ProjectConfig centre = config;
+    centre.angle_of_attack = static_cast<Real>(key.alpha_bin) * ALPHA_STEP;
+    centre.xtr_upper = static_cast<Real>(key.xtr_upper_bin) * XTR_STEP;
+    centre.xtr_lower = static_cast<Real>(key.xtr_lower_bin) * XTR_STEP;
+
+    // Fixed atmosphere so chord and velocity depend on the key only
+    centre.speed_of_sound = constants::DEFAULT_SPEED_OF_SOUND;
+    centre.kinematic_viscosity = constants::DEFAULT_KINEMATIC_VISCOSITY;
+    centre.freestream_velocity =
+        static_cast<Real>(key.mach_bin) * MACH_STEP * centre.speed_of_sound;
+    centre.chord = std::exp(static_cast<Real>(key.re_bin) * RE_LOG_STEP) *
+                   centre.kinematic_viscosity / centre.freestream_velocity;
+    return centre;
+}
+
+size_t BoundaryLayerCache::KeyHash::operator()(const BoundaryLayerKey& key) const {
+    Fnv1a h;
+    h.u64(key.airfoil_id);
+    h.u64(static_cast<std::uint64_t>(key.method));
+    h.u64(static_cast<std::uint64_t>(key.trip));
+    h.u64(static_cast<std::uint64_t>(key.re_bin));
+    h.u64(static_cast<std::uint64_t>(key.mach_bin));
+    h.u64(static_cast<std::uint64_t>(key.alpha_bin));
+    h.u64(static_cast<std::uint64_t>(key.xtr_upper_bin));
+    h.u64(static_cast<std::uint64_t>(key.xtr_lower_bin));
+    return static_cast<size_t>(h.value());
+}
+
+bool BoundaryLayerCache::get_or_compute(const io::AirfoilData& airfoil,
+                                        const ProjectConfig& config,
+                                        BoundaryLayerState& upper_bl,
+                                        BoundaryLayerState& lower_bl,
+                                        std::string& error) {
+    const BoundaryLayerKey key = make_key(airfoil, config);
+
+    if (!has_valid_bins(key, config)) {
+        auto calculator = create_boundary_layer_calculator(config.bl_method);
+        if (!calculator->calculate(airfoil, config, upper_bl, lower_bl)) {
+            error = calculator->get_error();
+            return false;
+        }
+        return true;
+    }
+
+    // Miss: solve at the bin centre outside the lock.  Threads racing on the
+    // same key compute identical entries, so it does not matter which wins.
+    auto entry = cache_.get_or_compute(key, [&]() -> std::shared_ptr<const Entry> {
+        const ProjectConfig centre = bin_centre(key, config);
+        BoundaryLayerState upper, lower;
+        auto calculator = create_boundary_layer_calculator(centre.bl_method);
+        if (!calculator->calculate(airfoil, centre, upper, lower)) {
+            error = calculator->get_error();
+            return nullptr;
+        }
+        return std::make_shared<const Entry>(
+            Entry{to_unit(upper, centre), to_unit(lower, centre)});
+    });
+    if (!entry) {
+        return false;
+    }
+
+    upper_bl = from_unit(entry->upper, config);
+    lower_bl = from_unit(entry->lower, config);
+    return true;
+}
+
+}  // namespace airfoil
+}  // namespace bladenoise
@@ -1,8 +1,11 @@
 #include "bladenoise/airfoil/XfoilBoundaryLayerCalculator.h"
+#include "bladenoise/core/BoundedCache.h"
 #include "bladenoise/core/Constants.h"
+#include "bladenoise/core/Hash.h"
 #include <cmath>
 #include <algorithm>
 #include <iostream>
+#include <memory>
 #include <numeric>
 #include <Eigen/Dense>
 
@@ -27,6 +30,7 @@ bool XfoilBoundaryLayerCalculator::setup_geometry(const io::AirfoilData& airfoil
 
     x_coords_ = airfoil.x;
     y_coords_ = airfoil.y;
+    basis_.reset();
 
     // Arc-length parametrization
     s_coords_.resize(n_points_);
@@ -82,18 +86,75 @@ static const double GP_W[NGP] = {
     0.22238103445337447, 0.10122853629037626
 };
 
-bool XfoilBoundaryLayerCalculator::solve_inviscid(Real alpha) {
-    alpha_ = alpha * DEG_TO_RAD;
+// ----------------------------------------------------------------------------
+// Alpha-independent part of the vortex-panel problem (XFOIL's GAMU/QINVU idea).
+// The influence matrix and the Kutta row only depend on geometry and the
+// right-hand side is linear in (cos α, sin α), so the vortex strengths and
+// panel tangential velocities for any α are
+//     γ(α) = cos α · γ₀ + sin α · γ₉₀,     q(α) = cos α · q₀ + sin α · q₉₀
+// with the base solutions for a unit freestream at 0° and 90°.
+// ----------------------------------------------------------------------------
+struct XfoilBoundaryLayerCalculator::InviscidBasis {
+    RealVector tx, ty, nx, ny, plen;  // Panel tangents, outward normals, lengths
+    RealVector gamma0, gamma90;       // Node vortex strengths, α = 0° / 90°
+    RealVector q0, q90;               // Panel tangential velocity, α = 0° / 90°
+};
+
+namespace {
+
+// Process-wide store of inviscid bases keyed on the exact node coordinates;
+// entries are immutable and shared read-only by all calculator instances.
+// One entry per section shape, bounded so long sweeps cannot grow it freely.
+struct InviscidBasisKey {
+    RealVector x, y;
+
+    bool operator==(const InviscidBasisKey& other) const = default;
+};
+
+struct InviscidBasisKeyHash {
+    size_t operator()(const InviscidBasisKey& key) const {
+        Fnv1a h;
+        h.u64(key.x.size());
+        h.reals(key.x.data(), key.x.size());
+        h.reals(key.y.data(), key.y.size());
+        return static_cast<size_t>(h.value());
+    }
+};
+
+using InviscidBasisCache = BoundedCache<InviscidBasisKey,
+                                        XfoilBoundaryLayerCalculator::InviscidBasis,
+                                        InviscidBasisKeyHash>;
+
+InviscidBasisCache& inviscid_basis_cache() {
+    static InviscidBasisCache cache(XfoilBoundaryLayerCalculator::INVISCID_BASIS_CAPACITY);
+    return cache;
+}
+
+}  // namespace
+
+bool XfoilBoundaryLayerCalculator::prepare_inviscid_basis() {
+    InviscidBasisKey key{x_coords_, y_coords_};
+    if (auto cached = inviscid_basis_cache().find(key)) {
+        basis_ = cached;
+        return true;
+    }
 
     const int n  = n_points_ - 1;   // panels
     const int N  = n_points_;        // nodes = unknowns
 
+    auto basis = std::make_shared<InviscidBasis>();
+
     // ------------------------------------------------------------------
     // Panel geometry
     // ------------------------------------------------------------------
     std::vector<Real> xm(n), ym(n);
-    std::vector<Real> dxp(n), dyp(n), plen(n);
-    std::vector<Real> tx(n), ty(n), nx(n), ny(n);
+    std::vector<Real> dxp(n), dyp(n);
+    RealVector& plen = basis->plen;
+    RealVector& tx = basis->tx;
+    RealVector& ty = basis->ty;
+    RealVector& nx = basis->nx;
+    RealVector& ny = basis->ny;
+    plen.resize(n); tx.resize(n); ty.resize(n); nx.resize(n); ny.resize(n);
 
     for (int i = 0; i < n; ++i) {
         dxp[i] = x_coords_[i+1] - x_coords_[i];
@@ -133,9 +194,6 @@ bool XfoilBoundaryLayerCalculator::solve_inviscid(Real alpha) {
         }
     }
 
-    Real cos_a = std::cos(alpha_);
-    Real sin_a = std::sin(alpha_);
-
     // ------------------------------------------------------------------
     // Influence matrix  A · γ = b          (size N × N)
     //
@@ -149,13 +207,16 @@ bool XfoilBoundaryLayerCalculator::solve_inviscid(Real alpha) {
     //  kernel for a point vortex at that location, multiply by the
     //  linear basis function, and accumulate the weighted result into
     //  A(i, j) and A(i, j+1).
+    //
+    //  The two right-hand-side columns are V∞ = (1, 0) and (0, 1).
     // ------------------------------------------------------------------
 
     Eigen::MatrixXd A = Eigen::MatrixXd::Zero(N, N);
-    Eigen::VectorXd b = Eigen::VectorXd::Zero(N);
+    Eigen::MatrixXd b = Eigen::MatrixXd::Zero(N, 2);
 
     for (int i = 0; i < n; ++i) {                       // control points
-        b(i) = -(cos_a * nx[i] + sin_a * ny[i]);
+        b(i, 0) = -nx[i];
+        b(i, 1) = -ny[i];
 
         for (int j = 0; j < n; ++j) {                   // source panels
             Real x1j = x_coords_[j], y1j = y_coords_[j];
@@ -191,22 +252,29 @@ bool XfoilBoundaryLayerCalculator::solve_inviscid(Real alpha) {
     A.row(N-1).setZero();
     A(N-1, 0)   = 1.0;
     A(N-1, N-1) = 1.0;
-    b(N-1) = 0.0;
 
-    // Solve
-    Eigen::VectorXd gv = A.colPivHouseholderQr().solve(b);
+    // Factor once, solve both base cases
+    Eigen::MatrixXd gv = A.colPivHouseholderQr().solve(b);
 
-    gamma_.resize(N);
-    for (int i = 0; i < N; ++i) gamma_[i] = gv(i);
+    basis->gamma0.resize(N);
+    basis->gamma90.resize(N);
+    for (int i = 0; i < N; ++i) {
+        basis->gamma0[i]  = gv(i, 0);
+        basis->gamma90[i] = gv(i, 1);
+    }
 
     // ------------------------------------------------------------------
     // Tangential velocity at each panel midpoint
     //   q_i = V∞·t̂_i  +  Σ_j ∫₀¹ γ_j(t)·K_t(panel_j → cp_i) dt
     // ------------------------------------------------------------------
-    std::vector<Real> q_panel(n);
+    const RealVector& g0  = basis->gamma0;
+    const RealVector& g90 = basis->gamma90;
+    basis->q0.resize(n);
+    basis->q90.resize(n);
 
     for (int i = 0; i < n; ++i) {
-        Real qt = cos_a * tx[i] + sin_a * ty[i];   // freestream
+        Real qt0  = tx[i];   // freestream
+        Real qt90 = ty[i];
 
         for (int j = 0; j < n; ++j) {
             Real x1j = x_coords_[j], y1j = y_coords_[j];
@@ -223,15 +291,46 @@ bool XfoilBoundaryLayerCalculator::solve_inviscid(Real alpha) {
                 Real r2 = rx*rx + ry*ry;
                 if (r2 < 1e-20) continue;
 
-                Real gam_local = gamma_[j] * (1.0 - t) + gamma_[j+1] * t;
                 Real fac = wt / (TWO_PI * r2);
                 // tangential component at panel i
-                qt += gam_local * (-ry * tx[i] + rx * ty[i]) * fac;
+                Real kt  = (-ry * tx[i] + rx * ty[i]) * fac;
+                qt0  += (g0[j]  * (1.0 - t) + g0[j+1]  * t) * kt;
+                qt90 += (g90[j] * (1.0 - t) + g90[j+1] * t) * kt;
             }
         }
-        q_panel[i] = qt;
+        basis->q0[i]  = qt0;
+        basis->q90[i] = qt90;
     }
 
+    basis_ = inviscid_basis_cache().insert(key, std::move(basis));
+    return true;
+}
+
+bool XfoilBoundaryLayerCalculator::solve_inviscid(Real alpha) {
+    alpha_ = alpha * DEG_TO_RAD;
+
+    if (!basis_ && !prepare_inviscid_basis()) return false;
+    const InviscidBasis& basis = *basis_;
+
+    const int n  = n_points_ - 1;   // panels
+    const int N  = n_points_;        // nodes = unknowns
+
+    const RealVector& plen = basis.plen;
+    const RealVector& nx = basis.nx;
+    const RealVector& ny = basis.ny;
+
+    Real cos_a = std::cos(alpha_);
+    Real sin_a = std::sin(alpha_);
+
+    // Superpose the base solutions
+    gamma_.resize(N);
+    for (int i = 0; i < N; ++i)
+        gamma_[i] = cos_a * basis.gamma0[i] + sin_a * basis.gamma90[i];
+
+    std::vector<Real> q_panel(n);
+    for (int i = 0; i < n; ++i)
+        q_panel[i] = cos_a * basis.q0[i] + sin_a * basis.q90[i];
+
     // Map to nodes (average of adjacent panels)
     q_inv_.resize(N);
     cp_.resize(N);
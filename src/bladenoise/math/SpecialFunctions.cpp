@@ -1,5 +1,6 @@
 #include "bladenoise/math/SpecialFunctions.h"
 #include "bladenoise/core/Constants.h"
+#include "bladenoise/math/SpectralKernels.h"
 #include <cmath>
 #include <algorithm>
 
@@ -148,18 +149,12 @@ Real MathUtils::to_dB(Real pressure_ratio) {
 }
 
 Real MathUtils::from_dB(Real dB) {
-    return std::pow(10.0, dB / 10.0);
+    return spectral::from_dB(dB);
 }
 
 Real MathUtils::compute_OASPL(const RealVector& spl) {
-    Real total_pressure = 0.0;
-    for (Real s : spl) {
-        if (s > -99.0) {  // Only skip floor values (-100 dB)
-            total_pressure += from_dB(s);
-        }
-    }
-    if (total_pressure <= 0.0) return -100.0;
-    return to_dB(total_pressure);
+    // Only skip floor values (-100 dB)
+    return spectral::energy_sum(spl.data(), spl.size());
 }
 
 Real MathUtils::sign(Real x) {
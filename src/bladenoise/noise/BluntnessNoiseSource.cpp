@@ -1,6 +1,7 @@
 #include "bladenoise/noise/BluntnessNoiseSource.h"
 #include "bladenoise/noise/Directivity.h"
 #include "bladenoise/math/SpecialFunctions.h"
+#include "bladenoise/math/SpectralKernels.h"
 #include "bladenoise/core/Constants.h"
 #include <cmath>
 #include <algorithm>
@@ -12,6 +13,7 @@ namespace bladenoise
 
         using namespace constants;
         using math::MathUtils;
+        namespace spectral = math::spectral;
 
         Real BluntnessNoiseSource::G4_function(Real hdstar, Real psi) const
         {
@@ -37,80 +39,7 @@ namespace bladenoise
             // HDSTAR = h / delta*_avg
             // ETA = log10(St / St_peak) where St = f*h/U
 
-            // Compute MU parameter
-            Real mu;
-            if (hdstar < 0.25)
-            {
-                mu = 0.1211;
-            }
-            else if (hdstar <= 0.62)
-            {
-                mu = -0.2175 * hdstar + 0.1755;
-            }
-            else if (hdstar < 1.15)
-            {
-                mu = -0.0308 * hdstar + 0.0596;
-            }
-            else
-            {
-                mu = 0.0242;
-            }
-
-            // Compute M parameter
-            Real M;
-            if (hdstar <= 0.02)
-            {
-                M = 0.0;
-            }
-            else if (hdstar < 0.5)
-            {
-                M = 68.724 * hdstar - 1.35;
-            }
-            else if (hdstar <= 0.62)
-            {
-                M = 308.475 * hdstar - 121.23;
-            }
-            else if (hdstar <= 1.15)
-            {
-                M = 224.811 * hdstar - 69.354;
-            }
-            else if (hdstar < 1.2)
-            {
-                M = 1583.28 * hdstar - 1631.592;
-            }
-            else
-            {
-                M = 268.344;
-            }
-            M = std::max(M, 0.0);
-
-            // Compute ETA0 (the eta value at the peak)
-            Real eta0 = -std::sqrt((M * M * mu * mu * mu * mu) /
-                                   (6.25 + M * M * mu * mu));
-
-            // Compute K parameter
-            Real K = 2.5 * std::sqrt(1.0 - (eta0 / mu) * (eta0 / mu)) - 2.5 - M * eta0;
-
-            // Compute G5 based on eta range
-            Real G5;
-            if (eta <= eta0)
-            {
-                G5 = M * eta + K;
-            }
-            else if (eta <= 0.0)
-            {
-                G5 = 2.5 * std::sqrt(1.0 - (eta / mu) * (eta / mu)) - 2.5;
-            }
-            else if (eta <= 0.03616)
-            {
-                G5 = std::sqrt(1.5625 - 1194.99 * eta * eta) - 1.25;
-            }
-            else
-            {
-                G5 = -155.543 * eta + 4.375;
-            }
-
-            return G5;
+            return spectral::g5(spectral::g5_shape(hdstar), eta);
         }
 
         bool BluntnessNoiseSource::calculate(
@@ -172,44 +101,37 @@ namespace bladenoise
             Real scale = 10.0 * std::log10(std::pow(mach, 5.5) * h * Dh * span /
                                            (distance * distance));
 
+            // G5 shape coefficients depend only on h/delta*, so they are built
+            // once: at PSI=14 degrees (G514 in Fortran), at PSI=0 degrees (G50,
+            // HDSTARP = 6.724 * HDSTAR**2 - 4.019*HDSTAR + 1.107) and the upper
+            // bound F4TEMP (G5 at hdstar=0.25)
+            const spectral::G5Shape shape14 = spectral::g5_shape(hdstar);
+            const Real hdstarp = 6.724 * hdstar * hdstar - 4.019 * hdstar + 1.107;
+            const spectral::G5Shape shape0 = spectral::g5_shape(hdstarp);
+            const spectral::G5Shape shape_cap = spectral::g5_shape(0.25);
+
+            // ETA = log10(St / St_peak) = log10(f) + log10(h / (U St_peak))
+            RealVector log_freq;
+            spectral::log10_frequencies(frequencies, log_freq);
+            const Real eta_offset = std::log10(h / (velocity * stpeak));
+            const Real level = G4 + scale;
+            const Real *lf = log_freq.data();
+            Real *spl = result.spl.data();
+
+#pragma omp simd
             for (size_t i = 0; i < num_freq; ++i)
             {
-                Real freq = frequencies[i];
-
-                // Strouhal number based on TE thickness (STPPP in Fortran)
-                Real stppp = freq * h / velocity;
+                const Real eta = lf[i] + eta_offset;
+                const Real G514 = spectral::g5(shape14, eta);
+                const Real G50 = spectral::g5(shape0, eta);
 
-                // ETA = log10(St / St_peak)
-                Real eta = std::log10(stppp / stpeak);
-
-                // G5 at PSI=14 degrees (G514 in Fortran)
-                Real hdstarl = hdstar;
-                Real G514 = G5_function(hdstarl, eta);
-
-                // G5 at PSI=0 degrees (G50 in Fortran)
-                // HDSTARP = 6.724 * HDSTAR**2 - 4.019*HDSTAR + 1.107
-                Real hdstarp = 6.724 * hdstar * hdstar - 4.019 * hdstar + 1.107;
-                Real G50 = G5_function(hdstarp, eta);
-
-                // Interpolate G5 based on PSI angle
-                // G5 = G50 + 0.0714 * PSI * (G514 - G50)
+                // Interpolate G5 based on PSI angle, clamp to <= 0 and to F4TEMP
                 Real G5 = G50 + 0.0714 * psi * (G514 - G50);
-
-                // Clamp G5 to be <= 0
-                if (G5 > 0.0)
-                {
-                    G5 = 0.0;
-                }
-
-                // Additional check: G5 cannot exceed F4TEMP (G5 at hdstar=0.25)
-                Real F4TEMP = G5_function(0.25, eta);
-                if (G5 > F4TEMP)
-                {
-                    G5 = F4TEMP;
-                }
+                G5 = std::min(G5, 0.0);
+                G5 = std::min(G5, spectral::g5(shape_cap, eta));
 
                 // Final SPL: SPLBLNT = G4 + G5 + SCALE
-                result.spl[i] = G4 + G5 + scale;
+                spl[i] = G5 + level;
             }
 
             result.overall_spl = MathUtils::compute_OASPL(result.spl);
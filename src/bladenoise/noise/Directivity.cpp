@@ -12,15 +12,31 @@ Real Directivity::high_frequency(Real mach, Real theta, Real phi) {
     Real theta_rad = theta * DEG_TO_RAD;
     Real phi_rad = phi * DEG_TO_RAD;
     
-    // Convective amplification factor
-    Real mc = 0.8 * mach;  // Convection Mach number
+    Real sin_theta = std::sin(theta_rad);
+    Real sin_phi = std::sin(phi_rad);
+    
+    return high_frequency_cos(mach, std::cos(theta_rad),
+                              sin_theta * sin_theta * sin_phi * sin_phi);
+}
+
+Real Directivity::low_frequency(Real mach, Real theta, Real phi) {
+    // Convert angles to radians
+    Real theta_rad = theta * DEG_TO_RAD;
+    Real phi_rad = phi * DEG_TO_RAD;
     
-    Real cos_theta = std::cos(theta_rad);
     Real sin_theta = std::sin(theta_rad);
     Real sin_phi = std::sin(phi_rad);
     
+    return low_frequency_cos(mach, std::cos(theta_rad),
+                             sin_theta * sin_theta * sin_phi * sin_phi);
+}
+
+Real Directivity::high_frequency_cos(Real mach, Real cos_theta, Real sin2_prod) {
+    // Convective amplification factor
+    Real mc = 0.8 * mach;  // Convection Mach number
+    
     // High-frequency directivity (BPM Eq. 1)
-    Real numerator = 2.0 * sin_theta * sin_theta * sin_phi * sin_phi;
+    Real numerator = 2.0 * sin2_prod;
     Real denominator = std::pow(1.0 + mach * cos_theta, 4) * 
                        std::pow(1.0 + (mach - mc) * cos_theta, 2);
     
@@ -32,17 +48,9 @@ Real Directivity::high_frequency(Real mach, Real theta, Real phi) {
     return numerator / denominator;
 }
 
-Real Directivity::low_frequency(Real mach, Real theta, Real phi) {
-    // Convert angles to radians
-    Real theta_rad = theta * DEG_TO_RAD;
-    Real phi_rad = phi * DEG_TO_RAD;
-    
-    Real cos_theta = std::cos(theta_rad);
-    Real sin_theta = std::sin(theta_rad);
-    Real sin_phi = std::sin(phi_rad);
-    
+Real Directivity::low_frequency_cos(Real mach, Real cos_theta, Real sin2_prod) {
     // Low-frequency directivity (BPM Eq. 2)
-    Real numerator = sin_theta * sin_theta * sin_phi * sin_phi;
+    Real numerator = sin2_prod;
     Real denominator = std::pow(1.0 + mach * cos_theta, 4);
     
     // Avoid division by zero
@@ -3,11 +3,14 @@
 #include "bladenoise/noise/TurbulentInflowNoiseSource.h"
 #include "bladenoise/noise/BluntnessNoiseSource.h"
 #include "bladenoise/airfoil/BPMBoundaryLayerCalculator.h"
+#include "bladenoise/airfoil/BoundaryLayerCache.h"
 #include "bladenoise/math/SpecialFunctions.h"
+#include "bladenoise/math/SpectralKernels.h"
 #include "bladenoise/math/Spline.h"
 #include "bladenoise/core/Constants.h"
 #include "bladenoise/core/Types.h"
 #include "bladenoise/potential/PotentialFlowSolver.h"
+#include <algorithm>
 #include <iostream>
 #include <cmath>
 
@@ -18,6 +21,7 @@ namespace bladenoise
 
         using namespace constants;
         using math::MathUtils;
+        namespace spectral = math::spectral;
 
         NoiseCalculator::NoiseCalculator()
         {
@@ -34,26 +38,24 @@ namespace bladenoise
             const size_t num_freq = frequencies_.size();
             total.spl.resize(num_freq, 0.0);
 
-            for (size_t i = 0; i < num_freq; ++i)
+            // Accumulate mean-square pressure source by source so the inner
+            // loop runs over contiguous bands
+            RealVector pressure_sum(num_freq, 0.0);
+            for (const auto &source : sources)
             {
-                Real pressure_sum = 0.0;
-                for (const auto &source : sources)
-                {
-                    if (i < source.spl.size() && source.spl[i] > -100.0)
-                    {
-                        pressure_sum += MathUtils::from_dB(source.spl[i]);
-                    }
-                }
-                if (pressure_sum > 0.0)
-                {
-                    total.spl[i] = MathUtils::to_dB(pressure_sum);
-                }
-                else
+                const size_t n = std::min(num_freq, source.spl.size());
+                const Real *spl = source.spl.data();
+                for (size_t i = 0; i < n; ++i)
                 {
-                    total.spl[i] = -100.0;
+                    pressure_sum[i] += spl[i] > -100.0 ? spectral::from_dB(spl[i]) : 0.0;
                 }
             }
 
+            for (size_t i = 0; i < num_freq; ++i)
+            {
+                total.spl[i] = pressure_sum[i] > 0.0 ? spectral::to_dB(pressure_sum[i]) : -100.0;
+            }
+
             total.overall_spl = MathUtils::compute_OASPL(total.spl);
         }
 
@@ -113,13 +115,14 @@ namespace bladenoise
             results.turbulent_inflow = NoiseResult(num_freq);
             results.total = NoiseResult(num_freq);
 
-            // Create boundary layer calculator
-            auto bl_calculator = airfoil::create_boundary_layer_calculator(config.bl_method);
-
+            // Boundary layer state (BPM or Xfoil), shared across noise sources
+            // and with neighbouring operating points through the BL cache
             BoundaryLayerState upper_bl, lower_bl;
-            if (!bl_calculator->calculate(airfoil, config, upper_bl, lower_bl))
+            std::string bl_error;
+            if (!airfoil::BoundaryLayerCache::instance().get_or_compute(
+                    airfoil, config, upper_bl, lower_bl, bl_error))
             {
-                error_message_ = "Boundary layer calculation failed: " + bl_calculator->get_error();
+                error_message_ = "Boundary layer calculation failed: " + bl_error;
                 return false;
             }
 
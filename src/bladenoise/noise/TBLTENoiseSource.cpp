@@ -1,9 +1,11 @@
 #include "bladenoise/noise/TBLTENoiseSource.h"
 #include "bladenoise/noise/Directivity.h"
 #include "bladenoise/math/SpecialFunctions.h"
+#include "bladenoise/math/SpectralKernels.h"
 #include "bladenoise/core/Constants.h"
 #include <cmath>
 #include <algorithm>
+#include <limits>
 
 namespace bladenoise
 {
@@ -12,90 +14,16 @@ namespace bladenoise
 
         using namespace constants;
         using math::MathUtils;
+        namespace spectral = math::spectral;
 
         //==============================================================================
-        // A_min: Minimum A-curve (corresponds to Fortran AMIN subroutine)
+        // A/B-curve bounds (Fortran AMIN / AMAX / BMIN / BMAX); the branch-free
+        // kernels live in math/SpectralKernels.h and are shared with the band loop
         //==============================================================================
-        Real TBLTENoiseSource::A_min(Real a) const
-        {
-            Real x1 = std::abs(a);
-
-            if (x1 <= 0.204)
-            {
-                return std::sqrt(67.552 - 886.788 * x1 * x1) - 8.219;
-            }
-            else if (x1 <= 0.244)
-            {
-                return -32.665 * x1 + 3.981;
-            }
-            else
-            {
-                return -142.795 * x1 * x1 * x1 + 103.656 * x1 * x1 - 57.757 * x1 + 6.006;
-            }
-        }
-
-        //==============================================================================
-        // A_max: Maximum A-curve (corresponds to Fortran AMAX subroutine)
-        //==============================================================================
-        Real TBLTENoiseSource::A_max(Real a) const
-        {
-            Real x1 = std::abs(a);
-
-            if (x1 <= 0.13)
-            {
-                return std::sqrt(67.552 - 886.788 * x1 * x1) - 8.219;
-            }
-            else if (x1 <= 0.321)
-            {
-                return -15.901 * x1 + 1.098;
-            }
-            else
-            {
-                return -4.669 * x1 * x1 * x1 + 3.491 * x1 * x1 - 16.699 * x1 + 1.149;
-            }
-        }
-
-        //==============================================================================
-        // B_min: Minimum B-curve (corresponds to Fortran BMIN subroutine)
-        //==============================================================================
-        Real TBLTENoiseSource::B_min(Real b) const
-        {
-            Real x1 = std::abs(b);
-
-            if (x1 <= 0.13)
-            {
-                return std::sqrt(16.888 - 886.788 * x1 * x1) - 4.109;
-            }
-            else if (x1 <= 0.145)
-            {
-                return -83.607 * x1 + 8.138;
-            }
-            else
-            {
-                return -817.81 * x1 * x1 * x1 + 355.21 * x1 * x1 - 135.024 * x1 + 10.619;
-            }
-        }
-
-        //==============================================================================
-        // B_max: Maximum B-curve (corresponds to Fortran BMAX subroutine)
-        //==============================================================================
-        Real TBLTENoiseSource::B_max(Real b) const
-        {
-            Real x1 = std::abs(b);
-
-            if (x1 <= 0.1)
-            {
-                return std::sqrt(16.888 - 886.788 * x1 * x1) - 4.109;
-            }
-            else if (x1 <= 0.187)
-            {
-                return -31.313 * x1 + 1.854;
-            }
-            else
-            {
-                return -80.541 * x1 * x1 * x1 + 44.174 * x1 * x1 - 39.381 * x1 + 2.344;
-            }
-        }
+        Real TBLTENoiseSource::A_min(Real a) const { return spectral::a_min(a); }
+        Real TBLTENoiseSource::A_max(Real a) const { return spectral::a_max(a); }
+        Real TBLTENoiseSource::B_min(Real b) const { return spectral::b_min(b); }
+        Real TBLTENoiseSource::B_max(Real b) const { return spectral::b_max(b); }
 
         //==============================================================================
         // compute_A0: Where A-curve takes value of -20 dB (Fortran A0COMP)
@@ -206,30 +134,7 @@ namespace bladenoise
         {
             // G1 function from BPM model for LBL-VS noise spectral shape
             // e = St'/St'_peak ratio parameter
-
-            Real e_abs = std::abs(e);
-
-            if (e_abs <= 0.5974)
-            {
-                return 39.8 * std::log10(e_abs) - 11.12;
-            }
-            else if (e_abs <= 0.8545)
-            {
-                return 98.409 * std::log10(e_abs) + 2.0;
-            }
-            else if (e_abs <= 1.17)
-            {
-                return -5.076 + std::sqrt(2.484 - 506.25 *
-                                                      std::pow(std::log10(e_abs), 2.0));
-            }
-            else if (e_abs <= 1.674)
-            {
-                return -98.409 * std::log10(e_abs) + 2.0;
-            }
-            else
-            {
-                return -39.8 * std::log10(e_abs) - 11.12;
-            }
+            return spectral::g1(std::log10(std::abs(e)));
         }
 
         //==============================================================================
@@ -330,23 +235,15 @@ namespace bladenoise
                                     dstrp * std::pow(mach, 5.0) * Dbarh * span /
                                     (distance * distance));
 
+            // log10(e) = log10(St'/St'_peak) = log10(f) + log10(delta*_p / (U St'_peak))
+            RealVector log_freq;
+            spectral::log10_frequencies(frequencies, log_freq);
+            const Real log_e_offset = std::log10(dstrp / (velocity * St_peak));
+            const Real level = G2 + G3 + scale;
+
             for (size_t i = 0; i < num_freq; ++i)
             {
-                Real freq = frequencies[i];
-
-                // Strouhal number
-                Real Stp = freq * dstrp / velocity;
-
-                // Ratio to peak Strouhal
-                Real e = Stp / St_peak;
-
-                // Spectral shape G1
-                Real G1 = G1_function(e);
-
-                // LBL-VS SPL
-                Real spl_lam = G1 + G2 + G3 + scale;
-
-                lam_result.spl[i] = spl_lam;
+                lam_result.spl[i] = spectral::g1(log_freq[i] + log_e_offset) + level;
             }
 
             lam_result.overall_spl = MathUtils::compute_OASPL(lam_result.spl);
@@ -440,99 +337,87 @@ namespace bladenoise
             Real gamma0 = 23.430 * mach + 4.651;
             Real xcheck = gamma0;
 
-            // For each frequency
-            for (size_t i = 0; i < num_freq; ++i)
-            {
-                Real freq = frequencies[i];
-
-                // Strouhal numbers
-                Real Stp = freq * dstrp / velocity;
-                Real Sts = freq * dstrs / velocity;
+            bool use_switch = (alpha >= xcheck) || (alpha > 12.5);
 
-                // =============================================
-                // Pressure side A-computation
-                // =============================================
-                Real a_p = std::log10(Stp / St1);
-                Real Amin_a = A_min(a_p);
-                Real Amax_a = A_max(a_p);
-                Real AA_p = Amin_a + Ar_A0 * (Amax_a - Amin_a);
+            // Every band-dependent argument below is log10(f) plus a constant,
+            // and every level is a spectral shape plus a constant; both are
+            // hoisted out of the band loops.
+            RealVector log_freq;
+            spectral::log10_frequencies(frequencies, log_freq);
 
-                // Delta K1 correction
-                Real delK1 = compute_delta_K1(Re_dstrp, alpha);
+            const Real m5_over_r2 = std::pow(mach, 5.0) * span / (distance * distance);
+            const Real off_b = std::log10(dstrs / (velocity * St2));   // log10(Sts / St2)
 
-                // Pressure side SPL
-                Real spl_p = AA_p + K1 - 3.0 +
-                             10.0 * std::log10(dstrp * std::pow(mach, 5.0) * Dbarh * span /
-                                               (distance * distance)) +
-                             delK1;
+            Real *spl_p = pressure_side_result.spl.data();
+            Real *spl_s = suction_side_result.spl.data();
+            Real *spl_alpha = separation_result.spl.data();
+            const Real *lf = log_freq.data();
 
-                // =============================================
-                // Suction side computation
-                // =============================================
-                bool use_switch = (alpha >= xcheck) || (alpha > 12.5);
+            if (!use_switch)
+            {
+                const Real off_p = std::log10(dstrp / (velocity * St1));       // log10(Stp / St1)
+                const Real off_s = std::log10(dstrs / (velocity * St1_prime)); // log10(Sts / St1')
 
-                Real spl_s, spl_alpha;
+                // Pressure / suction side levels incl. delta K1 corrections
+                const Real lvl_p = K1 - 3.0 + 10.0 * std::log10(dstrp * Dbarh * m5_over_r2) +
+                                   compute_delta_K1(Re_dstrp, alpha);
+                const Real lvl_s = K1 - 3.0 + 10.0 * std::log10(dstrs * Dbarh * m5_over_r2) +
+                                   compute_delta_K1(Re_dstrs, alpha);
+                const Real lvl_alpha = K2 + 10.0 * std::log10(dstrs * Dbarh * m5_over_r2);
 
-                if (!use_switch)
-                {
-                    // Normal A-computation for suction side
-                    Real a_s = std::log10(Sts / St1_prime);
-                    Real Amin_as = A_min(a_s);
-                    Real Amax_as = A_max(a_s);
-                    Real AA_s = Amin_as + Ar_A0 * (Amax_as - Amin_as);
-
-                    // Delta K1 correction for suction side
-                    Real delK1_s = compute_delta_K1(Re_dstrs, alpha);
-
-                    spl_s = AA_s + K1 - 3.0 +
-                            10.0 * std::log10(dstrs * std::pow(mach, 5.0) * Dbarh * span /
-                                              (distance * distance)) +
-                            delK1_s;
-
-                    // B-curve computation for separation/alpha contribution
-                    Real b = std::abs(std::log10(Sts / St2));
-                    Real Bmin_b = B_min(b);
-                    Real Bmax_b = B_max(b);
-                    Real BB = Bmin_b + Br_B0 * (Bmax_b - Bmin_b);
-
-                    spl_alpha = BB + K2 +
-                                10.0 * std::log10(dstrs * std::pow(mach, 5.0) * Dbarh * span /
-                                                  (distance * distance));
-                }
-                else
+#pragma omp simd
+                for (size_t i = 0; i < num_freq; ++i)
                 {
-                    // SWITCH is TRUE
-                    spl_s = 0.0 + 10.0 * std::log10(dstrs * std::pow(mach, 5.0) * Dbarl * span /
-                                                    (distance * distance));
-                    spl_p = 0.0 + 10.0 * std::log10(dstrs * std::pow(mach, 5.0) * Dbarl * span /
-                                                    (distance * distance));
-
-                    Real b = std::abs(std::log10(Sts / St2));
-                    Real Amin_b = A_min(b);
-                    Real Amax_b = A_max(b);
-                    Real BB = Amin_b + Ar_A02 * (Amax_b - Amin_b);
-
-                    spl_alpha = BB + K2 +
-                                10.0 * std::log10(dstrs * std::pow(mach, 5.0) * Dbarl * span /
-                                                  (distance * distance));
+                    const Real a_p = lf[i] + off_p;
+                    const Real a_s = lf[i] + off_s;
+                    const Real b = std::abs(lf[i] + off_b);
+
+                    const Real Amin_p = spectral::a_min(a_p);
+                    const Real Amin_s = spectral::a_min(a_s);
+                    const Real Bmin_b = spectral::b_min(b);
+                    const Real AA_p = Amin_p + Ar_A0 * (spectral::a_max(a_p) - Amin_p);
+                    const Real AA_s = Amin_s + Ar_A0 * (spectral::a_max(a_s) - Amin_s);
+                    const Real BB = Bmin_b + Br_B0 * (spectral::b_max(b) - Bmin_b);
+
+                    spl_p[i] = std::max(AA_p + lvl_p, -100.0);
+                    spl_s[i] = std::max(AA_s + lvl_s, -100.0);
+                    spl_alpha[i] = std::max(BB + lvl_alpha, -100.0);
                 }
+            }
+            else
+            {
+                // SWITCH is TRUE: pressure and suction side reduce to a flat level
+                const Real lvl_l = 10.0 * std::log10(dstrs * Dbarl * m5_over_r2);
+                const Real flat = std::max(lvl_l, -100.0);
+                const Real lvl_alpha = K2 + lvl_l;
 
-                // Clamp minimum values
-                spl_p = std::max(spl_p, -100.0);
-                spl_s = std::max(spl_s, -100.0);
-                spl_alpha = std::max(spl_alpha, -100.0);
+#pragma omp simd
+                for (size_t i = 0; i < num_freq; ++i)
+                {
+                    const Real b = std::abs(lf[i] + off_b);
+                    const Real Amin_b = spectral::a_min(b);
+                    const Real BB = Amin_b + Ar_A02 * (spectral::a_max(b) - Amin_b);
 
-                // Store individual contributions
-                pressure_side_result.spl[i] = spl_p;
-                suction_side_result.spl[i] = spl_s;
-                separation_result.spl[i] = spl_alpha;
+                    spl_p[i] = flat;
+                    spl_s[i] = flat;
+                    spl_alpha[i] = std::max(BB + lvl_alpha, -100.0);
+                }
+            }
 
-                // Sum contributions on mean-square pressure basis
-                Real P1 = std::pow(10.0, spl_p / 10.0);
-                Real P2 = std::pow(10.0, spl_s / 10.0);
-                Real P4 = std::pow(10.0, spl_alpha / 10.0);
+            // Stalled (switch) levels scale with the low-frequency directivity
+            const Real crossover = use_switch ? std::numeric_limits<Real>::infinity() : 0.0;
+            result.directivity_crossover = crossover;
+            pressure_side_result.directivity_crossover = crossover;
+            suction_side_result.directivity_crossover = crossover;
+            separation_result.directivity_crossover = crossover;
+            laminar_result.directivity_crossover = 0.0;
 
-                result.spl[i] = 10.0 * std::log10(P1 + P2 + P4);
+            // Sum contributions on mean-square pressure basis
+            for (size_t i = 0; i < num_freq; ++i)
+            {
+                result.spl[i] = spectral::to_dB(spectral::from_dB(spl_p[i]) +
+                                                spectral::from_dB(spl_s[i]) +
+                                                spectral::from_dB(spl_alpha[i]));
             }
 
             // =============================================
@@ -547,12 +432,10 @@ namespace bladenoise
                 // Add LBL-VS to total TBL-TE result
                 for (size_t i = 0; i < num_freq; ++i)
                 {
-                    if (laminar_result.spl[i] > -100.0)
-                    {
-                        Real P_total = std::pow(10.0, result.spl[i] / 10.0);
-                        Real P_lam = std::pow(10.0, laminar_result.spl[i] / 10.0);
-                        result.spl[i] = 10.0 * std::log10(P_total + P_lam);
-                    }
+                    const Real lam = laminar_result.spl[i];
+                    const Real sum = spectral::to_dB(spectral::from_dB(result.spl[i]) +
+                                                     spectral::from_dB(lam));
+                    result.spl[i] = lam > -100.0 ? sum : result.spl[i];
                 }
             }
 
@@ -1,7 +1,9 @@
 #include "bladenoise/noise/TurbulentInflowNoiseSource.h"
 #include "bladenoise/noise/Directivity.h"
 #include "bladenoise/math/SpecialFunctions.h"
+#include "bladenoise/math/SpectralKernels.h"
 #include "bladenoise/core/Constants.h"
+#include <algorithm>
 #include <cmath>
 
 namespace bladenoise
@@ -11,6 +13,7 @@ namespace bladenoise
 
         using namespace constants;
         using math::MathUtils;
+        namespace spectral = math::spectral;
 
         TurbulentInflowNoiseSource::TurbulentInflowNoiseSource(TINoiseMethod method)
             : method_(method) {}
@@ -86,6 +89,7 @@ namespace bladenoise
 
             // Cutoff frequency between high & low directivity
             Real Frequency_cutoff = 10.0 * U / (PI * Chord);
+            result.directivity_crossover = Frequency_cutoff;
 
             // Wavenumber of energy-containing eddies
             Real Ke = 3.0 / (4.0 * LTurb);
@@ -107,61 +111,68 @@ namespace bladenoise
             // that the Fortran code uses degrees directly in this formula.
             // ======================================================================
 
+            // Band-independent part of the high-frequency level, 10*log10 of
+            // rho^2 c0^4 L (d/2) / R^2 * M^5 TI^2, plus the AoA correction
+            // (uses DEGREES directly as in Fortran)
+            Real term1 = AirDens * AirDens * std::pow(C0, 4.0) * LTurb * (d / 2.0);
+            Real term2 = RObs * RObs;
+            Real term3 = std::pow(Mach, 5.0) * TINoise * TINoise;
+            const Real level = 10.0 * std::log10(term1 / term2 * term3) + 78.4 +
+                               10.0 * std::log10(1.0 + 9.0 * ALPSTAR * ALPSTAR);
+            const Real dir_low = 10.0 * std::log10(DBARL);
+            const Real dir_high = 10.0 * std::log10(DBARH);
+
+            // Kbar and Khat are proportional to f; Strouhal f*c/U for the
+            // thickness correction is used through its log
+            const Real kbar_per_hz = TWO_PI * Chord / (2.0 * U);
+            const Real khat_per_hz = TWO_PI / (U * Ke);
+            const Real log_khat_offset = std::log10(khat_per_hz);
+            const Real log_st_offset = std::log10(Chord / U);
+
+            // Guidati thickness correction, only for GUIDATI and SIMPLIFIED
+            // methods; the original Amiet/BPM method does NOT include it
+            const bool thickness_corr = method_ == TINoiseMethod::GUIDATI ||
+                                        method_ == TINoiseMethod::SIMPLIFIED;
+            const Real t_avg = (config.thickness_1_percent + config.thickness_10_percent) / 2.0;
+            const Real t_slope = (thickness_corr && t_avg >= 1e-6) ? -20.0 * t_avg : 0.0;
+
+            RealVector log_freq;
+            spectral::log10_frequencies(frequencies, log_freq);
+            const Real *lf = log_freq.data();
+            const Real *fr = frequencies.data();
+            Real *spl_out = result.spl.data();
+
+#pragma omp simd
             for (size_t i = 0; i < num_freq; ++i)
             {
-                Real freq = frequencies[i];
+                const Real freq = fr[i];
 
                 // Select directivity based on frequency
-                Real Directivity_val;
-                if (freq <= Frequency_cutoff)
-                {
-                    Directivity_val = DBARL;
-                }
-                else
-                {
-                    Directivity_val = DBARH;
-                }
-
-                // Wave number
-                Real WaveNumber = TWO_PI * freq / U;
+                const Real dir = freq <= Frequency_cutoff ? dir_low : dir_high;
 
                 // Normalized wavenumbers
-                Real Kbar = WaveNumber * Chord / 2.0;
-                Real Khat = WaveNumber / Ke;
+                const Real Kbar = kbar_per_hz * freq;
+                const Real Khat = khat_per_hz * freq;
 
-                // High-frequency SPL calculation (main Amiet formula from Fortran)
-                Real term1 = AirDens * AirDens * std::pow(C0, 4.0) * LTurb * (d / 2.0);
-                Real term2 = RObs * RObs;
-                Real term3 = std::pow(Mach, 5.0) * TINoise * TINoise;
-                Real term4 = std::pow(Khat, 3.0) * std::pow(1.0 + Khat * Khat, -7.0 / 3.0);
+                // von Karman shape Khat^3 (1 + Khat^2)^(-7/3) in dB
+                const Real shape = 10.0 * (3.0 * (lf[i] + log_khat_offset) -
+                                           (7.0 / 3.0) * std::log10(1.0 + Khat * Khat));
 
-                Real SPLhigh = 10.0 * std::log10(term1 / term2 * term3 * term4 *
-                               Directivity_val) + 78.4;
+                // High-frequency SPL (main Amiet formula from Fortran)
+                const Real SPLhigh = level + dir + shape;
 
-                // Angle of attack correction - uses DEGREES directly as in Fortran
-                SPLhigh = SPLhigh + 10.0 * std::log10(1.0 + 9.0 * ALPSTAR * ALPSTAR);
+                // Sears function approximation and low-frequency correction
+                const Real Sears = 1.0 / (TWO_PI * Kbar / Beta2 +
+                                          1.0 / (1.0 + 2.4 * Kbar / Beta2));
+                const Real LFC = 10.0 * Sears * Mach * Kbar * Kbar / Beta2;
 
-                // Sears function approximation
-                Real Sears = 1.0 / (TWO_PI * Kbar / Beta2 +
-                             1.0 / (1.0 + 2.4 * Kbar / Beta2));
-
-                // Low-frequency correction factor
-                Real LFC = 10.0 * Sears * Mach * Kbar * Kbar / Beta2;
-
-                // Final SPL with low-frequency correction
                 Real spl = SPLhigh + 10.0 * std::log10(LFC / (1.0 + LFC));
 
-                // Apply thickness correction ONLY for Guidati methods
-                // The original Amiet/BPM method does NOT include thickness correction
-                if (method_ == TINoiseMethod::GUIDATI ||
-                    method_ == TINoiseMethod::SIMPLIFIED)
-                {
-                    spl += thickness_correction(freq, Chord, U,
-                                                config.thickness_1_percent,
-                                                config.thickness_10_percent);
-                }
-
-                result.spl[i] = spl;
+                // Thickness correction for Strouhal >= 1
+                const Real log_st = lf[i] + log_st_offset;
+                spl += log_st >= 0.0 ? std::max(t_slope * log_st, -30.0) : 0.0;
+
+                spl_out[i] = spl;
             }
 
             result.overall_spl = MathUtils::compute_OASPL(result.spl);
@@ -0,0 +1,33 @@
+#include "bladenoise/potential/PanelKernelCache.h"
+#include "bladenoise/core/Hash.h"
+
+namespace bladenoise
+{
+    namespace potential
+    {
+
+        PanelKernelKey::PanelKernelKey(const io::AirfoilData &airfoil, int num_panels)
+            : num_panels(num_panels),
+              x(airfoil.x.begin(), airfoil.x.begin() + airfoil.num_points),
+              y(airfoil.y.begin(), airfoil.y.begin() + airfoil.num_points)
+        {
+        }
+
+        size_t PanelKernelKeyHash::operator()(const PanelKernelKey &key) const
+        {
+            Fnv1a h;
+            h.u64(static_cast<std::uint64_t>(key.num_panels));
+            h.u64(key.x.size());
+            h.reals(key.x.data(), key.x.size());
+            h.reals(key.y.data(), key.y.size());
+            return static_cast<size_t>(h.value());
+        }
+
+        PanelKernelCache::Cache &PanelKernelCache::instance()
+        {
+            static Cache cache(CAPACITY);
+            return cache;
+        }
+
+    } // namespace potential
+} // namespace bladenoise
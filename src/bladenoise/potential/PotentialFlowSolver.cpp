@@ -1,6 +1,6 @@
 #include "bladenoise/potential/PotentialFlowSolver.h"
 #include "bladenoise/core/Constants.h"
-#include "bladenoise/math/ODEIntegrator.h"
+#include "bladenoise/math/CashKarpIntegrator.h"
 #include <cmath>
 #include <iostream>
 #include <algorithm>
@@ -29,9 +29,7 @@ namespace bladenoise
             pots_.resize(n_ + 1, 0.0);
             d2pots_.resize(n_ + 1, 0.0);
 
-            Kern_.resize(n_ + 2, n_ + 2);
             rhs_.resize(n_ + 2);
-            ipiv_.resize(n_ + 2);
 
             // Initialize Gaussian quadrature and derivative coefficients
             td_.resize(ng_, RealVector(ng_, 0.0));
@@ -144,22 +142,128 @@ namespace bladenoise
             }
 
             angle_of_attack_ = config.angle_of_attack * DEG_TO_RAD;
-            int m_in = airfoil.num_points;
 
-            // Copy and rotate coordinates around quarter chord
-            RealVector y1in(m_in), y2in(m_in);
-            Real cos_a = std::cos(angle_of_attack_);
-            Real sin_a = std::sin(angle_of_attack_);
+            // Panel splines and the factorized kernel depend on the shape only;
+            // build them once at zero incidence and rotate per operating point.
+            kernel_ = PanelKernelCache::instance().get_or_compute(
+                PanelKernelKey(airfoil, n_),
+                [&] { return build_kernel(airfoil); });
+            if (!kernel_)
+            {
+                return false;
+            }
 
-            for (int i = 0; i < m_in; ++i)
+            apply_incidence(*kernel_, angle_of_attack_);
+
+            geometry_initialized_ = true;
+            solution_computed_ = false;
+
+            return true;
+        }
+
+        std::shared_ptr<const PanelKernel> PotentialFlowSolver::build_kernel(
+            const io::AirfoilData &airfoil)
+        {
+            if (!build_reference_geometry(airfoil))
             {
-                Real x = airfoil.x[i];
-                Real y = airfoil.y[i];
-                // Rotate around quarter chord point (0.25, 0)
-                y1in[i] = (x - 0.25) * cos_a + y * sin_a + 0.25;
-                y2in[i] = -(x - 0.25) * sin_a + y * cos_a;
+                return nullptr;
             }
 
+            Eigen::MatrixXd kern(n_ + 2, n_ + 2);
+            build_influence_matrix(kern);
+
+            auto kernel = std::make_shared<PanelKernel>();
+            kernel->swork = swork_;
+            kernel->yc1 = yc1_;
+            kernel->yc2 = yc2_;
+            kernel->nc1 = nc1_;
+            kernel->nc2 = nc2_;
+            kernel->tc1 = tc1_;
+            kernel->tc2 = tc2_;
+            kernel->d2yc1 = d2yc1_;
+            kernel->d2yc2 = d2yc2_;
+            kernel->ds = ds_;
+
+            kernel->sworkat = sworkat_;
+            kernel->yc1at = yc1at_;
+            kernel->yc2at = yc2at_;
+            kernel->nc1at = nc1at_;
+            kernel->nc2at = nc2at_;
+            kernel->tc1at = tc1at_;
+            kernel->tc2at = tc2at_;
+            kernel->d2yc1at = d2yc1at_;
+            kernel->d2yc2at = d2yc2at_;
+
+            kernel->ywinf1 = ywinf1_;
+            kernel->ywinf2 = ywinf2_;
+            kernel->ywn1 = ywn1_;
+            kernel->ywn2 = ywn2_;
+
+            // Perform LU factorization (like dgetrf in original)
+            kernel->lu.compute(kern);
+
+            return kernel;
+        }
+
+        void PotentialFlowSolver::apply_incidence(const PanelKernel &kernel, Real alpha)
+        {
+            // Rotate the zero-incidence geometry around the quarter chord point
+            // (0.25, 0).  Splines are linear in their data, so rotating node
+            // values and second derivatives equals splining rotated input.
+            const Real cos_a = std::cos(alpha);
+            const Real sin_a = std::sin(alpha);
+
+            auto rotate_point = [cos_a, sin_a](Real x, Real y, Real &xr, Real &yr)
+            {
+                xr = (x - 0.25) * cos_a + y * sin_a + 0.25;
+                yr = -(x - 0.25) * sin_a + y * cos_a;
+            };
+            auto rotate_vector = [cos_a, sin_a](Real x, Real y, Real &xr, Real &yr)
+            {
+                xr = x * cos_a + y * sin_a;
+                yr = -x * sin_a + y * cos_a;
+            };
+
+            swork_ = kernel.swork;
+            ds_ = kernel.ds;
+            for (int i = 0; i <= n_; ++i)
+            {
+                rotate_point(kernel.yc1[i], kernel.yc2[i], yc1_[i], yc2_[i]);
+                rotate_vector(kernel.d2yc1[i], kernel.d2yc2[i], d2yc1_[i], d2yc2_[i]);
+                rotate_vector(kernel.nc1[i], kernel.nc2[i], nc1_[i], nc2_[i]);
+                rotate_vector(kernel.tc1[i], kernel.tc2[i], tc1_[i], tc2_[i]);
+            }
+
+            na_ = static_cast<int>(kernel.sworkat.size()) - 1;
+            sworkat_ = kernel.sworkat;
+            yc1at_.resize(na_ + 1);
+            yc2at_.resize(na_ + 1);
+            nc1at_.resize(na_ + 1);
+            nc2at_.resize(na_ + 1);
+            tc1at_.resize(na_ + 1);
+            tc2at_.resize(na_ + 1);
+            d2yc1at_.resize(na_ + 1);
+            d2yc2at_.resize(na_ + 1);
+            for (int i = 0; i <= na_; ++i)
+            {
+                rotate_point(kernel.yc1at[i], kernel.yc2at[i], yc1at_[i], yc2at_[i]);
+                rotate_vector(kernel.d2yc1at[i], kernel.d2yc2at[i], d2yc1at_[i], d2yc2at_[i]);
+                rotate_vector(kernel.nc1at[i], kernel.nc2at[i], nc1at_[i], nc2at_[i]);
+                rotate_vector(kernel.tc1at[i], kernel.tc2at[i], tc1at_[i], tc2at_[i]);
+            }
+
+            rotate_point(kernel.ywinf1, kernel.ywinf2, ywinf1_, ywinf2_);
+            rotate_vector(kernel.ywn1, kernel.ywn2, ywn1_, ywn2_);
+        }
+
+        bool PotentialFlowSolver::build_reference_geometry(const io::AirfoilData &airfoil)
+        {
+            // DEFGEO at zero incidence — apply_incidence() rotates the result
+            int m_in = airfoil.num_points;
+
+            RealVector y1in(airfoil.x.begin(), airfoil.x.begin() + m_in);
+            RealVector y2in(airfoil.y.begin(), airfoil.y.begin() + m_in);
+
             // Create parameter for input coordinates
             RealVector ssin(m_in);
             for (int i = 0; i < m_in; ++i)
@@ -282,9 +386,6 @@ namespace bladenoise
                 tc2at_[i] = d1y2 / ds_mag;
             }
 
-            geometry_initialized_ = true;
-            solution_computed_ = false;
-
             return true;
         }
 
@@ -508,8 +609,7 @@ namespace bladenoise
                 return false;
             }
 
-            // Build influence coefficient matrix
-            build_influence_matrix();
+            // Influence matrix was factorized once per airfoil in setup_geometry()
 
             // Set up right-hand side (boundary conditions)
             setup_rhs();
@@ -527,7 +627,68 @@ namespace bladenoise
             return true;
         }
 
-        void PotentialFlowSolver::build_influence_matrix()
+        void PotentialFlowSolver::build_panel_quadrature(PanelQuadrature &quad) const
+        {
+            // Far-field part of CDI0, hoisted out of the control point loop:
+            // node positions, normals and Hermite-weighted quadrature weights
+            // only depend on the panel.
+            const Real pi2i = 1.0 / TWO_PI;
+            const int ng = ng_;
+            const int nq = n_ * ng;
+
+            quad.s1.resize(n_);
+            quad.s2.resize(n_);
+            quad.cent1.resize(n_);
+            quad.cent2.resize(n_);
+            quad.len2.resize(n_);
+            for (RealVector *v : {&quad.y1, &quad.y2, &quad.n1, &quad.n2,
+                                  &quad.w1, &quad.w2, &quad.w3, &quad.w4})
+            {
+                v->resize(nq);
+            }
+
+            int khi, klo;
+            Real d1y1, d1y2;
+            for (int j = 0; j < n_; ++j)
+            {
+                // Original: s1 = swork(j) + 0.0000001d0; s2 = swork(j+1) - 0.0000001d0
+                const Real s1 = swork_[j] + 1.0e-7;
+                const Real s2 = swork_[j + 1] - 1.0e-7;
+                quad.s1[j] = s1;
+                quad.s2[j] = s2;
+                quad.len2[j] = (s2 - s1) * (s2 - s1);
+
+                const Real smid = (s1 + s2) / 2.0;
+                spline_search(swork_, n_ + 1, smid, khi, klo);
+                spline_interp(swork_, yc1_, d2yc1_, n_ + 1, smid, quad.cent1[j], d1y1, khi, klo);
+                spline_interp(swork_, yc2_, d2yc2_, n_ + 1, smid, quad.cent2[j], d1y2, khi, klo);
+
+                for (int k = 0; k < ng; ++k)
+                {
+                    const int q = j * ng + k;
+                    const Real sloc = td_[k][ng - 1];
+                    const Real s = (s1 + s2) / 2.0 + sloc * (s2 - s1) / 2.0;
+                    const Real wgtd = Ad_[k][ng - 1] * (s2 - s1) / 2.0 * 0.25 * pi2i;
+
+                    spline_search(swork_, n_ + 1, s, khi, klo);
+                    spline_interp(swork_, yc1_, d2yc1_, n_ + 1, s, quad.y1[q], d1y1, khi, klo);
+                    spline_interp(swork_, yc2_, d2yc2_, n_ + 1, s, quad.y2[q], d1y2, khi, klo);
+
+                    // Original: n1 = d1y2; n2 = -d1y1
+                    quad.n1[q] = d1y2;
+                    quad.n2[q] = -d1y1;
+
+                    const Real sloc2 = sloc * sloc;
+                    const Real sloc3 = sloc2 * sloc;
+                    quad.w1[q] = wgtd * (2.0 - 3.0 * sloc + sloc3);
+                    quad.w2[q] = wgtd * (2.0 + 3.0 * sloc - sloc3);
+                    quad.w3[q] = wgtd * (1.0 - sloc - sloc2 + sloc3);
+                    quad.w4[q] = wgtd * (-1.0 - sloc + sloc2 + sloc3);
+                }
+            }
+        }
+
+        void PotentialFlowSolver::build_influence_matrix(Eigen::MatrixXd &kern)
         {
             // SETMAT - Build the influence coefficient matrix for the panel method
 
@@ -537,119 +698,178 @@ namespace bladenoise
             Real solidangle = 1.0 - 0.5 * (2.0 * rhelp / TWO_PI);
 
             // Initialize matrix to zero
-            Kern_.setZero();
+            kern.setZero();
+
+            // Quadrature nodes are the same for every control point; interpolate
+            // them once instead of once per (control point, panel) pair.
+            PanelQuadrature quad;
+            build_panel_quadrature(quad);
 
-            // Build influence coefficients for each control point
+            const int ng = ng_;
+            const int nq = n_ * ng;
+
+            // Build influence coefficients for each control point.  Rows are
+            // independent; each thread owns its scratch buffers and writes only
+            // to its own row of kern.
             // Original: do i=1,N (1-based), C++: 0 to n_-1 (0-based)
-            for (int i = 0; i < n_; ++i)
+#ifdef _OPENMP
+#pragma omp parallel if (n_ >= 64)
+#endif
             {
-                Real x1 = yc1_[i];
-                Real x2 = yc2_[i];
+                RealVector green(nq);
+                RealVector herm1(n_), herm2(n_), herm3(n_), herm4(n_);
 
-                // Diagonal element (self-influence)
-                // Original: Kern(i,i) = 0.5d0; if(i.eq.1) Kern(i,i) = solidangle
-                Kern_(i, i) = 0.5;
-                if (i == 0)
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+                for (int i = 0; i < n_; ++i)
                 {
-                    Kern_(i, i) = solidangle;
-                }
+                    const Real x1 = yc1_[i];
+                    const Real x2 = yc2_[i];
+
+                    // Far-field dipole kernel at every Gauss node of every panel.
+                    // Nodes of near-field panels are evaluated too and ignored
+                    // below; keeping the loop branch-free lets it vectorize.
+                    const Real *qy1 = quad.y1.data();
+                    const Real *qy2 = quad.y2.data();
+                    const Real *qn1 = quad.n1.data();
+                    const Real *qn2 = quad.n2.data();
+                    Real *g = green.data();
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+                    for (int q = 0; q < nq; ++q)
+                    {
+                        const Real d1 = x1 - qy1[q];
+                        const Real d2 = x2 - qy2[q];
+                        g[q] = (qn1[q] * d1 + qn2[q] * d2) / (d1 * d1 + d2 * d2);
+                    }
 
-                // Influence from each panel
-                for (int j = 0; j < n_; ++j)
-                {
-                    // Original: s1 = swork(j) + 0.0000001d0; s2 = swork(j+1) - 0.0000001d0
-                    Real s1 = swork_[j] + 1.0e-7;
-                    Real s2 = swork_[j + 1] - 1.0e-7;
+                    for (int j = 0; j < n_; ++j)
+                    {
+                        // Original: raver = ((x1-y1cent)**2 + (x2-y2cent)**2) / ((s2-s1)**2)
+                        const Real dc1 = x1 - quad.cent1[j];
+                        const Real dc2 = x2 - quad.cent2[j];
+                        const Real raver = (dc1 * dc1 + dc2 * dc2) / quad.len2[j];
+
+                        if (raver > 2.0)
+                        {
+                            Real h1 = 0.0, h2 = 0.0, h3 = 0.0, h4 = 0.0;
+                            for (int q = j * ng; q < (j + 1) * ng; ++q)
+                            {
+                                h1 += quad.w1[q] * g[q];
+                                h2 += quad.w2[q] * g[q];
+                                h3 += quad.w3[q] * g[q];
+                                h4 += quad.w4[q] * g[q];
+                            }
+                            herm1[j] = h1;
+                            herm2[j] = h2;
+                            herm3[j] = h3;
+                            herm4[j] = h4;
+                        }
+                        else
+                        {
+                            // Near-singular: adaptive integration stays scalar
+                            compute_panel_influence(x1, x2, quad.s1[j], quad.s2[j],
+                                                    herm1[j], herm2[j], herm3[j], herm4[j]);
+                        }
+                    }
 
-                    Real herm1, herm2, herm3, herm4;
-                    compute_panel_influence(x1, x2, s1, s2, herm1, herm2, herm3, herm4);
+                    // Diagonal element (self-influence)
+                    // Original: Kern(i,i) = 0.5d0; if(i.eq.1) Kern(i,i) = solidangle
+                    kern(i, i) = 0.5;
+                    if (i == 0)
+                    {
+                        kern(i, i) = solidangle;
+                    }
 
-                    // Add contributions to influence matrix
-                    // Original: do jshift=0,1
-                    for (int jshift = 0; jshift <= 1; ++jshift)
+                    // Influence from each panel
+                    for (int j = 0; j < n_; ++j)
                     {
-                        // Original: Kern(i,j+jshift) = Kern(i,j+jshift) - HERM(i,j,jshift+1)
-                        // HERM(i,j,1) = herm1, HERM(i,j,2) = herm2
-                        Real herm_val = (jshift == 0) ? herm1 : herm2;
-                        Kern_(i, j + jshift) -= herm_val;
-
-                        // Derivative contributions using finite difference stencil
-                        // Original ishift logic (converting from 1-based to 0-based):
-                        // if(j+jshift.eq.1) ishift=2  -> if(j+jshift==0) ishift=2
-                        // if(j+jshift.eq.2) ishift=1  -> if(j+jshift==1) ishift=1
-                        // if(j+jshift.eq.n) ishift=-1 -> if(j+jshift==n_-1) ishift=-1
-                        // if(j+jshift.eq.n+1) ishift=-2 -> if(j+jshift==n_) ishift=-2
-                        int ishift = 0;
-                        if (j + jshift == 0)
-                            ishift = 2;
-                        else if (j + jshift == 1)
-                            ishift = 1;
-                        else if (j + jshift == n_ - 1)
-                            ishift = -1;
-                        else if (j + jshift == n_)
-                            ishift = -2;
-
-                        // Original: HERM(i,j,jshift+3) means herm3 when jshift=0, herm4 when jshift=1
-                        Real herm_deriv = (jshift == 0) ? herm3 : herm4;
-
-                        // Original stencil application:
-                        // Kern(i,j-2+ishift+jshift) -= dst(-2,ishift)*HERM(i,j,jshift+3)*.5
-                        // Kern(i,j-1+ishift+jshift) -= dst(-1,ishift)*HERM(i,j,jshift+3)*.5
-                        // Kern(i,j  +ishift+jshift) -= dst( 0,ishift)*HERM(i,j,jshift+3)*.5
-                        // Kern(i,j+1+ishift+jshift) -= dst( 1,ishift)*HERM(i,j,jshift+3)*.5
-                        // Kern(i,j+2+ishift+jshift) -= dst( 2,ishift)*HERM(i,j,jshift+3)*.5
-                        //
-                        // dst is indexed as dst(stencil_offset, boundary_type) where:
-                        // stencil_offset: -2,-1,0,1,2 -> in C++ with offset: 0,1,2,3,4
-                        // boundary_type: ishift (-2,-1,0,1,2) -> in C++ with offset: 0,1,2,3,4
-                        for (int kk = -2; kk <= 2; ++kk)
+                        // Add contributions to influence matrix
+                        // Original: do jshift=0,1
+                        for (int jshift = 0; jshift <= 1; ++jshift)
                         {
-                            int col_idx = j + kk + ishift + jshift;
-                            if (col_idx >= 0 && col_idx <= n_)
+                            // Original: Kern(i,j+jshift) = Kern(i,j+jshift) - HERM(i,j,jshift+1)
+                            // HERM(i,j,1) = herm1, HERM(i,j,2) = herm2
+                            Real herm_val = (jshift == 0) ? herm1[j] : herm2[j];
+                            kern(i, j + jshift) -= herm_val;
+
+                            // Derivative contributions using finite difference stencil
+                            // Original ishift logic (converting from 1-based to 0-based):
+                            // if(j+jshift.eq.1) ishift=2  -> if(j+jshift==0) ishift=2
+                            // if(j+jshift.eq.2) ishift=1  -> if(j+jshift==1) ishift=1
+                            // if(j+jshift.eq.n) ishift=-1 -> if(j+jshift==n_-1) ishift=-1
+                            // if(j+jshift.eq.n+1) ishift=-2 -> if(j+jshift==n_) ishift=-2
+                            int ishift = 0;
+                            if (j + jshift == 0)
+                                ishift = 2;
+                            else if (j + jshift == 1)
+                                ishift = 1;
+                            else if (j + jshift == n_ - 1)
+                                ishift = -1;
+                            else if (j + jshift == n_)
+                                ishift = -2;
+
+                            // Original: HERM(i,j,jshift+3) means herm3 when jshift=0, herm4 when jshift=1
+                            Real herm_deriv = (jshift == 0) ? herm3[j] : herm4[j];
+
+                            // Original stencil application:
+                            // Kern(i,j-2+ishift+jshift) -= dst(-2,ishift)*HERM(i,j,jshift+3)*.5
+                            // Kern(i,j-1+ishift+jshift) -= dst(-1,ishift)*HERM(i,j,jshift+3)*.5
+                            // Kern(i,j  +ishift+jshift) -= dst( 0,ishift)*HERM(i,j,jshift+3)*.5
+                            // Kern(i,j+1+ishift+jshift) -= dst( 1,ishift)*HERM(i,j,jshift+3)*.5
+                            // Kern(i,j+2+ishift+jshift) -= dst( 2,ishift)*HERM(i,j,jshift+3)*.5
+                            //
+                            // dst is indexed as dst(stencil_offset, boundary_type) where:
+                            // stencil_offset: -2,-1,0,1,2 -> in C++ with offset: 0,1,2,3,4
+                            // boundary_type: ishift (-2,-1,0,1,2) -> in C++ with offset: 0,1,2,3,4
+                            for (int kk = -2; kk <= 2; ++kk)
                             {
-                                // dst_[kk+2][ishift+2] maps (-2..2, -2..2) to (0..4, 0..4)
-                                Kern_(i, col_idx) -= dst_[kk + 2][ishift + 2] * herm_deriv * 0.5;
+                                int col_idx = j + kk + ishift + jshift;
+                                if (col_idx >= 0 && col_idx <= n_)
+                                {
+                                    // dst_[kk+2][ishift+2] maps (-2..2, -2..2) to (0..4, 0..4)
+                                    kern(i, col_idx) -= dst_[kk + 2][ishift + 2] * herm_deriv * 0.5;
+                                }
                             }
                         }
                     }
-                }
 
-                // Wake contribution
-                // Original: call calll(x1,x2,yc1(1),yc2(1),ywinf1,ywinf2,ywn1,ywn2,dipok,...)
-                // Original: Kern(i,n+2) = -dipok
-                Real dipok, v1, v2, dv1d1, dv1d2, dv2d1, dv2d2;
-                compute_wake_contribution(x1, x2, yc1_[0], yc2_[0], ywinf1_, ywinf2_,
-                                          ywn1_, ywn2_, dipok, v1, v2, dv1d1, dv1d2, dv2d1, dv2d2);
-                Kern_(i, n_ + 1) = -dipok; // n+2 in 1-based = n_+1 in 0-based
+                    // Wake contribution
+                    // Original: call calll(x1,x2,yc1(1),yc2(1),ywinf1,ywinf2,ywn1,ywn2,dipok,...)
+                    // Original: Kern(i,n+2) = -dipok
+                    Real dipok, v1, v2, dv1d1, dv1d2, dv2d1, dv2d2;
+                    compute_wake_contribution(x1, x2, yc1_[0], yc2_[0], ywinf1_, ywinf2_,
+                                              ywn1_, ywn2_, dipok, v1, v2, dv1d1, dv1d2, dv2d1, dv2d2);
+                    kern(i, n_ + 1) = -dipok; // n+2 in 1-based = n_+1 in 0-based
+                }
             }
 
             // Kutta condition: velocity matching at trailing edge
             // Original uses the else branch (if(.false.) is never true):
-            // Kern(n+1,1)   =  2.0    -> Kern_(n_, 0) = 2.0
-            // Kern(n+1,2)   = -3.0    -> Kern_(n_, 1) = -3.0
-            // Kern(n+1,3)   =  1.0    -> Kern_(n_, 2) = 1.0
-            // Kern(n+1,n+1) = -2.0    -> Kern_(n_, n_) = -2.0
-            // Kern(n+1,n)   =  3.0    -> Kern_(n_, n_-1) = 3.0
-            // Kern(n+1,n-1) = -1.0    -> Kern_(n_, n_-2) = -1.0
-            Kern_(n_, 0) = 2.0;
-            Kern_(n_, 1) = -3.0;
-            Kern_(n_, 2) = 1.0;
-            Kern_(n_, n_) = -2.0;
-            Kern_(n_, n_ - 1) = 3.0;
-            Kern_(n_, n_ - 2) = -1.0;
+            // Kern(n+1,1)   =  2.0    -> kern(n_, 0) = 2.0
+            // Kern(n+1,2)   = -3.0    -> kern(n_, 1) = -3.0
+            // Kern(n+1,3)   =  1.0    -> kern(n_, 2) = 1.0
+            // Kern(n+1,n+1) = -2.0    -> kern(n_, n_) = -2.0
+            // Kern(n+1,n)   =  3.0    -> kern(n_, n_-1) = 3.0
+            // Kern(n+1,n-1) = -1.0    -> kern(n_, n_-2) = -1.0
+            kern(n_, 0) = 2.0;
+            kern(n_, 1) = -3.0;
+            kern(n_, 2) = 1.0;
+            kern(n_, n_) = -2.0;
+            kern(n_, n_ - 1) = 3.0;
+            kern(n_, n_ - 2) = -1.0;
 
             // Circulation equation
             // Original: Kern(n+2,1) = 1.0; Kern(n+2,n+1) = -1.0; Kern(n+2,n+2) = -1.0
-            Kern_(n_ + 1, 0) = 1.0;
-            Kern_(n_ + 1, n_) = -1.0;
-            Kern_(n_ + 1, n_ + 1) = -1.0;
+            kern(n_ + 1, 0) = 1.0;
+            kern(n_ + 1, n_) = -1.0;
+            kern(n_ + 1, n_ + 1) = -1.0;
 
             // Modification for solid angle at TE
             // Original: Kern(1,n+2) = -solidangle/2.0
-            Kern_(0, n_ + 1) = -solidangle / 2.0;
-
-            // Perform LU factorization (like dgetrf in original)
-            lu_solver_ = std::make_unique<Eigen::PartialPivLU<Eigen::MatrixXd>>(Kern_);
+            kern(0, n_ + 1) = -solidangle / 2.0;
         }
 
         void PotentialFlowSolver::compute_panel_influence(Real x1, Real x2, Real s1, Real s2,
@@ -729,16 +949,15 @@ namespace bladenoise
 
                 const Real eps = 1.0e-6;
                 const Real h1 = 0.1;
-                const Real hmin = 0.0;
 
                 // Initial values (small non-zero to avoid issues)
-                RealVector ystart = {1.0e-6, 1.0e-6, 1.0e-6, 1.0e-6};
-                int nvar = 4;
-                int nok, nbad;
+                using Integrator = math::CashKarpIntegrator<4>;
+                Integrator::State ystart = {1.0e-6, 1.0e-6, 1.0e-6, 1.0e-6};
 
                 // Create derivative function (CDI0_f) as a lambda
                 // Captures x1, x2, s1, s2 and solver reference for spline access
-                auto cdi0_f = [this, x1, x2, s1, s2, pi2i](Real s, const RealVector &y, RealVector &dydx)
+                auto cdi0_f = [this, x1, x2, s1, s2, pi2i](Real s, const Integrator::State &y,
+                                                           Integrator::State &dydx)
                 {
                     (void)y; // y is not used in CDI0_f
 
@@ -771,9 +990,9 @@ namespace bladenoise
                     dydx[3] = green * 0.25 * (-1.0 - sloc + sloc2 + sloc3);
                 };
 
-                // Integrate using adaptive Runge-Kutta
-                math::ODEIntegrator integrator;
-                integrator.odeint(ystart, nvar, s1, s2, eps, h1, hmin, nok, nbad, cdi0_f);
+                // Integrate using adaptive Runge-Kutta (fixed-size, no allocation)
+                Integrator integrator;
+                integrator.integrate(ystart, s1, s2, eps, h1, cdi0_f);
 
                 // Extract results (subtract initial small values)
                 herm1 = ystart[0] - 1.0e-6;
@@ -788,7 +1007,7 @@ namespace bladenoise
                                                             Real n1, Real n2,
                                                             Real &dipok, Real &v1, Real &v2,
                                                             Real &dv1d1, Real &dv1d2,
-                                                            Real &dv2d1, Real &dv2d2)
+                                                            Real &dv2d1, Real &dv2d2) const
         {
             // calll - Calculate wake contribution to potential and velocity
             const Real small = 1.0e-12;
@@ -864,14 +1083,14 @@ namespace bladenoise
             // SOLSEQ - Solve the linear system using pre-factored LU decomposition
             // This matches the original: call dgetrs('N', n+2, 1, Kern, n+2, ipiv, rhs, n+2, info)
 
-            if (!lu_solver_)
+            if (!kernel_)
             {
                 error_message_ = "LU factorization not performed";
                 return false;
             }
 
             // Solve using pre-factored LU (like dgetrs)
-            rhs_ = lu_solver_->solve(rhs_);
+            rhs_ = kernel_->lu.solve(rhs_);
 
             // Extract surface potential distribution
             // Original: do i=1,n+1; pots(i) = rhs(i); enddo
@@ -971,25 +1190,7 @@ namespace bladenoise
             }
 
             // Find stagnation point
-            Real tang_old = 0.0;
-            Real s_stag = 0.0;
-
-            for (int j = 1; j <= 10000; ++j)
-            {
-                Real s = static_cast<Real>(n_) * (0.25 + 0.5 * static_cast<Real>(j) / 10000.0);
-                int khi, klo;
-                Real ppp, tang;
-
-                spline_search(swork_, n_ + 1, s, khi, klo);
-                spline_interp(swork_, pots_, d2pots_, n_ + 1, s, ppp, tang, khi, klo);
-
-                if (tang * tang_old < 0.0)
-                {
-                    s_stag = s;
-                    break;
-                }
-                tang_old = tang;
-            }
+            Real s_stag = find_stagnation_point();
 
             // Get stagnation point coordinates
             int khi, klo;
@@ -1001,6 +1202,10 @@ namespace bladenoise
             streamlines.stagnation_x = xstau1;
             streamlines.stagnation_y = xstau2;
 
+            // Panel midpoint data is the same for every streamline step
+            StreamlinePanels panels;
+            build_streamline_panels(panels);
+
             // Trace back to find starting position upstream
             RealVector str1(nstr_), str2(nstr_), ps(nstr_);
 
@@ -1008,7 +1213,7 @@ namespace bladenoise
             str1[0] = xstau1 + d1y2 * 0.005 / ds_mag; // Start slightly above surface
             str2[0] = xstau2 - d1y1 * 0.005 / ds_mag;
 
-            integrate_streamline(-0.0025, str1, str2, ps);
+            integrate_streamline(-0.0025, panels, str1, str2, ps);
 
             // Find where streamline crosses starting x-position
             Real xsta1 = -0.5; // Starting x upstream
@@ -1023,7 +1228,9 @@ namespace bladenoise
             }
             Real xsta2 = str2[ii] + (str2[ii + 1] - str2[ii]) * (xsta1 - str1[ii]) / (str1[ii + 1] - str1[ii]);
 
-            // Compute each streamline
+            // Compute each streamline.  Streamlines are independent and are
+            // integrated in place into their own rows, so they run in parallel.
+            #pragma omp parallel for schedule(dynamic, 1)
             for (int ipath = 0; ipath < npath; ++ipath)
             {
                 // Initial position with vertical offset
@@ -1033,26 +1240,95 @@ namespace bladenoise
                 streamlines.y[ipath][0] = xsta2 + y_offset;
 
                 // Integrate streamline forward
-                RealVector path_x(nstr_), path_y(nstr_), path_pot(nstr_);
-                path_x[0] = streamlines.x[ipath][0];
-                path_y[0] = streamlines.y[ipath][0];
+                integrate_streamline(deltat, panels, streamlines.x[ipath],
+                                     streamlines.y[ipath], streamlines.potential[ipath]);
+            }
 
-                integrate_streamline(deltat, path_x, path_y, path_pot);
+            //TODO: debug output: std::cout << "  Computed " << npath << " streamlines with " << nstr_ << " points each" << std::endl;
+        }
+
+        Real PotentialFlowSolver::find_stagnation_point() const
+        {
+            // First sign change of the surface velocity dphi/ds on
+            // s in (0.25 n, 0.75 n): coarse scan for the bracket, then
+            // bisection to round-off.
+            constexpr int NUM_SCAN = 500;
+            constexpr int MAX_BISECT = 60;
+
+            auto tangential = [this](Real s)
+            {
+                int khi, klo;
+                Real ppp, tang;
+                spline_search(swork_, n_ + 1, s, khi, klo);
+                spline_interp(swork_, pots_, d2pots_, n_ + 1, s, ppp, tang, khi, klo);
+                return tang;
+            };
 
-                // Copy results
-                for (int istr = 0; istr < nstr_; ++istr)
+            const Real s_lo = 0.25 * static_cast<Real>(n_);
+            const Real ds = 0.5 * static_cast<Real>(n_) / NUM_SCAN;
+
+            Real a = s_lo + ds;
+            Real fa = tangential(a);
+            for (int j = 2; j <= NUM_SCAN; ++j)
+            {
+                Real b = s_lo + static_cast<Real>(j) * ds;
+                Real fb = tangential(b);
+
+                if (fa * fb < 0.0)
                 {
-                    streamlines.x[ipath][istr] = path_x[istr];
-                    streamlines.y[ipath][istr] = path_y[istr];
-                    streamlines.potential[ipath][istr] = path_pot[istr];
+                    for (int it = 0; it < MAX_BISECT; ++it)
+                    {
+                        Real m = 0.5 * (a + b);
+                        if (m <= a || m >= b)
+                            break;
+                        Real fm = tangential(m);
+                        if (fa * fm <= 0.0)
+                        {
+                            b = m;
+                        }
+                        else
+                        {
+                            a = m;
+                            fa = fm;
+                        }
+                    }
+                    return 0.5 * (a + b);
                 }
+                a = b;
+                fa = fb;
             }
+            return 0.0;
+        }
 
-            //TODO: debug output: std::cout << "  Computed " << npath << " streamlines with " << nstr_ << " points each" << std::endl;
+        void PotentialFlowSolver::build_streamline_panels(StreamlinePanels &panels) const
+        {
+            panels.y1.resize(n_);
+            panels.y2.resize(n_);
+            panels.n1.resize(n_);
+            panels.n2.resize(n_);
+            panels.pot.resize(n_);
+            panels.ds.resize(n_);
+
+            for (int j = 0; j < n_; ++j)
+            {
+                Real s = (swork_[j] + swork_[j + 1]) / 2.0;
+                int khi, klo;
+                Real d1y1, d1y2, dpot;
+
+                spline_search(swork_, n_ + 1, s, khi, klo);
+                spline_interp(swork_, yc1_, d2yc1_, n_ + 1, s, panels.y1[j], d1y1, khi, klo);
+                spline_interp(swork_, yc2_, d2yc2_, n_ + 1, s, panels.y2[j], d1y2, khi, klo);
+                spline_interp(swork_, pots_, d2pots_, n_ + 1, s, panels.pot[j], dpot, khi, klo);
+
+                panels.n1[j] = d1y2;
+                panels.n2[j] = -d1y1;
+                panels.ds[j] = swork_[j + 1] - swork_[j];
+            }
         }
 
-        void PotentialFlowSolver::integrate_streamline(Real dt, RealVector &str1, RealVector &str2,
-                                                       RealVector &ps)
+        void PotentialFlowSolver::integrate_streamline(Real dt, const StreamlinePanels &panels,
+                                                       RealVector &str1, RealVector &str2,
+                                                       RealVector &ps) const
         {
             // STREAM - Integrate streamline using velocity field from panel solution
 
@@ -1071,26 +1347,18 @@ namespace bladenoise
                 // Contribution from surface panels
                 for (int j = 0; j < n_; ++j)
                 {
-                    Real s = (swork_[j] + swork_[j + 1]) / 2.0;
-                    int khi, klo;
-                    Real y1, y2, d1y1, d1y2, pot_val, dpot;
-
-                    spline_search(swork_, n_ + 1, s, khi, klo);
-                    spline_interp(swork_, yc1_, d2yc1_, n_ + 1, s, y1, d1y1, khi, klo);
-                    spline_interp(swork_, yc2_, d2yc2_, n_ + 1, s, y2, d1y2, khi, klo);
-                    spline_interp(swork_, pots_, d2pots_, n_ + 1, s, pot_val, dpot, khi, klo);
-
-                    Real n1 = d1y2;
-                    Real n2 = -d1y1;
-                    Real d1 = x1 - y1;
-                    Real d2 = x2 - y2;
+                    Real n1 = panels.n1[j];
+                    Real n2 = panels.n2[j];
+                    Real pot_val = panels.pot[j];
+                    Real d1 = x1 - panels.y1[j];
+                    Real d2 = x2 - panels.y2[j];
                     Real r2 = d1 * d1 + d2 * d2;
 
                     if (r2 < 1e-10)
                         continue;
 
                     // Dipole contribution
-                    Real ds_panel = swork_[j + 1] - swork_[j];
+                    Real ds_panel = panels.ds[j];
                     phif0 += (n1 * d1 + n2 * d2) / r2 * pot_val * pi2i * ds_panel;
                     v1 += (n1 * (d2 * d2 - d1 * d1) - 2.0 * n2 * d2 * d1) / (r2 * r2) * pot_val * pi2i * ds_panel;
                     v2 += (n2 * (d1 * d1 - d2 * d2) - 2.0 * n1 * d2 * d1) / (r2 * r2) * pot_val * pi2i * ds_panel;
@@ -1,21 +1,27 @@
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <filesystem>
 #include <iostream>
 #include <memory>
 #include <cmath>
 #include <iomanip>
+#include <limits>
 #include <numbers>
 #include <optional>
 #include <sstream>
+#include <string_view>
 #include <vector>
 
 #include "ConfigurationSchema.h"
 #include "FileReader.h"
 #include "ConfigurationParser.h"
+#include "ProjectSnapshot.h"
 #include "TurbineGeometry.h"
 
 // ── Simulation layer ──────────────────────────────────────────────────────────
 #include "ConfigurationAdapter.h"
+#include "AzimuthInflowCache.h"
 #include "FlowCalculatorFactory.h"
 #include "NingSolverFactory.h"
 #include "VariableSpeedController.h"
@@ -33,12 +39,23 @@
 #include "ISimulationResultsExporter.h"
 #include "TecplotSimulationExporter.h"
 #include "RotormapSolver.h"
+#include "CheckpointJournal.h"
+#include "TimeDomainSolver.h"
+#include "TurbSimManagerFactory.h"
+#include "TecplotTimeSeriesWriter.h"
 #include "SectionNoiseCalculator.h"
 #include "BEMSectionNoiseAdapter.h"
+#include "SectionNoiseGeometry.h"
 #include "BladeNoiseConfigBuilder.h"
+#include "TabulatedNoiseConfigBuilder.h"
 #include "INoiseResultsExporter.h"
+#include "AzimuthNoiseResolver.h"
+#include "NoiseMapPropagator.h"
+#include "SectionNoiseSource.h"
 #include "TecplotNoiseExporter.h"
 #include "RotorNoiseAggregator.h"
+#include "NoiseSpectrumStore.h"
+#include "BladeNoiseSpectra.h"
 
 
 // ─────────────────────────────────────────────────────────────────────────────
@@ -97,7 +114,7 @@ static void printTiming(int step, std::string_view label,
 /**
  * @brief Wind turbine performance simulation using SOLID principles.
  */
-int main(int /*argc*/, char **argv)
+int main(int argc, char **argv)
 {
     auto t_total_start = std::chrono::steady_clock::now();
 
@@ -138,6 +155,12 @@ int main(int /*argc*/, char **argv)
 
         // Simulation data
         schema.addBool("simulation_is_time_based", true, "Flag for static or time-based simulation");
+        schema.addString("turbsim_file", false,
+                         "Bladed/TurbSim .wnd wind field for the time-based simulation");
+        schema.addDouble("time_simulation_length", false,
+                         "Simulated time of the time-based run [s]; default: whole usable wind field");
+        schema.addInt("turbsim_stream_window", false,
+                      "Timesteps of the wind field held in memory; default: map the whole file");
         schema.addRange("wind_speed_range",
                         "windspeed_start", "windspeed_end", "windspeed_step",
                         true, "Wind speed range for static simulation [m/s]");
@@ -202,13 +225,83 @@ int main(int /*argc*/, char **argv)
         schema.addDouble("noise_overhang", true,
                          "Rotor overhang from tower centreline [m]");
 
+        // ── Optional ground noise map (observer grid around the tower) ────────
+        schema.addRange("noise_map_x_range",
+                        "noise_map_x_start", "noise_map_x_end", "noise_map_x_step",
+                        false, "Noise map observer grid, downwind of tower base [m]");
+        schema.addRange("noise_map_y_range",
+                        "noise_map_y_start", "noise_map_y_end", "noise_map_y_step",
+                        false, "Noise map observer grid, across the rotor axis [m]");
+        schema.addInt("noise_map_azimuth_steps", false,
+                      "Blade azimuth positions averaged per revolution for the noise map");
+
+        // ── Optional azimuth-resolved rotor noise (needs psi increment > 0) ──
+        schema.addBool("noise_azimuth_resolved", false,
+                       "Rotor noise per azimuth from the per-psi BEM solutions: 0=off, 1=on");
+
+        // ── Optional noise surrogate (tabulated section spectra) ─────────────
+        schema.addDouble("noise_surrogate_tolerance", false,
+                         "Interpolate section spectra from a (Re, alpha) table; "
+                         "largest accepted cell error [dB]");
+
+        // ── Optional float32 columnar noise store ────────────────────────────
+        schema.addBool("noise_store_float32", false,
+                       "Keep power-curve section spectra in one float32 array: 0=off, 1=on");
+
+        // ── Optional project snapshot (skips parsing and blade interpolation) ─
+        schema.addBool("project_snapshot", false,
+                       "Write <project>.snap after the build and reuse it while inputs are unchanged: 0=off, 1=on");
+
+        // ── Optional run checkpoints (resume with --resume) ──────────────────
+        schema.addBool("checkpoint_runs", false,
+                       "Journal power curve, time-domain run and Rotormap to output/checkpoints: 0=off, 1=on");
+
         auto t1 = std::chrono::steady_clock::now();
         printTiming(1, "Schema built", t0, t1);
 
         // ── 2. Parse ──────────────────────────────────────────────────────────
-        auto fileReader = std::make_unique<FileReader>(argv[1]);
-        ConfigurationParser parser(std::move(schema), std::move(fileReader));
-        Configuration config = parser.parse();
+        //
+        // A project snapshot written by an earlier run replaces parsing and
+        // blade interpolation while the project file and every file it
+        // references are unchanged (size and modification time).
+        //
+        const std::string   project_file  = argv[1];
+        bool resume = false;
+        for (int a = 2; a < argc; ++a)
+            if (std::string_view(argv[a]) == "--resume")
+                resume = true;
+        const std::string   snapshot_path = ProjectSnapshot::defaultPath(project_file);
+        const std::uint64_t schema_id     = ProjectSnapshot::schemaId(schema);
+
+        std::string snapshot_reason;
+        std::unique_ptr<ProjectSnapshot> snapshot =
+            ProjectSnapshot::load(snapshot_path, project_file, schema_id, snapshot_reason);
+
+        Configuration config;
+        if (snapshot)
+        {
+            config = snapshot->takeConfiguration();
+            std::cout << "Project snapshot loaded: " << snapshot_path << "\n";
+        }
+        else
+        {
+            if (!snapshot_reason.empty())
+                std::cout << "Project snapshot not used (" << snapshot_reason << ")\n";
+
+            auto fileReader = std::make_unique<FileReader>(project_file);
+            ConfigurationParser parser(std::move(schema), std::move(fileReader));
+            config = parser.parse();
+        }
+        const bool snapshot_enabled = config.hasValue("project_snapshot")
+                                   && config.getBool("project_snapshot");
+
+        // Every blade consumer gets its own interpolator, decoded from the
+        // snapshot when one was loaded.
+        auto makeBladeInterpolator = [&]()
+        {
+            return snapshot ? snapshot->createBladeInterpolator()
+                            : config.createBladeInterpolator();
+        };
 
         [[maybe_unused]] const BladeGeometryData *bladeGeometry = config.getBladeGeometry();
         [[maybe_unused]] const AirfoilPerformanceFileListData *airfoilPerformanceFileList = config.getAirfoilPerformanceFileList();
@@ -216,7 +309,10 @@ int main(int /*argc*/, char **argv)
 
         [[maybe_unused]] double ratedRotorSpeed = config.getDouble("rated_rotorspeed");
         [[maybe_unused]] bool isHorizontal = config.getBool("turbine_is_horizontal");
-        [[maybe_unused]] bool isTimeBased = config.getBool("simulation_is_time_based");
+        const bool isTimeBased = config.getBool("simulation_is_time_based");
+        if (isTimeBased && !config.hasValue("turbsim_file"))
+            throw std::runtime_error(
+                "simulation_is_time_based = 1 requires 'turbsim_file'");
 
         // ── Noise parameters ──────────────────────────────────────────────────
         const bool switch_calc_noise         = config.getBool("switch_calc_blade_and_rotor_noise");
@@ -230,19 +326,25 @@ int main(int /*argc*/, char **argv)
         // Rotor noise aggregation geometry
         const double noise_ground_distance = config.getDouble("noise_ground_distance");
         const double noise_overhang        = config.getDouble("noise_overhang");
+        const bool   noise_map_enabled     = config.hasValue("noise_map_x_start")
+                                          && config.hasValue("noise_map_y_start");
+        const bool   noise_azimuth_enabled = switch_calc_noise
+                                          && config.hasValue("noise_azimuth_resolved")
+                                          && config.getBool("noise_azimuth_resolved");
+        const bool   noise_store_enabled   = config.hasValue("noise_store_float32")
+                                          && config.getBool("noise_store_float32");
         // hub_height and number_of_blades already read via turbine setup below
 
         std::cout << "Configuration loaded successfully.\n";
 
         auto t2 = std::chrono::steady_clock::now();
-        printTiming(2, "Config parsed", t1, t2);
+        printTiming(2, "Config parsed", t1, t2, snapshot ? "from snapshot" : "");
 
 
             // ── 3. Blade geometry export (DXF + Tecplot 3D) ───────────────────────
         //
-        // createBladeInterpolator() is called once per exporter so each can
-        // take ownership independently.  config holds all raw data so each
-        // call is cheap — no deep-copy machinery needed.
+        // makeBladeInterpolator() is called once per exporter so each can
+        // take ownership independently — no deep-copy machinery needed.
         //
         {
             namespace fs = std::filesystem;
@@ -259,7 +361,7 @@ int main(int /*argc*/, char **argv)
                 std::unique_ptr<IBlade3DExporter> dxfExporter =
                     std::make_unique<DXFBlade3DExporter>();
 
-                auto dxfInterpolator = config.createBladeInterpolator();
+                auto dxfInterpolator = makeBladeInterpolator();
 
                 if (dxfExporter->Export(*dxfInterpolator, dxf_path))
                     std::cout << "  -> " << dxf_path << " written"
@@ -281,7 +383,7 @@ int main(int /*argc*/, char **argv)
                 std::unique_ptr<IBlade3DExporter> blade3DExporter =
                     std::make_unique<TecplotBlade3DExporter>(formatter);
 
-                auto tecInterpolator = config.createBladeInterpolator();
+                auto tecInterpolator = makeBladeInterpolator();
 
                 if (blade3DExporter->Export(*tecInterpolator, tec_path))
                     std::cout << "  -> " << tec_path << " written"
@@ -299,7 +401,22 @@ int main(int /*argc*/, char **argv)
         //
         // Fresh interpolator — independent from the ones used in step 3.
         //
-        auto bladeInterpolator = config.createBladeInterpolator();
+        auto bladeInterpolator = makeBladeInterpolator();
+
+        if (snapshot_enabled && !snapshot)
+        {
+            try
+            {
+                ProjectSnapshot::write(snapshot_path, project_file, schema_id,
+                                       config, *bladeInterpolator);
+                std::cout << "  -> " << snapshot_path << " written\n";
+            }
+            catch (const std::exception &e)
+            {
+                std::cerr << "  -> " << snapshot_path << " FAILED: " << e.what() << "\n";
+            }
+        }
+
         auto turbine = std::make_unique<TurbineGeometry>(std::move(bladeInterpolator));
         turbine->setTurbineConfiguration(
             config.getDouble("hub_radius"),
@@ -312,6 +429,13 @@ int main(int /*argc*/, char **argv)
         turbine->PreComputeRotationMatrices();
         turbine->set_number_of_blades(config.getInt("number_of_blades"));
 
+        // Static per-section airfoil data for the noise model (coordinates,
+        // TE thickness/angle, t/c at 1 % and 10 % chord) — built once here
+        // and shared read-only by every noise evaluation.
+        std::shared_ptr<const SectionNoiseGeometryTable> section_noise_geometry;
+        if (switch_calc_noise)
+            section_noise_geometry = SectionNoiseGeometryBuilder::Build(*turbine);
+
         auto t4 = std::chrono::steady_clock::now();
         printTiming(4, "TurbineGeometry built", t3, t4,
                     std::to_string(turbine->num_sections()) + " sections");
@@ -408,6 +532,30 @@ int main(int /*argc*/, char **argv)
                     "eta=" + std::to_string(eta_mean).substr(0, 5) +
                     " lambda_opt=" + std::to_string(ctrl_params.lambda_opt).substr(0, 5));
 
+        // ── Run checkpoints ───────────────────────────────────────────────────
+        //  With checkpoint_runs = 1 (or --resume) the long stages journal
+        //  their finished work to output/checkpoints/<stage>.ckpt.  --resume
+        //  picks up a journal left by an interrupted run on unchanged inputs
+        //  and build; a journal is deleted once its stage and every stage
+        //  built on its results have finished.
+        const bool checkpoints_enabled =
+            resume || (config.hasValue("checkpoint_runs") && config.getBool("checkpoint_runs"));
+        const std::uint64_t inputs_id =
+            checkpoints_enabled ? ProjectSnapshot::inputsId(project_file, config) : 0;
+
+        auto openJournal = [&](std::string const &stage) -> std::unique_ptr<CheckpointJournal>
+        {
+            if (!checkpoints_enabled)
+                return nullptr;
+            auto journal = std::make_unique<CheckpointJournal>(
+                "output/checkpoints/" + stage + ".ckpt",
+                CheckpointJournal::RunKey(inputs_id, stage), resume);
+            if (!journal->restore_note().empty())
+                std::cout << "  Checkpoint " << journal->path() << " not used ("
+                          << journal->restore_note() << ")\n";
+            return journal;
+        };
+
         // ── 7. Build OperationSolver ──────────────────────────────────────────
         auto op_params = OperationSolverParams::FromConfig(turbine.get(), &sim_config);
 
@@ -446,14 +594,41 @@ int main(int /*argc*/, char **argv)
         std::cout << "  Azimuth positions: " << psi_vec_rad.size()
                   << (psi_vec_rad.size() == 1 ? " (scalar psi=0)\n" : " positions\n");
 
+        // Shear/veer inflow of every (psi, section), evaluated once per wind
+        // speed and shared by all callbacks of that wind speed.
+        AzimuthInflowCache inflow_cache(turbine.get(), psi_vec_rad, FlowModifiers{});
+
         // Collect postprocessor results per wind speed for rotor disc export.
         std::vector<BEMPostprocessResult> pp_vec;
         pp_vec.reserve(vinf_vec.size());
 
+        // Per-psi results of the same FULL_LOADS calls, kept only for the
+        // azimuth-resolved noise (aligned with pp_vec).
+        const bool keep_psi_results = noise_azimuth_enabled && psi_vec_rad.size() > 1;
+        std::vector<PsiPostprocessResults> pp_psi_vec;
+        if (keep_psi_results)
+            pp_psi_vec.reserve(vinf_vec.size());
+
+        // Per-psi solves from the most recent callback.  OperationSolver
+        // repeats the converged (vinf, lambda, pitch) triple once with
+        // FULL_LOADS; that call reuses these solves and only reruns the
+        // postprocessor at full detail.
+        struct PsiSolve
+        {
+            std::unique_ptr<FlowCalculator> fc;
+            std::unique_ptr<NingSolver>     solver;
+        };
+        std::vector<PsiSolve> last_solves;
+        double last_vinf = std::numeric_limits<double>::quiet_NaN();
+        double last_lambda = last_vinf;
+        double last_pitch_deg = last_vinf;
+
         // BEM callback: averages cp, ct and BEMPostprocessResult over all psi.
+        // Only the FULL_LOADS call per wind speed is stored in pp_vec.
         BEMCallback bem_callback = [&](double vinf,
                                        double lambda,
-                                       double pitch_deg)
+                                       double pitch_deg,
+                                       PostprocessDetail detail)
             -> std::pair<double, double>
         {
             double rot_rate  = lambda * vinf / turbine->RotorRadius();
@@ -466,21 +641,43 @@ int main(int /*argc*/, char **argv)
             const int n_psi = static_cast<int>(psi_vec_rad.size());
             std::vector<std::optional<BEMPostprocessResult>> psi_results(n_psi);
 
+            const bool reuse_solves = vinf == last_vinf &&
+                                      lambda == last_lambda &&
+                                      pitch_deg == last_pitch_deg;
+            if (!reuse_solves)
+            {
+                last_solves.clear();
+                last_solves.resize(static_cast<std::size_t>(n_psi));
+                last_vinf = vinf;
+                last_lambda = lambda;
+                last_pitch_deg = pitch_deg;
+            }
+
             for (int psi_idx = 0; psi_idx < n_psi; ++psi_idx)
             {
                 const double psi = psi_vec_rad[static_cast<std::size_t>(psi_idx)];
+                PsiSolve &ps = last_solves[static_cast<std::size_t>(psi_idx)];
+
+                if (!reuse_solves)
+                {
+                    auto fc = fc_factory.BuildSampled(
+                        turbine.get(), rot_rate, psi,
+                        inflow_cache.At(vinf, static_cast<std::size_t>(psi_idx)), vinf);
+                    auto solver = solver_factory.Build(turbine.get(), &sim_config,
+                                                       fc.get(), pitch_rad, psi);
+
+                    if (!solver->Solve()) continue;
 
-                auto fc = fc_factory.Build(turbine.get(), rot_rate, vinf,
-                                           psi, FlowModifiers{});
-                auto solver = solver_factory.Build(turbine.get(), &sim_config,
-                                                   fc.get(), pitch_rad, psi);
+                    ps.fc     = std::move(fc);
+                    ps.solver = std::move(solver);
+                }
 
-                if (!solver->Solve()) continue;
+                if (!ps.solver) continue;
 
-            BEMPostprocessor postproc(
-                    turbine.get(), &sim_config, fc.get(),
-                static_cast<double>(turbine->num_blades()));
-            postproc.Process(*solver);
+                BEMPostprocessor postproc(
+                    turbine.get(), &sim_config, ps.fc.get(),
+                    static_cast<double>(turbine->num_blades()), detail);
+                postproc.Process(*ps.solver);
                 if (!postproc.Success()) continue;
 
                 psi_results[static_cast<std::size_t>(psi_idx)] = postproc.Result();
@@ -510,6 +707,11 @@ int main(int /*argc*/, char **argv)
                 pp_sum.my      += pp.my;
                 pp_sum.mz      += pp.mz;
 
+                ++n_converged;
+
+                if (detail == PostprocessDetail::ROTOR_SCALARS)
+                    continue;
+
                 // Accumulate per-section vectors (resize on first converged psi).
                 const std::size_t ns = pp.alpha_eff.size();
                 auto accumVec = [&](std::vector<double> &dst,
@@ -539,8 +741,6 @@ int main(int /*argc*/, char **argv)
                 accumVec(pp_sum.integral_mx,            pp.integral_mx);
                 accumVec(pp_sum.integral_my,            pp.integral_my);
                 accumVec(pp_sum.integral_mz,            pp.integral_mz);
-
-                ++n_converged;
             }
 
             if (n_converged == 0) return {0.0, 0.0};
@@ -570,7 +770,24 @@ int main(int /*argc*/, char **argv)
             scaleVec(pp_sum.integral_mz);
 
             // Store azimuth-averaged result for rotor disc / blade export.
-            pp_vec.push_back(pp_sum);
+            if (detail == PostprocessDetail::FULL_LOADS)
+            {
+                pp_vec.push_back(pp_sum);
+
+                if (keep_psi_results)
+                {
+                    PsiPostprocessResults &ps = pp_psi_vec.emplace_back();
+                    ps.vinf     = vinf;
+                    ps.rot_rate = rot_rate;
+                    for (int psi_idx = 0; psi_idx < n_psi; ++psi_idx)
+                    {
+                        auto &res = psi_results[static_cast<std::size_t>(psi_idx)];
+                        if (!res.has_value()) continue;
+                        ps.psi_rad.push_back(psi_vec_rad[static_cast<std::size_t>(psi_idx)]);
+                        ps.results.push_back(std::move(*res));
+                    }
+                }
+            }
 
             return {pp_sum.cp, pp_sum.ct};
         };
@@ -582,12 +799,118 @@ int main(int /*argc*/, char **argv)
                     std::to_string(vinf_vec.size()) + " wind speed points");
 
         // ── 8. Run power curve ────────────────────────────────────────────────
-        auto power_curve = op_solver.Run(0.0, vinf_vec);
+        //  The journal is completed only after the noise stages, which start
+        //  from this power curve: a resumed noise run needs it unchanged.
+        auto pc_journal = openJournal("power_curve");
+        auto power_curve = op_solver.Run(0.0, vinf_vec, pc_journal.get());
 
         auto t8 = std::chrono::steady_clock::now();
         printTiming(8, "Power curve solved", t7, t8,
                     std::to_string(vinf_vec.size()) + " wind speed points");
 
+        // ── 8b. Time-domain run (simulation_is_time_based = 1) ────────────────
+        //  Rotor speed and pitch are taken from the power curve at the mean
+        //  hub-height speed of the TurbSim field and held constant; every
+        //  step solves all blades at their azimuth in the turbulent inflow.
+        //  Rows of output/time_series.dat are written as the steps finish.
+        if (isTimeBased && !power_curve.empty())
+        {
+            auto t8b_start = std::chrono::steady_clock::now();
+
+            TurbSimManagerFactory tsm_factory;
+            const bool streamWind = config.hasValue("turbsim_stream_window");
+            auto wind = streamWind
+                ? tsm_factory.BuildStreaming(config.getString("turbsim_file"),
+                                             static_cast<std::size_t>(std::max(
+                                                 3, config.getInt("turbsim_stream_window"))))
+                : tsm_factory.Build(config.getString("turbsim_file"));
+
+            // Operating point: linear interpolation of the power curve
+            // (clamped to its ends) at the TurbSim hub velocity.
+            const double v_hub = wind->hub_velocity();
+            auto upper = std::find_if(power_curve.begin(), power_curve.end(),
+                                      [&](PowerCurvePoint const &pt) { return pt.vinf >= v_hub; });
+            PowerCurvePoint op = upper == power_curve.end() ? power_curve.back() : *upper;
+            if (upper != power_curve.begin() && upper != power_curve.end() &&
+                upper->vinf > (upper - 1)->vinf)
+            {
+                PowerCurvePoint const &lo = *(upper - 1);
+                const double w = (v_hub - lo.vinf) / (upper->vinf - lo.vinf);
+                op.n     = lo.n     + w * (upper->n     - lo.n);
+                op.pitch = lo.pitch + w * (upper->pitch - lo.pitch);
+            }
+
+            TimeDomainParams td_params;
+            td_params.rot_rate  = op.n * 2.0 * std::numbers::pi / 60.0;
+            td_params.pitch_rad = op.pitch * std::numbers::pi / 180.0;
+            if (config.hasValue("time_simulation_length"))
+                td_params.num_steps = static_cast<unsigned>(std::max(
+                    1.0, std::round(config.getDouble("time_simulation_length") / wind->timestep())));
+
+            TimeDomainSolver td_solver(turbine.get(), &sim_config, wind.get());
+            const unsigned n_steps = td_solver.StepCount(td_params);
+            const int n_blades_td = turbine->num_blades();
+
+            std::cout << "  Time domain: " << n_steps << " steps of "
+                      << std::fixed << std::setprecision(3) << wind->timestep() << " s"
+                      << "  (v_hub=" << std::setprecision(2) << v_hub << " m/s"
+                      << ", n=" << op.n << " rpm, pitch=" << op.pitch << " deg)\n";
+
+            std::vector<std::string> td_vars{"time_[s]", "psi_[deg]", "v_hub_[m/s]",
+                                             "p_aero_[W]", "thrust_[N]", "torque_[Nm]"};
+            for (int b = 1; b <= n_blades_td; ++b)
+            {
+                const std::string sfx = "_b" + std::to_string(b);
+                td_vars.push_back("thrust" + sfx + "_[N]");
+                td_vars.push_back("mx" + sfx + "_[Nm]");
+                td_vars.push_back("my" + sfx + "_[Nm]");
+            }
+            td_vars.push_back("converged_blades_[-]");
+
+            TecplotTimeSeriesWriter td_writer("output/time_series.dat", "time_series",
+                                              td_vars, n_steps);
+            std::vector<double> row;
+            const unsigned report_every = std::max(1u, n_steps / 10);
+            auto td_journal = openJournal("time_domain");
+
+            const unsigned n_ok = td_solver.Run(td_params, [&](TimeDomainStep const &st)
+            {
+                row.clear();
+                row.push_back(st.time);
+                row.push_back(st.psi * 180.0 / std::numbers::pi);
+                row.push_back(st.v_hub);
+                row.push_back(st.power);
+                row.push_back(st.thrust);
+                row.push_back(st.torque);
+                for (std::size_t b = 0; b < st.root_mx.size(); ++b)
+                {
+                    row.push_back(st.blade_thrust[b]);
+                    row.push_back(st.root_mx[b]);
+                    row.push_back(st.root_my[b]);
+                }
+                row.push_back(static_cast<double>(st.converged_blades));
+                td_writer.AppendRow(row);
+
+                if ((st.step + 1) % report_every == 0 || st.step + 1 == n_steps)
+                    std::cout << "  [time] t = " << std::fixed << std::setprecision(1)
+                              << st.time << " s  (" << st.step + 1 << "/" << n_steps << ")\n";
+            }, td_journal.get());
+            if (td_journal)
+                td_journal->Complete();
+
+            if (td_writer.Close())
+                std::cout << "  -> output/time_series.dat written"
+                          << "  (" << td_writer.rows_written() << " steps, "
+                          << n_ok << " fully converged)\n";
+            else
+                std::cerr << "  -> output/time_series.dat FAILED\n";
+
+            auto t8b = std::chrono::steady_clock::now();
+            printTiming(8, "Time-domain run", t8b_start, t8b,
+                        std::to_string(n_steps) + " steps");
+            t8 = t8b;
+        }
+
         // ── 9. AEP ────────────────────────────────────────────────────────────
         std::vector<double> pel_vec;
         pel_vec.reserve(power_curve.size());
@@ -626,12 +949,17 @@ int main(int /*argc*/, char **argv)
             rm_params.pitch_step   = config.getDouble("rotormap_pitch_step")  * deg2rad_rm;
 
             RotormapSolver rm_solver(turbine.get(), &sim_config);
-            RotormapResult rm_result = rm_solver.Solve(rm_params);
+            auto rm_journal = openJournal("rotormap");
+            RotormapResult rm_result = rm_solver.Solve(rm_params, rm_journal.get());
 
             if (simExporter->ExportRotormap(rm_result, "output/Rotormap.dat"))
+            {
                 std::cout << "  -> " << "output/Rotormap.dat" << " written"
                           << "  (" << rm_result.count_I() << "x"
                           << rm_result.count_J() << " points)\n";
+                if (rm_journal)
+                    rm_journal->Complete();
+            }
             else
                 std::cerr << "  -> " << "output/Rotormap.dat" << " FAILED\n";
         }
@@ -646,65 +974,177 @@ int main(int /*argc*/, char **argv)
         // ── 11. Blade section noise — full power curve ───────────────────────
         //  Enabled by switch_calc_blade_and_rotor_noise = 1 and at least one
         //  noise source active in config.
+        //
+        //  The per-section results are computed exactly once into
+        //  blade_noise_results; step 12 aggregates the same store instead of
+        //  re-running SectionNoiseCalculator.
         auto t11_start = std::chrono::steady_clock::now();
-        if (switch_calc_noise)
+
+        NoiseConfig noise_cfg;
+        noise_cfg.bl_tripping          = noise_bl_tripping;
+        noise_cfg.bl_properties_method = noise_bl_properties_calc_method;
+        noise_cfg.tbl_noise_method     = noise_tbl_noise_calc_method;
+        noise_cfg.ti_noise_method      = noise_ti_noise_calc_method;
+        noise_cfg.compute_bluntness    = noise_calc_blunt_te_noise;
+        noise_cfg.compute_laminar      = noise_calc_lam_bl_noise;
+
+        // One BladeNoiseResult per power-curve point; empty if noise is off.
+        std::vector<BladeNoiseResult> blade_noise_results;
+
+        // With noise_store_float32 = 1 the noise tasks write the section
+        // spectra straight into one float32 array; blade_noise_results then
+        // keeps only flow data and convergence flags.
+        NoiseSpectrumStore noise_store;
+
+        // Finished sections of the noise stage; completed with pc_journal.
+        std::unique_ptr<CheckpointJournal> noise_journal;
+
+        // Section noise model shared by every SectionNoiseCalculator below.
+        // With noise_surrogate_tolerance set, spectra are interpolated from
+        // a table the exact model fills on demand (fallback outside it).
+        std::shared_ptr<ISectionNoiseConfigBuilder> noise_builder =
+            std::make_shared<BladeNoiseConfigBuilder>();
+        std::shared_ptr<TabulatedNoiseConfigBuilder> noise_surrogate;
+        if (config.hasValue("noise_surrogate_tolerance"))
         {
-            NoiseConfig noise_cfg;
-            noise_cfg.bl_tripping          = noise_bl_tripping;
-            noise_cfg.bl_properties_method = noise_bl_properties_calc_method;
-            noise_cfg.tbl_noise_method     = noise_tbl_noise_calc_method;
-            noise_cfg.ti_noise_method      = noise_ti_noise_calc_method;
-            noise_cfg.compute_bluntness    = noise_calc_blunt_te_noise;
-            noise_cfg.compute_laminar      = noise_calc_lam_bl_noise;
+            noise_surrogate = std::make_shared<TabulatedNoiseConfigBuilder>(
+                noise_builder, config.getDouble("noise_surrogate_tolerance"));
+            noise_builder = noise_surrogate;
+        }
 
+        if (switch_calc_noise)
+        {
             if (noise_cfg.any_enabled() && !pp_vec.empty())
             {
-                auto noise_adapter = std::make_shared<BEMSectionNoiseAdapter>();
-                SectionNoiseCalculator noise_calc(noise_cfg, noise_adapter);
-
-                // Pre-size so each thread writes to its own slot — no mutex needed
-                // on the vector itself.  Console output uses a critical section.
-                //const std::size_t n_pts = pp_vec.size();
-                const std::size_t n_pts = vinf_vec.size();
-                std::vector<BladeNoiseResult> all_noise_results(n_pts);
-
-                #pragma omp parallel for schedule(dynamic, 1) default(none) \
-                    shared(all_noise_results, pp_vec, vinf_vec, \
-                           noise_calc, turbine, sim_config, n_pts, \
-                           std::cout)
+                auto noise_adapter = std::make_shared<BEMSectionNoiseAdapter>(
+                    section_noise_geometry);
+                SectionNoiseCalculator noise_calc(noise_cfg, noise_adapter, noise_builder);
+
+                // ── Flattened (point × section) schedule ─────────────────────
+                //  Section cost varies widely (Xfoil near the root vs. BPM at
+                //  the tip) and there are usually fewer operating points than
+                //  cores, so every (point, section) pair is its own task in a
+                //  single dynamic pool.  Each task writes only its own result
+                //  slot; progress is tracked with atomics instead of a critical
+                //  section, and the thread finishing a point's last section
+                //  finalizes that point and reports it.
+                const std::size_t n_pts = std::min(vinf_vec.size(), pp_vec.size());
+
+                std::vector<BladeNoiseJob> noise_jobs(n_pts);
+                std::vector<std::size_t>   task_offset(n_pts + 1, 0);
                 for (std::size_t j = 0; j < n_pts; ++j)
                 {
                     BEMPostprocessResult const &pp_j = pp_vec[j];
-                    const double vinf_j = vinf_vec[j];
-
-                    // Each iteration is independent — Calculate() is const
-                    // and reads only its own inputs.
-                    all_noise_results[j] = noise_calc.Calculate(
+                    noise_jobs[j] = noise_calc.Prepare(
                         pp_j, turbine.get(), sim_config,
-                        vinf_j,
+                        vinf_vec[j],
                         pp_j.local_velocity,
                         pp_j.local_mach,
                         pp_j.local_reynolds);
+                    task_offset[j + 1] = task_offset[j] + noise_jobs[j].inputs.size();
+                }
+                const std::size_t n_tasks = task_offset[n_pts];
 
-                    #pragma omp critical
+                if (noise_store_enabled)
+                {
+                    std::size_t n_sections = 0;
+                    for (auto const &job : noise_jobs)
+                        n_sections = std::max(n_sections, job.inputs.size());
+
+                    noise_store = NoiseSpectrumStore(
+                        n_pts, n_sections, SectionNoiseCalculator::BandFrequencies());
+                    for (std::size_t j = 0; j < n_pts; ++j)
                     {
-                    std::cout << "  [noise] v_inf = " << std::fixed
-                              << std::setprecision(1) << vinf_j << " m/s"
-                              << "  (" << (j + 1) << "/" << n_pts << ")\n";
+                        noise_store.BeginPoint(j, noise_jobs[j].result);
+                        noise_jobs[j].store       = &noise_store;
+                        noise_jobs[j].store_point = j;
+                    }
+                }
+
+                // Sections an interrupted run finished are restored (after
+                // the store is attached, so they land in it too) and skipped.
+                std::vector<std::vector<bool>> section_restored;
+                noise_journal = openJournal("blade_noise");
+                if (noise_journal)
+                    section_restored = noise_calc.Resume(noise_jobs, *noise_journal);
+                else
+                    for (auto const &job : noise_jobs)
+                        section_restored.emplace_back(job.inputs.size(), false);
+
+                blade_noise_results.resize(n_pts);
+                std::vector<std::atomic<std::size_t>> sections_left(n_pts);
+                for (std::size_t j = 0; j < n_pts; ++j)
+                {
+                    sections_left[j].store(noise_jobs[j].inputs.size(),
+                                           std::memory_order_relaxed);
+                    if (noise_jobs[j].inputs.empty())
+                        blade_noise_results[j] =
+                            noise_calc.Finalize(std::move(noise_jobs[j]));
                 }
+                std::atomic<std::size_t> points_done{0};
+
+                #pragma omp parallel for schedule(dynamic, 1) default(none) \
+                    shared(blade_noise_results, noise_jobs, task_offset, \
+                           section_restored, sections_left, points_done, \
+                           noise_calc, n_pts, n_tasks, std::cout)
+                for (std::size_t k = 0; k < n_tasks; ++k)
+                {
+                    // Map the flat task index back to (point, section)
+                    const std::size_t j = static_cast<std::size_t>(
+                        std::upper_bound(task_offset.begin(), task_offset.end(), k)
+                        - task_offset.begin()) - 1;
+                    const std::size_t i = k - task_offset[j];
+
+                    if (!section_restored[j][i])
+                        noise_calc.CalculateSection(noise_jobs[j], i);
+
+                    // acq_rel: the last finisher must see every section result
+                    if (sections_left[j].fetch_sub(1, std::memory_order_acq_rel) == 1)
+                    {
+                        const double vinf_j = noise_jobs[j].result.vinf;
+                        blade_noise_results[j] =
+                            noise_calc.Finalize(std::move(noise_jobs[j]));
+
+                        const std::size_t done =
+                            points_done.fetch_add(1, std::memory_order_relaxed) + 1;
+                        std::ostringstream line;
+                        line << "  [noise] v_inf = " << std::fixed
+                             << std::setprecision(1) << vinf_j << " m/s"
+                             << "  (" << done << "/" << n_pts << ")\n";
+                        std::cout << line.str();
+                    }
                 }
 
+                std::cout << "  " << BladeNoiseConfigBuilder::CacheStatistics() << "\n";
+                if (noise_surrogate)
+                    std::cout << "  " << noise_surrogate->Statistics() << "\n";
+
                 std::unique_ptr<INoiseResultsExporter> noiseExporter =
                     std::make_unique<TecplotNoiseExporter>(formatter);
 
+                const std::size_t n_zones = blade_noise_results.size();
+                const std::size_t n_sections_0 = blade_noise_results.empty()
+                                               ? 0
+                                               : blade_noise_results[0].sections.size();
+                if (noise_store_enabled)
+                    std::cout << "  [noise store] " << noise_store.points() << " x "
+                              << noise_store.max_sections() << " x "
+                              << NoiseSpectrumStore::N_SOURCES << " x "
+                              << noise_store.bands() << " float32, "
+                              << noise_store.memory_bytes() / 1024 << " KiB\n";
+
+                const BladeNoiseSpectra blade_spectra(blade_noise_results);
+                INoiseSpectra const &spectra = noise_store_enabled
+                                             ? static_cast<INoiseSpectra const &>(noise_store)
+                                             : blade_spectra;
+                const bool exported = noiseExporter->ExportPowerCurveNoise(
+                    spectra, "output/blade_noise_powercurve.dat");
+
                 // Full power-curve noise file (one zone per operating point)
-                if (noiseExporter->ExportPowerCurveNoise(
-                        all_noise_results, "output/blade_noise_powercurve.dat"))
+                if (exported)
                     std::cout << "  -> output/blade_noise_powercurve.dat written"
-                              << "  (" << all_noise_results.size() << " zones, "
-                              << (all_noise_results.empty() ? 0
-                                  : all_noise_results[0].sections.size())
-                              << " sections each)\n";
+                              << "  (" << n_zones << " zones, "
+                              << n_sections_0 << " sections each)\n";
                 else
                     std::cerr << "  -> output/blade_noise_powercurve.dat FAILED\n";
             }
@@ -729,24 +1169,24 @@ int main(int /*argc*/, char **argv)
         //    - A-weighting (IEC 61672 formula)
         //    - Free-field geometric spreading  As = 10·log10(1/(4πd²))
         //    - Multi-blade scaling  LWA_rotor = LWA_blade + 10·log10(n_blades)
+        //  Input:  section spectra from step 11 (noise_store, or
+        //          blade_noise_results) — no recomputation.
         //  Output: rotor_noise_powercurve.dat — 7 zones (one per noise source),
         //          rows = operating points, cols = OASPL, LWA, SPL spectrum
+        //          rotor_noise_map.dat (if noise_map_x/y_range are set) —
+        //          OASPL / OASPL_A on an observer grid, one zone per point
+        //          rotor_noise_azimuth.dat (if noise_azimuth_resolved = 1) —
+        //          OASPL / LWA per blade azimuth, one zone per point
         auto t12_start = std::chrono::steady_clock::now();
         if (switch_calc_noise)
         {
-            NoiseConfig noise_cfg_check;
-            noise_cfg_check.bl_tripping          = noise_bl_tripping;
-            noise_cfg_check.bl_properties_method = noise_bl_properties_calc_method;
-            noise_cfg_check.tbl_noise_method     = noise_tbl_noise_calc_method;
-            noise_cfg_check.ti_noise_method      = noise_ti_noise_calc_method;
-            noise_cfg_check.compute_bluntness    = noise_calc_blunt_te_noise;
-            noise_cfg_check.compute_laminar      = noise_calc_lam_bl_noise;
-
-            // Reuse all_noise_results from step 11 — declared in its own scope
-            // above, so we need a reference path.  Easiest: redo the aggregation
-            // only if noise was actually run.  We guard on the same condition.
-            if (noise_cfg_check.any_enabled() && !pp_vec.empty())
+            if (!blade_noise_results.empty())
             {
+                const BladeNoiseSpectra blade_spectra(blade_noise_results);
+                INoiseSpectra const &spectra = noise_store_enabled
+                                             ? static_cast<INoiseSpectra const &>(noise_store)
+                                             : blade_spectra;
+
                 const int    n_blades_rotor = config.getInt("number_of_blades");
                 const double hub_h          = config.getDouble("hub_height");
 
@@ -761,44 +1201,11 @@ int main(int /*argc*/, char **argv)
                           << aggregator.ObserverDistance() << " m"
                           << "  (" << n_blades_rotor << " blades)\n";
 
-                // Re-run the noise loop to get all_noise_results in this scope.
-                // (If step 11 already populated them we can't access them here
-                //  because they're in the previous scope block.  We therefore
-                //  repeat the calculation — it is cheap: just a re-aggregate
-                //  of already-computed BEM post-process results.)
-                const std::size_t n_pts = vinf_vec.size();
-                std::vector<BladeNoiseResult> noise_results_agg(n_pts);
-
-                {
-                    auto noise_adapter_agg = std::make_shared<BEMSectionNoiseAdapter>();
-                    NoiseConfig noise_cfg_agg;
-                    noise_cfg_agg.bl_tripping          = noise_bl_tripping;
-                    noise_cfg_agg.bl_properties_method = noise_bl_properties_calc_method;
-                    noise_cfg_agg.tbl_noise_method     = noise_tbl_noise_calc_method;
-                    noise_cfg_agg.ti_noise_method      = noise_ti_noise_calc_method;
-                    noise_cfg_agg.compute_bluntness    = noise_calc_blunt_te_noise;
-                    noise_cfg_agg.compute_laminar      = noise_calc_lam_bl_noise;
-                    SectionNoiseCalculator noise_calc_agg(noise_cfg_agg, noise_adapter_agg);
-
-                    #pragma omp parallel for schedule(dynamic, 1) default(none) \
-                        shared(noise_results_agg, pp_vec, vinf_vec, \
-                               noise_calc_agg, turbine, sim_config, n_pts)
-                    for (std::size_t j = 0; j < n_pts; ++j)
-                    {
-                        noise_results_agg[j] = noise_calc_agg.Calculate(
-                            pp_vec[j], turbine.get(), sim_config,
-                            vinf_vec[j],
-                            pp_vec[j].local_velocity,
-                            pp_vec[j].local_mach,
-                            pp_vec[j].local_reynolds);
-                    }
-                }
-
                 // Aggregate each operating point
                 std::vector<RotorNoiseResult> rotor_results;
-                rotor_results.reserve(n_pts);
-                for (auto const &br : noise_results_agg)
-                    rotor_results.push_back(aggregator.Aggregate(br));
+                rotor_results.reserve(spectra.points());
+                for (std::size_t p = 0; p < spectra.points(); ++p)
+                    rotor_results.push_back(aggregator.Aggregate(spectra, p));
 
                 std::unique_ptr<INoiseResultsExporter> rotorNoiseExporter =
                     std::make_unique<TecplotNoiseExporter>(formatter);
@@ -810,8 +1217,93 @@ int main(int /*argc*/, char **argv)
                               << " operating points, 7 source zones)\n";
                 else
                     std::cerr << "  -> output/rotor_noise_powercurve.dat FAILED\n";
+
+                // ── Ground noise map ─────────────────────────────────────────
+                //  Section spectra are reduced once to directivity-free
+                //  sources; only the cheap propagation stage (directivity,
+                //  spreading, A-weighting) runs per observer.
+                if (noise_map_enabled)
+                {
+                    const NoiseMapGrid grid = NoiseMapGrid::FromRanges(
+                        config.getDouble("noise_map_x_start"),
+                        config.getDouble("noise_map_x_end"),
+                        config.getDouble("noise_map_x_step"),
+                        config.getDouble("noise_map_y_start"),
+                        config.getDouble("noise_map_y_end"),
+                        config.getDouble("noise_map_y_step"));
+                    const int n_azimuth = config.hasValue("noise_map_azimuth_steps")
+                                        ? config.getInt("noise_map_azimuth_steps")
+                                        : 36;
+
+                    NoiseMapPropagator propagator(n_blades_rotor, hub_h,
+                                                  noise_overhang, n_azimuth);
+
+                    std::vector<NoiseMapResult> noise_maps;
+                    noise_maps.reserve(spectra.points());
+                    for (std::size_t p = 0; p < spectra.points(); ++p)
+                        noise_maps.push_back(propagator.Propagate(
+                            SectionNoiseSourceBuilder::Build(spectra, p), grid));
+
+                    if (rotorNoiseExporter->ExportNoiseMap(
+                            noise_maps, "output/rotor_noise_map.dat"))
+                        std::cout << "  -> output/rotor_noise_map.dat written"
+                                  << "  (" << grid.x.size() << " x " << grid.y.size()
+                                  << " observers, " << noise_maps.size()
+                                  << " operating points)\n";
+                    else
+                        std::cerr << "  -> output/rotor_noise_map.dat FAILED\n";
+                }
+
+                // ── Azimuth-resolved rotor noise ─────────────────────────────
+                //  Reuses the per-psi solves of the power-curve callback; the
+                //  section model runs only for (Re, alpha, Mach) states not
+                //  already computed at another azimuth of the same point.
+                if (noise_azimuth_enabled && pp_psi_vec.empty())
+                {
+                    std::cout << "  Azimuth-resolved noise skipped "
+                                 "(rotor_azimuth_psi_increment = 0)\n";
+                }
+                else if (noise_azimuth_enabled)
+                {
+                    SectionNoiseCalculator psi_noise_calc(
+                        noise_cfg,
+                        std::make_shared<BEMSectionNoiseAdapter>(section_noise_geometry),
+                        noise_builder);
+                    AzimuthNoiseResolver resolver(psi_noise_calc, aggregator, {},
+                                                  noise_store_enabled);
+
+                    std::vector<AzimuthNoiseResult> azimuth_results;
+                    azimuth_results.reserve(pp_psi_vec.size());
+                    std::size_t n_computed = 0, n_reused = 0;
+                    for (auto const &ps : pp_psi_vec)
+                    {
+                        azimuth_results.push_back(
+                            resolver.Resolve(ps, turbine.get(), sim_config));
+                        n_computed += azimuth_results.back().sections_computed;
+                        n_reused   += azimuth_results.back().sections_reused;
+
+                        std::cout << "  [azimuth noise] v_inf = " << std::fixed
+                                  << std::setprecision(1) << ps.vinf << " m/s"
+                                  << "  modulation depth = " << std::setprecision(2)
+                                  << azimuth_results.back().rotor_oasplA_depth
+                                  << " dB(A)\n";
+                    }
+                    std::cout << "  [azimuth noise] " << n_computed
+                              << " section evaluations, " << n_reused
+                              << " reused across azimuth\n";
+
+                    if (rotorNoiseExporter->ExportAzimuthNoise(
+                            azimuth_results, "output/rotor_noise_azimuth.dat"))
+                        std::cout << "  -> output/rotor_noise_azimuth.dat written"
+                                  << "  (" << azimuth_results.size()
+                                  << " operating points, "
+                                  << pp_psi_vec.front().psi_rad.size()
+                                  << " azimuth positions)\n";
+                    else
+                        std::cerr << "  -> output/rotor_noise_azimuth.dat FAILED\n";
+                }
             }
-            else if (!noise_cfg_check.any_enabled())
+            else if (!noise_cfg.any_enabled())
             {
                 std::cout << "  Rotor noise aggregation skipped "
                              "(all noise sources disabled in config)\n";
@@ -826,6 +1318,12 @@ int main(int /*argc*/, char **argv)
         printTiming(12, "Rotor noise aggregated", t12_start, t12,
                     std::to_string(vinf_vec.size()) + " operating points");
 
+        // Power curve and noise are done: nothing left to resume
+        if (noise_journal)
+            noise_journal->Complete();
+        if (pc_journal)
+            pc_journal->Complete();
+
         // turbine_performance.dat — power curve, one row per wind speed
         if (simExporter->ExportPowerCurve(power_curve, "output/turbine_performance.dat"))
             std::cout << "  -> output/turbine_performance.dat written\n";
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <string>
+
+// Fixture base: every test gets an empty scratch directory under the system
+// temp directory, named after the test, and removed again afterwards.
+class TempDirectoryTest : public ::testing::Test
+{
+protected:
+    std::filesystem::path dir;
+
+    void SetUp() override
+    {
+        const auto* info = ::testing::UnitTest::GetInstance()->current_test_info();
+        dir = std::filesystem::temp_directory_path() /
+              ("solidturbine_" + std::string(info->test_suite_name()) + "_" + info->name());
+        std::filesystem::remove_all(dir);
+        std::filesystem::create_directories(dir);
+    }
+
+    void TearDown() override { std::filesystem::remove_all(dir); }
+};
@@ -0,0 +1,232 @@
+#include <gtest/gtest.h>
+
+#include "../src/CheckpointJournal.cpp" // Core project is built as an application
+#include "../src/SectionNoiseCalculator.cpp"
+#include "TempDirectoryTest.h"
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+
+namespace
+{
+
+namespace fs = std::filesystem;
+
+class CheckpointJournalTest : public TempDirectoryTest
+{
+protected:
+    std::string path;
+    std::uint64_t key = CheckpointJournal::RunKey(42, "test", "1.0.0+test");
+
+    void SetUp() override
+    {
+        TempDirectoryTest::SetUp();
+        path = (dir / "checkpoints" / "test.ckpt").string();
+    }
+
+    void Write(std::vector<std::string> const &records, bool resume = false)
+    {
+        CheckpointJournal journal(path, key, resume);
+        for (auto const &record : records)
+            journal.Append(record);
+    }
+
+    std::vector<std::string> Restore()
+    {
+        CheckpointJournal journal(path, key, true);
+        return journal.restored();
+    }
+};
+
+// Deterministic stand-in for the noise model: every level is a function of
+// the section input, so a restored section must equal a recomputed one.
+class CountingBuilder : public ISectionNoiseConfigBuilder
+{
+public:
+    mutable std::atomic<int> calls{0};
+
+    bool Build(SectionNoiseInput const &inp, NoiseConfig const &,
+               SectionNoiseResult &result) const override
+    {
+        ++calls;
+        for (std::size_t k = 0; k < std::size(kNoiseSourceSpectra); ++k)
+        {
+            SectionNoiseSpectrum &sp = result.*kNoiseSourceSpectra[k];
+            sp.spl = { inp.velocity + k, inp.alpha_deg * 3.0 + k, 1.0 / (1.0 + k) };
+            sp.oaspl = inp.velocity * 0.7 + k;
+            sp.directivity_crossover_hz = 100.0 * (k + 1);
+        }
+        return inp.alpha_deg < 10.0;
+    }
+};
+
+std::vector<BladeNoiseJob> MakeJobs()
+{
+    std::vector<BladeNoiseJob> jobs(3);
+    for (std::size_t j = 0; j < jobs.size(); ++j)
+    {
+        jobs[j].result.vinf = 4.0 + 2.0 * j;
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            SectionNoiseInput inp;
+            inp.velocity = 20.0 + 10.0 * i + j;
+            inp.alpha_deg = 2.0 + 3.0 * i;
+            jobs[j].inputs.push_back(inp);
+        }
+        jobs[j].result.sections.resize(jobs[j].inputs.size());
+    }
+    return jobs;
+}
+
+void ExpectSameSections(BladeNoiseResult const &a, BladeNoiseResult const &b)
+{
+    ASSERT_EQ(a.sections.size(), b.sections.size());
+    for (std::size_t i = 0; i < a.sections.size(); ++i)
+    {
+        EXPECT_EQ(a.sections[i].converged, b.sections[i].converged);
+        EXPECT_EQ(a.sections[i].velocity, b.sections[i].velocity);
+        for (auto member : kNoiseSourceSpectra)
+        {
+            EXPECT_EQ((a.sections[i].*member).spl, (b.sections[i].*member).spl);
+            EXPECT_EQ((a.sections[i].*member).oaspl, (b.sections[i].*member).oaspl);
+        }
+    }
+}
+
+} // namespace
+
+TEST_F(CheckpointJournalTest, RestoresRecordsInAppendOrder)
+{
+    Write({ "first", std::string("\0binary\xff", 8), "" });
+    EXPECT_EQ(Restore(), (std::vector<std::string>{ "first", std::string("\0binary\xff", 8), "" }));
+}
+
+TEST_F(CheckpointJournalTest, TornTailIsDroppedAndOverwritten)
+{
+    Write({ "one", "two", "three" });
+
+    // A crash in the middle of the last record
+    fs::resize_file(path, fs::file_size(path) - 2);
+    EXPECT_EQ(Restore(), (std::vector<std::string>{ "one", "two" }));
+
+    // Resuming continues after the last intact record
+    Write({ "four" }, true);
+    EXPECT_EQ(Restore(), (std::vector<std::string>{ "one", "two", "four" }));
+}
+
+TEST_F(CheckpointJournalTest, CorruptRecordEndsRestore)
+{
+    Write({ "one", "two", "three" });
+    {
+        // Payload of "two": header (24) + record one (16 + 3) + record header (16)
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(24 + 16 + 3 + 16);
+        file.put('T');
+    }
+    EXPECT_EQ(Restore(), (std::vector<std::string>{ "one" }));
+}
+
+TEST_F(CheckpointJournalTest, OtherRunKeyIsNotRestored)
+{
+    Write({ "one" });
+
+    for (std::uint64_t other : { CheckpointJournal::RunKey(43, "test", "1.0.0+test"),
+                                 CheckpointJournal::RunKey(42, "other", "1.0.0+test"),
+                                 CheckpointJournal::RunKey(42, "test", "1.0.0+next") })
+    {
+        ASSERT_NE(other, key);
+        CheckpointJournal journal(path, other, true);
+        EXPECT_TRUE(journal.restored().empty());
+        EXPECT_EQ(journal.restore_note(), "written for other inputs or by another build");
+    }
+    EXPECT_EQ(Restore(), (std::vector<std::string>{ "one" }));
+}
+
+TEST_F(CheckpointJournalTest, CompleteRemovesTheFile)
+{
+    {
+        CheckpointJournal journal(path, key, false);
+        journal.Append("one");
+        journal.Complete();
+    }
+    EXPECT_FALSE(fs::exists(path));
+}
+
+TEST_F(CheckpointJournalTest, ResumedNoiseRunMatchesUninterruptedRun)
+{
+    NoiseConfig cfg;
+
+    // Uninterrupted reference
+    auto reference_builder = std::make_shared<CountingBuilder>();
+    SectionNoiseCalculator reference_calc(cfg, nullptr, reference_builder);
+    std::vector<BladeNoiseJob> reference = MakeJobs();
+    for (auto &job : reference)
+        for (std::size_t i = 0; i < job.inputs.size(); ++i)
+            reference_calc.CalculateSection(job, i);
+
+    // First run: interrupted after five sections, last record torn
+    auto builder = std::make_shared<CountingBuilder>();
+    SectionNoiseCalculator calc(cfg, nullptr, builder);
+    {
+        CheckpointJournal journal(path, key, false);
+        std::vector<BladeNoiseJob> jobs = MakeJobs();
+        calc.Resume(jobs, journal);
+        for (std::size_t k = 0; k < 5; ++k)
+            calc.CalculateSection(jobs[k / 4], k % 4);
+    }
+    fs::resize_file(path, fs::file_size(path) - 1);
+
+    // Resumed run: four sections restored, the rest computed
+    builder->calls = 0;
+    std::vector<BladeNoiseJob> jobs = MakeJobs();
+    {
+        CheckpointJournal journal(path, key, true);
+        const auto restored = calc.Resume(jobs, journal);
+
+        std::size_t n_restored = 0;
+        for (std::size_t j = 0; j < jobs.size(); ++j)
+            for (std::size_t i = 0; i < jobs[j].inputs.size(); ++i)
+            {
+                if (restored[j][i])
+                    ++n_restored;
+                else
+                    calc.CalculateSection(jobs[j], i);
+            }
+        EXPECT_EQ(n_restored, 4u);
+        EXPECT_EQ(builder->calls, 12 - 4);
+    }
+
+    for (std::size_t j = 0; j < jobs.size(); ++j)
+        ExpectSameSections(jobs[j].result, reference[j].result);
+
+    // The resumed run journaled its own sections: everything restores now
+    std::vector<BladeNoiseJob> again = MakeJobs();
+    CheckpointJournal journal(path, key, true);
+    const auto restored = calc.Resume(again, journal);
+    for (std::size_t j = 0; j < again.size(); ++j)
+    {
+        EXPECT_EQ(restored[j], std::vector<bool>(4, true));
+        ExpectSameSections(again[j].result, reference[j].result);
+    }
+}
+
+TEST_F(CheckpointJournalTest, NoiseJournalOfOtherJobsStartsOver)
+{
+    NoiseConfig cfg;
+    auto builder = std::make_shared<CountingBuilder>();
+    SectionNoiseCalculator calc(cfg, nullptr, builder);
+    {
+        CheckpointJournal journal(path, key, false);
+        std::vector<BladeNoiseJob> jobs = MakeJobs();
+        calc.Resume(jobs, journal);
+        calc.CalculateSection(jobs[0], 0);
+    }
+
+    std::vector<BladeNoiseJob> jobs = MakeJobs();
+    jobs[1].inputs[2].alpha_deg += 0.5;  // another power curve
+    CheckpointJournal journal(path, key, true);
+    const auto restored = calc.Resume(jobs, journal);
+    for (auto const &flags : restored)
+        EXPECT_EQ(flags, std::vector<bool>(4, false));
+}
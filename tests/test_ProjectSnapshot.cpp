@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+
+#include "../src/ProjectSnapshot.cpp" // Core project is built as an application
+#include "TempDirectoryTest.h"
+
+#include <filesystem>
+#include <fstream>
+
+namespace {
+
+namespace fs = std::filesystem;
+
+// A project directory with a project file and one referenced data file.
+class ProjectSnapshotTest : public TempDirectoryTest
+{
+protected:
+    std::string project;
+    std::string dataFile;
+    std::string snapshot;
+
+    void SetUp() override
+    {
+        TempDirectoryTest::SetUp();
+
+        project  = (dir / "ProjectData.dat").string();
+        dataFile = (dir / "BladeGeometry.dat").string();
+        snapshot = ProjectSnapshot::defaultPath(project);
+        writeFile(project, "rotor_radius 42.5\n");
+        writeFile(dataFile, "DEF 1.0 2.0 3.0\n");
+    }
+
+    static void writeFile(const std::string& path, const std::string& text)
+    {
+        std::ofstream(path, std::ios::binary | std::ios::trunc) << text;
+    }
+
+    Configuration makeConfig() const
+    {
+        Configuration config;
+        config.setValue("rotor_radius", 42.5);
+        config.setValue("n_blades", 3);
+        config.setValue("switch_calc_rotormap", true);
+        config.setValue("blade_geometry_file", dataFile);
+        return config;
+    }
+
+    static BladeInterpolator makeBlade()
+    {
+        std::vector<std::unique_ptr<BladeGeometrySection>> sections;
+        for (int i = 0; i < 2; ++i)
+        {
+            auto section = std::make_unique<BladeGeometrySection>();
+            section->type = "DEF";
+            section->bladeRadius = 10.0 + i;
+            section->chord = 2.5 - 0.5 * i;
+            section->twist = 0.1 * i;
+            section->relativeThickness = 30.0 - 5.0 * i;
+            section->airfoilName = "AF" + std::to_string(i);
+            section->coordinates = { AirfoilCoordinate(0, 1.0, 0.0), AirfoilCoordinate(1, 0.0, 0.05, 0.0, true) };
+
+            section->airfoilPolar = std::make_unique<AirfoilPolarData>(section->airfoilName);
+            AirfoilAeroCoefficients coefficients;
+            coefficients.cl = 0.8 + i;
+            coefficients.cd = 0.01;
+            coefficients.cm = -0.05;
+            section->airfoilPolar->addPolarPoint(AirfoilOperationCondition(3e6, 0.1, 4.0), coefficients);
+            sections.push_back(std::move(section));
+        }
+        return BladeInterpolator(std::move(sections));
+    }
+
+    void writeSnapshot(std::string_view buildId = kBuildIdentity) const
+    {
+        ProjectSnapshot::write(snapshot, project, 7, makeConfig(), makeBlade(), buildId);
+    }
+};
+
+TEST_F(ProjectSnapshotTest, WriteThenLoadRestoresConfigurationAndSections)
+{
+    writeSnapshot();
+
+    std::string reason;
+    auto loaded = ProjectSnapshot::load(snapshot, project, 7, reason);
+    ASSERT_NE(loaded, nullptr) << reason;
+    EXPECT_TRUE(reason.empty());
+
+    const Configuration config = loaded->takeConfiguration();
+    EXPECT_DOUBLE_EQ(config.getDouble("rotor_radius"), 42.5);
+    EXPECT_EQ(config.getInt("n_blades"), 3);
+    EXPECT_TRUE(config.getBool("switch_calc_rotormap"));
+    EXPECT_EQ(config.getString("blade_geometry_file"), dataFile);
+
+    const auto blade = loaded->createBladeInterpolator();
+    const auto expected = makeBlade();
+    ASSERT_EQ(blade->getBladeSections().size(), expected.getBladeSections().size());
+    for (std::size_t i = 0; i < expected.getBladeSections().size(); ++i)
+    {
+        const auto& got = *blade->getBladeSections()[i];
+        const auto& want = *expected.getBladeSections()[i];
+        EXPECT_EQ(got.airfoilName, want.airfoilName);
+        EXPECT_EQ(got.bladeRadius, want.bladeRadius);
+        EXPECT_EQ(got.chord, want.chord);
+        EXPECT_EQ(got.twist, want.twist);
+        EXPECT_EQ(got.relativeThickness, want.relativeThickness);
+        ASSERT_EQ(got.coordinates.size(), want.coordinates.size());
+        EXPECT_EQ(got.coordinates[1].y, want.coordinates[1].y);
+        EXPECT_EQ(got.coordinates[1].isTopSurface, want.coordinates[1].isTopSurface);
+
+        ASSERT_NE(got.airfoilPolar, nullptr);
+        ASSERT_EQ(got.airfoilPolar->getPolarData().size(), 1u);
+        EXPECT_EQ(got.airfoilPolar->getPolarData()[0].coefficients.cl,
+                  want.airfoilPolar->getPolarData()[0].coefficients.cl);
+    }
+}
+
+TEST_F(ProjectSnapshotTest, CorruptPayloadIsRejected)
+{
+    writeSnapshot();
+    {
+        std::fstream file(snapshot, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(-1, std::ios::end);
+        file.put('\x5a');
+    }
+
+    std::string reason;
+    EXPECT_EQ(ProjectSnapshot::load(snapshot, project, 7, reason), nullptr);
+    EXPECT_EQ(reason, "checksum mismatch");
+}
+
+TEST_F(ProjectSnapshotTest, TruncatedFileIsRejected)
+{
+    writeSnapshot();
+    fs::resize_file(snapshot, fs::file_size(snapshot) / 2);
+
+    std::string reason;
+    EXPECT_EQ(ProjectSnapshot::load(snapshot, project, 7, reason), nullptr);
+    EXPECT_EQ(reason, "checksum mismatch");
+}
+
+TEST_F(ProjectSnapshotTest, ChangedInputIsRejected)
+{
+    writeSnapshot();
+    writeFile(dataFile, "DEF 1.0 2.0 3.0\nDEF 4.0 5.0 6.0\n");
+
+    std::string reason;
+    EXPECT_EQ(ProjectSnapshot::load(snapshot, project, 7, reason), nullptr);
+    EXPECT_EQ(reason, "input changed: " + dataFile);
+}
+
+TEST_F(ProjectSnapshotTest, OtherSchemaIsRejected)
+{
+    writeSnapshot();
+
+    std::string reason;
+    EXPECT_EQ(ProjectSnapshot::load(snapshot, project, 8, reason), nullptr);
+    EXPECT_EQ(reason, "configuration schema changed");
+}
+
+TEST_F(ProjectSnapshotTest, OtherBuildIsRejected)
+{
+    writeSnapshot("1.0.0+aaaaaaaaaaaaaaaa");
+
+    std::string reason;
+    EXPECT_EQ(ProjectSnapshot::load(snapshot, project, 7, reason, "1.0.0+bbbbbbbbbbbbbbbb"), nullptr);
+    EXPECT_EQ(reason, "written by build 1.0.0+aaaaaaaaaaaaaaaa, this is 1.0.0+bbbbbbbbbbbbbbbb");
+
+    EXPECT_NE(ProjectSnapshot::load(snapshot, project, 7, reason, "1.0.0+aaaaaaaaaaaaaaaa"), nullptr)
+        << reason;
+}
+
+}  // namespace
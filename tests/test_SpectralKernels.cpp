@@ -0,0 +1,210 @@
+#include <gtest/gtest.h>
+
+#include "../include/bladenoise/math/SpectralKernels.h"
+#include "../include/bladenoise/noise/TBLTENoiseSource.h"
+#include "../include/bladenoise/noise/BluntnessNoiseSource.h"
+#include "../include/bladenoise/noise/TurbulentInflowNoiseSource.h"
+#include "../include/bladenoise/airfoil/BPMBoundaryLayerCalculator.h"
+#include "../src/bladenoise/math/SpecialFunctions.cpp" // Core project is built as an application
+#include "../src/bladenoise/noise/Directivity.cpp"
+#include "../src/bladenoise/noise/TBLTENoiseSource.cpp"
+#include "../src/bladenoise/noise/BluntnessNoiseSource.cpp"
+#include "../src/bladenoise/noise/TurbulentInflowNoiseSource.cpp"
+#include "../src/bladenoise/airfoil/BPMBoundaryLayerCalculator.cpp"
+
+#include <array>
+#include <cmath>
+
+using namespace bladenoise;
+
+namespace {
+
+// Cases follow the BPM (NASA RP-1218) NACA 0012 wind-tunnel set-up:
+// U = 71.3 m/s, span 0.4572 m, observer 1.22 m at 90 deg, boundary layers
+// from the BPM correlations.  Spectra are pinned over the measured range,
+// 200 Hz - 20 kHz (bands 13..33).
+//
+// All references come from the scalar per-band implementation the spectral
+// kernels replaced.  The LBL-VS case sets a laminar pressure side directly,
+// inside the Re_delta* window of the G2 fit.
+constexpr std::size_t kFirstBand = 13;
+constexpr std::size_t kNumPinned = 21;
+using Spectrum = std::array<double, kNumPinned>;
+
+const Spectrum kTblTrippedTotal = {
+    53.4976, 55.4071, 57.2800, 59.1463, 60.8489, 62.5849, 64.3816,
+    65.9193, 66.5287, 66.2069, 65.3150, 64.0113, 62.3448, 60.6160,
+    58.9792, 57.2276, 55.3184, 53.4140, 51.3674, 48.9099, 46.4890};
+const Spectrum kTblTrippedPressure = {
+    46.5275, 48.6644, 50.7066, 52.6646, 54.3803, 56.0699, 57.7526,
+    59.2954, 60.8364, 62.2049, 62.3326, 61.3821, 59.7861, 58.1362,
+    56.5758, 54.9080, 53.0990, 51.3039, 49.3808, 47.0736, 44.7978};
+const Spectrum kTblTrippedSuction = {
+    52.5216, 54.3615, 56.1495, 57.9015, 59.4772, 61.0765, 62.7262,
+    64.0346, 64.2928, 63.3322, 61.7912, 60.2504, 58.6380, 56.9188,
+    55.2371, 53.3905, 51.3398, 49.2667, 47.0151, 44.2855, 41.5748};
+const Spectrum kTblStalledTotal = {
+    80.6263, 79.0016, 77.2338, 75.2858, 73.3280, 71.1318, 68.6516,
+    66.1148, 63.3392, 59.9597, 56.5978, 52.9179, 48.7442, 44.0127,
+    39.1826, 33.7341, 27.5955, 21.3691, 14.6408, 6.5820, -1.2865};
+const Spectrum kLblTotal = {
+    231.1626, 235.0196, 239.0144, 243.1436, 247.0006, 250.9954, 255.1246,
+    258.9816, 262.8386, 271.5478, 280.1192, 280.2358, 271.7382, 263.0534,
+    259.1963, 255.2016, 251.0724, 247.2153, 243.3583, 239.0914, 235.2343};
+const Spectrum kLblLaminar = {
+    231.1626, 235.0196, 239.0144, 243.1436, 247.0006, 250.9954, 255.1246,
+    258.9816, 262.8386, 271.5478, 280.1192, 280.2358, 271.7382, 263.0534,
+    259.1963, 255.2016, 251.0724, 247.2153, 243.3583, 239.0914, 235.2343};
+const Spectrum kBluntThick = {
+    1.4555, 7.3221, 13.3982, 19.6789, 25.5456, 31.6217, 37.9024,
+    43.7690, 49.6356, 56.1258, 61.9925, 67.8591, 72.3953, 60.0495,
+    44.9759, 29.3639, 13.2264, -1.8472, -16.9209, -33.5967, -48.6704};
+const Spectrum kBluntThin = {
+    39.3765, 40.9728, 42.6261, 44.3351, 45.9314, 47.5848, 49.2937,
+    50.8901, 52.4864, 54.2524, 55.8487, 57.4450, 59.0984, 60.8073,
+    62.3370, 59.5849, 43.4474, 28.3737, 13.3001, -3.3757, -18.4494};
+const Spectrum kInflowGuidati = {
+    76.8476, 76.2958, 75.4297, 74.2983, 76.0911, 74.7085, 73.1816,
+    71.6874, 70.1424, 68.3874, 66.7685, 65.1253, 63.4032, 61.6059,
+    59.9146, 58.1528, 56.3230, 54.6076, 52.8873, 50.9798, 49.2523};
+const Spectrum kInflowAmiet = {
+    77.0825, 76.6551, 75.9179, 74.9198, 76.8370, 75.5833, 74.1896,
+    72.8198, 71.3993, 69.7819, 68.2874, 66.7687, 65.1755, 63.5114,
+    61.9445, 60.3115, 58.6150, 57.0240, 55.4282, 53.6583, 52.0552};
+
+constexpr double kToleranceDb = 0.01;
+
+RealVector bands()
+{
+    return RealVector(constants::THIRD_OCTAVE_BANDS.begin(), constants::THIRD_OCTAVE_BANDS.end());
+}
+
+ProjectConfig bpmCase(double chord, double alpha, TripConfig trip)
+{
+    ProjectConfig c;
+    c.chord = chord;
+    c.freestream_velocity = 71.3;
+    c.angle_of_attack = alpha;
+    c.span = 0.4572;
+    c.observer_distance = 1.22;
+    c.trip_config = trip;
+    return c;
+}
+
+BoundaryLayerState bl(double dstar, bool turbulent)
+{
+    BoundaryLayerState b;
+    b.displacement_thickness = dstar;
+    b.is_turbulent = turbulent;
+    return b;
+}
+
+void boundaryLayers(const ProjectConfig &c, BoundaryLayerState &upper, BoundaryLayerState &lower)
+{
+    airfoil::BPMBoundaryLayerCalculator calculator;
+    ASSERT_TRUE(calculator.calculate(io::AirfoilData{}, c, upper, lower));
+}
+
+void expectSpectrum(const RealVector &actual, const Spectrum &expected)
+{
+    ASSERT_EQ(actual.size(), constants::THIRD_OCTAVE_BANDS.size());
+    for (std::size_t i = 0; i < expected.size(); ++i)
+        EXPECT_NEAR(actual[kFirstBand + i], expected[i], kToleranceDb)
+            << "band " << constants::THIRD_OCTAVE_BANDS[kFirstBand + i] << " Hz";
+}
+
+}  // namespace
+
+TEST(SpectralKernelsTest, log10BandTable_should_match_std_log10) {
+    for (std::size_t i = 0; i < math::spectral::NUM_BANDS; ++i)
+        EXPECT_NEAR(math::spectral::LOG10_THIRD_OCTAVE_BANDS[i],
+                    std::log10(constants::THIRD_OCTAVE_BANDS[i]), 1e-14);
+}
+
+TEST(SpectralKernelsTest, energySum_should_skip_floor_levels) {
+    const std::array<double, 3> levels = {80.0, 80.0, -100.0};
+    EXPECT_NEAR(math::spectral::energy_sum(levels.data(), levels.size()),
+                80.0 + 10.0 * std::log10(2.0), 1e-12);
+    EXPECT_EQ(math::spectral::energy_sum(levels.data() + 2, 1), -100.0);
+}
+
+TEST(SpectralKernelsTest, tblte_tripped_should_match_reference_spectra) {
+    ProjectConfig c = bpmCase(0.3048, 1.5, TripConfig::HEAVY_TRIP);
+    c.compute_laminar = false;
+    BoundaryLayerState upper, lower;
+    boundaryLayers(c, upper, lower);
+
+    noise::TBLTENoiseSource source;
+    NoiseResult result(34);
+    ASSERT_TRUE(source.calculate(c, upper, lower, bands(), result));
+
+    expectSpectrum(result.spl, kTblTrippedTotal);
+    expectSpectrum(source.pressure_side_result.spl, kTblTrippedPressure);
+    expectSpectrum(source.suction_side_result.spl, kTblTrippedSuction);
+}
+
+TEST(SpectralKernelsTest, tblte_stalled_should_match_reference_spectrum) {
+    ProjectConfig c = bpmCase(0.3048, 12.3, TripConfig::HEAVY_TRIP);
+    c.compute_laminar = false;
+    BoundaryLayerState upper, lower;
+    boundaryLayers(c, upper, lower);
+
+    noise::TBLTENoiseSource source;
+    NoiseResult result(34);
+    ASSERT_TRUE(source.calculate(c, upper, lower, bands(), result));
+
+    expectSpectrum(result.spl, kTblStalledTotal);
+}
+
+TEST(SpectralKernelsTest, lblvs_laminar_should_match_reference_spectra) {
+    ProjectConfig c;
+    c.chord = 0.5;
+    c.freestream_velocity = 50.0;
+    c.angle_of_attack = 4.0;
+    c.span = 1.0;
+    c.observer_distance = 10.0;
+
+    noise::TBLTENoiseSource source;
+    NoiseResult result(34);
+    ASSERT_TRUE(source.calculate(c, bl(0.004, true), bl(0.004, false), bands(), result));
+
+    expectSpectrum(source.laminar_result.spl, kLblLaminar);
+    expectSpectrum(result.spl, kLblTotal);
+}
+
+TEST(SpectralKernelsTest, bluntness_should_match_reference_spectra) {
+    ProjectConfig c = bpmCase(0.6096, 0.0, TripConfig::HEAVY_TRIP);
+    c.trailing_edge_thickness = 0.0025;
+    c.trailing_edge_angle = 14.0;
+    BoundaryLayerState upper, lower;
+    boundaryLayers(c, upper, lower);
+
+    noise::BluntnessNoiseSource source;
+    NoiseResult result(34);
+    ASSERT_TRUE(source.calculate(c, upper, lower, bands(), result));
+    expectSpectrum(result.spl, kBluntThick);
+
+    c.trailing_edge_thickness = 0.0011;
+    ASSERT_TRUE(source.calculate(c, upper, lower, bands(), result));
+    expectSpectrum(result.spl, kBluntThin);
+}
+
+TEST(SpectralKernelsTest, turbulentInflow_should_match_reference_spectra) {
+    ProjectConfig c = bpmCase(0.3048, 0.0, TripConfig::HEAVY_TRIP);
+    c.freestream_velocity = 40.0;
+    c.turbulence_intensity = 5.0;
+    c.turbulence_length_scale = 0.05;
+    c.thickness_1_percent = 0.0284;
+    c.thickness_10_percent = 0.1;
+    BoundaryLayerState upper, lower;
+    boundaryLayers(c, upper, lower);
+
+    NoiseResult result(34);
+    noise::TurbulentInflowNoiseSource guidati(TINoiseMethod::GUIDATI);
+    ASSERT_TRUE(guidati.calculate(c, upper, lower, bands(), result));
+    expectSpectrum(result.spl, kInflowGuidati);
+
+    noise::TurbulentInflowNoiseSource amiet(TINoiseMethod::AMIET);
+    ASSERT_TRUE(amiet.calculate(c, upper, lower, bands(), result));
+    expectSpectrum(result.spl, kInflowAmiet);
+}
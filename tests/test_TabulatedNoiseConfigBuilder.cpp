@@ -0,0 +1,181 @@
+#include <gtest/gtest.h>
+
+#include "../src/TabulatedNoiseConfigBuilder.cpp" // Core project is built as an application
+
+#include <atomic>
+#include <cmath>
+#include <memory>
+
+namespace {
+
+// Exact builder stand-in: every band of every source is a quadratic in
+// (ln Re, alpha), so the bilinear error of a cell is largest at its centre
+// and known in closed form.  `quiet_curvature` bends the pressure-side
+// spectrum only, 60 dB below the others, where it cannot show in the total.
+class QuadraticBuilder : public ISectionNoiseConfigBuilder
+{
+public:
+    double curvature = 0.0;        ///< d²L/d(ln Re)² of every source [dB]
+    double quiet_curvature = 0.0;  ///< extra d²L/dalpha² of the pressure side [dB/deg²]
+    mutable std::atomic<int> calls{0};
+
+    bool Build(SectionNoiseInput const &inp, NoiseConfig const &,
+               SectionNoiseResult &result) const override
+    {
+        ++calls;
+        const double x = std::log(inp.velocity * inp.chord / inp.kinematic_viscosity);
+        const double a = inp.alpha_deg;
+        const double base = 0.5 * curvature * x * x + 0.3 * a;
+
+        SectionNoiseSpectrum SectionNoiseResult::*loud[] = {
+            &SectionNoiseResult::tbl_suction_side, &SectionNoiseResult::separation,
+            &SectionNoiseResult::laminar_vortex,   &SectionNoiseResult::bluntness,
+            &SectionNoiseResult::turbulent_inflow, &SectionNoiseResult::total };
+        for (auto member : loud)
+        {
+            (result.*member).spl = { base + 10.0, base + 20.0, base + 30.0 };
+            (result.*member).oaspl = base + 31.0;
+        }
+        const double quiet = base - 30.0 + 0.5 * quiet_curvature * a * a;
+        result.tbl_pressure_side.spl = { quiet, quiet, spectral::FLOOR_DB };
+        result.tbl_pressure_side.oaspl = quiet;
+        return true;
+    }
+};
+
+SectionNoiseInput Section(double re, double alpha_deg)
+{
+    SectionNoiseInput inp;
+    inp.chord = 1.0;
+    inp.velocity = re * inp.kinematic_viscosity / inp.chord;
+    inp.reynolds = re;
+    inp.alpha_deg = alpha_deg;
+    return inp;
+}
+
+double MaxError(SectionNoiseResult const &a, SectionNoiseResult const &b)
+{
+    double err = 0.0;
+    for (auto member : kSpectra)
+        for (std::size_t k = 0; k < (a.*member).spl.size(); ++k)
+            if ((a.*member).spl[k] > spectral::INACTIVE_DB)
+                err = std::max(err, std::abs((a.*member).spl[k] - (b.*member).spl[k]));
+    return err;
+}
+
+} // namespace
+
+TEST(TabulatedNoiseConfigBuilder, InterpolatesWithinTolerance)
+{
+    auto exact = std::make_shared<QuadraticBuilder>();
+    exact->curvature = 100.0;   // 0.031 dB at a level-0 cell centre
+    TabulatedNoiseConfigBuilder table(exact, 0.1);
+    NoiseConfig cfg;
+
+    for (double re = 2.0e5; re < 4.0e5; re *= 1.013)
+    {
+        for (double alpha = 1.1; alpha < 4.0; alpha += 0.37)
+        {
+            SectionNoiseResult got, want;
+            ASSERT_TRUE(table.Build(Section(re, alpha), cfg, got));
+            exact->Build(Section(re, alpha), cfg, want);
+            EXPECT_LE(MaxError(got, want), got.surrogate_error_db + 1e-9);
+            EXPECT_LE(got.surrogate_error_db, 0.1);
+        }
+    }
+    EXPECT_EQ(table.stats().fallbacks, 0u);
+    EXPECT_EQ(table.stats().refined, 0u);
+}
+
+TEST(TabulatedNoiseConfigBuilder, RefinesUntilToleranceHolds)
+{
+    auto exact = std::make_shared<QuadraticBuilder>();
+    exact->curvature = 1000.0;  // 0.31 dB at level 0, 0.078 at level 1
+    TabulatedNoiseConfigBuilder table(exact, 0.1);
+    NoiseConfig cfg;
+
+    SectionNoiseResult got, want;
+    ASSERT_TRUE(table.Build(Section(3.0e5, 2.2), cfg, got));
+    exact->Build(Section(3.0e5, 2.2), cfg, want);
+
+    EXPECT_GT(got.surrogate_error_db, 0.0);
+    EXPECT_LE(got.surrogate_error_db, 0.1);
+    EXPECT_LE(MaxError(got, want), 0.1);
+    EXPECT_EQ(table.stats().refined, 1u);
+    EXPECT_EQ(table.stats().rejected, 1u);
+    EXPECT_EQ(table.stats().fallbacks, 0u);
+}
+
+TEST(TabulatedNoiseConfigBuilder, ChecksEverySource)
+{
+    // Only the quiet pressure side is curved; the total stays bilinear.
+    auto exact = std::make_shared<QuadraticBuilder>();
+    exact->quiet_curvature = 8.0;   // 0.25 dB at a cell centre
+    TabulatedNoiseConfigBuilder table(exact, 0.1, { .max_refinement = 0 });
+    NoiseConfig cfg;
+
+    SectionNoiseResult got, want;
+    ASSERT_TRUE(table.Build(Section(3.0e5, 2.2), cfg, got));
+    exact->Build(Section(3.0e5, 2.2), cfg, want);
+
+    EXPECT_EQ(got.surrogate_error_db, 0.0);
+    EXPECT_EQ(MaxError(got, want), 0.0);
+    EXPECT_EQ(table.stats().rejected, 1u);
+    EXPECT_EQ(table.stats().fallbacks, 1u);
+}
+
+TEST(TabulatedNoiseConfigBuilder, FallsBackOutsideTable)
+{
+    auto exact = std::make_shared<QuadraticBuilder>();
+    TabulatedNoiseConfigBuilder table(exact, 0.1);
+    NoiseConfig cfg;
+
+    SectionNoiseResult got;
+    ASSERT_TRUE(table.Build(Section(1.0e8, 2.0), cfg, got));
+    ASSERT_TRUE(table.Build(Section(3.0e5, 40.0), cfg, got));
+    EXPECT_EQ(table.stats().fallbacks, 2u);
+    EXPECT_EQ(table.stats().nodes, 0u);
+    EXPECT_EQ(exact->calls.load(), 2);
+}
+
+TEST(TabulatedNoiseConfigBuilder, IdentifiesAirfoilByContent)
+{
+    auto exact = std::make_shared<QuadraticBuilder>();
+    TabulatedNoiseConfigBuilder table(exact, 0.1);
+    NoiseConfig cfg;
+
+    auto make_airfoil = [](double camber)
+    {
+        auto af = std::make_shared<bladenoise::io::AirfoilData>();
+        af->x = { 1.0, 0.5, 0.0, 0.5, 1.0 };
+        af->y = { 0.0, 0.06 + camber, 0.0, -0.06 + camber, 0.0 };
+        af->num_points = af->x.size();
+        return af;
+    };
+
+    SectionNoiseInput inp = Section(3.0e5, 2.2);
+    SectionNoiseResult got;
+
+    inp.airfoil_data = make_airfoil(0.0);
+    ASSERT_TRUE(table.Build(inp, cfg, got));
+    const std::size_t nodes = table.stats().nodes;
+
+    // Same shape at another address: the table is reused
+    inp.airfoil_data = make_airfoil(0.0);
+    ASSERT_TRUE(table.Build(inp, cfg, got));
+    EXPECT_EQ(table.stats().nodes, nodes);
+
+    // Different shape: a separate table
+    inp.airfoil_data = make_airfoil(0.02);
+    ASSERT_TRUE(table.Build(inp, cfg, got));
+    EXPECT_EQ(table.stats().nodes, 2 * nodes);
+}
+
+TEST(TabulatedNoiseConfigBuilder, RejectsInvalidSettings)
+{
+    auto exact = std::make_shared<QuadraticBuilder>();
+    EXPECT_THROW(TabulatedNoiseConfigBuilder(nullptr, 0.1), std::invalid_argument);
+    EXPECT_THROW(TabulatedNoiseConfigBuilder(exact, 0.0), std::invalid_argument);
+    EXPECT_THROW(TabulatedNoiseConfigBuilder(exact, 0.1, { .max_refinement = -1 }),
+                 std::invalid_argument);
+}